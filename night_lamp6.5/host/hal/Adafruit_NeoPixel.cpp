@@ -0,0 +1,58 @@
+#include <Adafruit_NeoPixel.h>
+
+#include "hal_internal.h"
+
+Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t n, int16_t p, neoPixelType type)
+  : numLEDs(n), pin(p), pixels(new uint8_t[n * 3]()) {
+  rOffset = (type >> 4) & 0b11;
+  gOffset = (type >> 2) & 0b11;
+  bOffset = type & 0b11;
+}
+
+Adafruit_NeoPixel::~Adafruit_NeoPixel() {
+  delete[] pixels;
+}
+
+void Adafruit_NeoPixel::show() {
+  host::recordPixelFrame(pixels, numLEDs * 3);
+}
+
+void Adafruit_NeoPixel::clear() {
+  memset(pixels, 0, numLEDs * 3);
+}
+
+// Like the library: rescales what is already in the buffer
+void Adafruit_NeoPixel::setBrightness(uint8_t b) {
+  uint8_t newBrightness = b + 1;
+  if (newBrightness == brightness) return;
+  uint8_t  oldBrightness = brightness - 1;
+  uint16_t scale;
+  if (oldBrightness == 0) scale = 0;
+  else if (b == 255) scale = 65535 / oldBrightness;
+  else scale = (((uint16_t)newBrightness << 8) - 1) / oldBrightness;
+  for (uint16_t i = 0; i < numLEDs * 3; i++) pixels[i] = (pixels[i] * scale) >> 8;
+  brightness = newBrightness;
+}
+
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+  if (n >= numLEDs) return;
+  if (brightness) {
+    r = (r * brightness) >> 8;
+    g = (g * brightness) >> 8;
+    b = (b * brightness) >> 8;
+  }
+  uint8_t* p = &pixels[n * 3];
+  p[rOffset] = r;
+  p[gOffset] = g;
+  p[bOffset] = b;
+}
+
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint32_t c) {
+  setPixelColor(n, (uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c);
+}
+
+uint32_t Adafruit_NeoPixel::getPixelColor(uint16_t n) const {
+  if (n >= numLEDs) return 0;
+  const uint8_t* p = &pixels[n * 3];
+  return Color(p[rOffset], p[gOffset], p[bOffset]);
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <Arduino.h>
+
+// The library's frame buffer (color order, brightness scaling) as is;
+// show() records the wire bytes as a frame (host::pixelFrames()) instead
+// of bit-banging them.
+#define NEO_RGB    ((0 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_GRB    ((1 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_KHZ800 0x0000
+
+typedef uint16_t neoPixelType;
+
+class Adafruit_NeoPixel {
+ public:
+  Adafruit_NeoPixel(uint16_t n, int16_t pin = 6, neoPixelType type = NEO_GRB + NEO_KHZ800);
+  ~Adafruit_NeoPixel();
+
+  void     begin() {}
+  void     show();
+  bool     canShow() { return true; }
+  void     clear();
+  void     setBrightness(uint8_t b);
+  uint8_t  getBrightness() const { return brightness - 1; }
+  void     setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
+  void     setPixelColor(uint16_t n, uint32_t c);
+  uint32_t getPixelColor(uint16_t n) const;
+  uint8_t* getPixels() const { return pixels; }
+  uint16_t numPixels() const { return numLEDs; }
+
+  static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+  }
+
+ private:
+  uint16_t numLEDs;
+  int16_t  pin;
+  uint8_t  brightness = 0;  // stored +1; 0 = full, no scaling
+  uint8_t* pixels;
+  uint8_t  rOffset, gOffset, bOffset;
+};
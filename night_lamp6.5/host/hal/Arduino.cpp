@@ -0,0 +1,197 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include <esp_rom_crc.h>
+#include <esp_system.h>
+
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "hal_internal.h"
+#include "host_hal.h"
+
+// ---------------- Time ----------------
+uint64_t host::uptimeUs() {
+  using namespace std::chrono;
+  static const steady_clock::time_point boot = steady_clock::now();
+  return (uint64_t)duration_cast<microseconds>(steady_clock::now() - boot).count();
+}
+
+uint32_t millis() { return (uint32_t)(host::uptimeUs() / 1000); }
+uint32_t micros() { return (uint32_t)host::uptimeUs(); }
+int64_t  esp_timer_get_time() { return (int64_t)host::uptimeUs(); }
+
+void delay(uint32_t ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+void delayMicroseconds(uint32_t us) { std::this_thread::sleep_for(std::chrono::microseconds(us)); }
+void yield() { std::this_thread::yield(); }
+
+// ---------------- Random ----------------
+// Seeded (LAMP_SEED, default 1) so runs repeat
+static std::mutex   rngLock;
+static std::mt19937 rng;
+static bool         rngSeeded = false;
+
+static uint32_t rngNext() {
+  std::lock_guard<std::mutex> lock(rngLock);
+  if (!rngSeeded) {
+    const char* seed = getenv("LAMP_SEED");
+    rng.seed(seed ? (uint32_t)strtoul(seed, nullptr, 10) : 1);
+    rngSeeded = true;
+  }
+  return rng();
+}
+
+long random(long howbig) {
+  if (howbig <= 0) return 0;
+  return (long)(rngNext() % (uint32_t)howbig);
+}
+
+long random(long howsmall, long howbig) {
+  if (howsmall >= howbig) return howsmall;
+  return howsmall + random(howbig - howsmall);
+}
+
+uint32_t esp_random() { return rngNext(); }
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  if (inMax == inMin) return outMin;
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// ---------------- GPIO ----------------
+namespace {
+struct HostPin {
+  uint8_t mode;
+  int     level;
+  void  (*isr)(void);
+  int     isrMode;
+};
+const int HOST_PINS = 64;
+HostPin   pins[HOST_PINS];
+}  // namespace
+
+std::recursive_mutex& host::interruptLock() {
+  static std::recursive_mutex lock;
+  return lock;
+}
+
+void noInterrupts() { host::interruptLock().lock(); }
+void interrupts()   { host::interruptLock().unlock(); }
+
+void portENTER_CRITICAL(portMUX_TYPE*) { host::interruptLock().lock(); }
+void portEXIT_CRITICAL(portMUX_TYPE*)  { host::interruptLock().unlock(); }
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  if (pin >= HOST_PINS) return;
+  std::lock_guard<std::recursive_mutex> lock(host::interruptLock());
+  pins[pin].mode = mode;
+  if (mode == INPUT_PULLUP) pins[pin].level = HIGH;
+}
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+  if (pin >= HOST_PINS) return;
+  std::lock_guard<std::recursive_mutex> lock(host::interruptLock());
+  pins[pin].level = level ? HIGH : LOW;
+}
+
+int digitalRead(uint8_t pin) {
+  return host::pinLevel(pin);
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode) {
+  if (pin >= HOST_PINS) return;
+  std::lock_guard<std::recursive_mutex> lock(host::interruptLock());
+  pins[pin].isr     = isr;
+  pins[pin].isrMode = mode;
+}
+
+void detachInterrupt(uint8_t pin) {
+  attachInterrupt(pin, nullptr, 0);
+}
+
+void host::setPin(uint8_t pin, int level) {
+  if (pin >= HOST_PINS) return;
+  std::lock_guard<std::recursive_mutex> lock(interruptLock());
+  HostPin& p = pins[pin];
+  int from = p.level;
+  p.level  = level ? HIGH : LOW;
+  if (!p.isr || from == p.level) return;
+  if (p.isrMode == CHANGE || (p.isrMode == RISING && p.level) || (p.isrMode == FALLING && !p.level)) p.isr();
+}
+
+int host::pinLevel(uint8_t pin) {
+  if (pin >= HOST_PINS) return LOW;
+  std::lock_guard<std::recursive_mutex> lock(interruptLock());
+  return pins[pin].level;
+}
+
+// ---------------- Print / Serial ----------------
+size_t Print::printf(const char* fmt, ...) {
+  char    small[256];
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(small, sizeof(small), fmt, args);
+  va_end(args);
+  if (n < 0) return 0;
+  if ((size_t)n < sizeof(small)) return write((const uint8_t*)small, n);
+
+  std::vector<char> big(n + 1);
+  va_start(args, fmt);
+  vsnprintf(big.data(), big.size(), fmt, args);
+  va_end(args);
+  return write((const uint8_t*)big.data(), n);
+}
+
+String IPAddress::toString() const {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%u.%u.%u.%u", o[0], o[1], o[2], o[3]);
+  return String(buf);
+}
+
+HardwareSerial Serial;
+
+size_t HardwareSerial::write(const uint8_t* data, size_t len) {
+  static const bool quiet = getenv("LAMP_QUIET") && strcmp(getenv("LAMP_QUIET"), "0") != 0;
+  if (!quiet) {
+    fwrite(data, 1, len, stdout);
+    fflush(stdout);
+  }
+  return len;
+}
+
+EspClass ESP;
+
+uint32_t EspClass::getCycleCount()  { return (uint32_t)(host::uptimeUs() * 1000); }
+void     EspClass::restart()        { esp_restart(); }
+
+// ---------------- ESP-IDF ----------------
+static std::vector<shutdown_handler_t> shutdownHandlers;
+
+esp_err_t esp_register_shutdown_handler(shutdown_handler_t handler) {
+  shutdownHandlers.push_back(handler);
+  return ESP_OK;
+}
+
+// Tasks are detached threads, so skip static destructors like a reset would
+void esp_restart() {
+  for (size_t i = shutdownHandlers.size(); i-- > 0;) shutdownHandlers[i]();
+  fflush(stdout);
+  _exit(0);
+}
+
+uint32_t esp_rom_crc32_le(uint32_t crc, uint8_t const* buf, uint32_t len) {
+  crc = ~crc;
+  while (len--) {
+    crc ^= *buf++;
+    for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+  }
+  return ~crc;
+}
+
+// ---------------- WiFi ----------------
+WiFiClass WiFi;
+
+bool WiFiClass::softAP(const char*, const char*) { return true; }
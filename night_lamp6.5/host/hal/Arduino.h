@@ -0,0 +1,222 @@
+#pragma once
+// Host stand-in for the Arduino-ESP32 core: the subset the sketch uses,
+// on the C++ standard library. Time is the process's steady clock; GPIO,
+// LEDC and RMT record what the sketch does (see host_hal.h to read it
+// back or to drive inputs).
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include <string>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#define PROGMEM
+#define PGM_P     const char*
+#define IRAM_ATTR
+#define F(s)      s
+
+#define HIGH 1
+#define LOW  0
+
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+using std::min;
+using std::max;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+// 32-bit like on the device, so wraparound behaves the same
+uint32_t millis();
+uint32_t micros();
+void     delay(uint32_t ms);
+void     delayMicroseconds(uint32_t us);
+void     yield();
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int  digitalRead(uint8_t pin);
+inline int digitalPinToInterrupt(int pin) { return pin; }
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode);
+void detachInterrupt(uint8_t pin);
+void noInterrupts();
+void interrupts();
+
+class String;
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* data, size_t len) {
+    for (size_t i = 0; i < len; i++) write(data[i]);
+    return len;
+  }
+  size_t write(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+  size_t write(const char* s, size_t len) { return write((const uint8_t*)s, len); }
+
+  size_t print(const char* s) { return write(s); }
+  size_t print(const String& s);
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v) { return printf("%d", v); }
+  size_t print(unsigned v) { return printf("%u", v); }
+  size_t print(long v) { return printf("%ld", v); }
+  size_t print(unsigned long v) { return printf("%lu", v); }
+  size_t print(double v, int digits = 2) { return printf("%.*f", digits, v); }
+  template <typename T>
+  size_t println(T v) { return print(v) + println(); }
+  size_t println() { return write("\r\n"); }
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+  virtual void flush() {}
+  virtual int  availableForWrite() { return 0; }
+};
+
+class String {
+ public:
+  String(const char* s = "") : s(s ? s : "") {}
+  String(const char* s, size_t len) : s(s, len) {}
+  String(const std::string& str) : s(str) {}
+  String(char c) : s(1, c) {}
+  String(int v) : s(std::to_string(v)) {}
+  String(unsigned v) : s(std::to_string(v)) {}
+  String(long v) : s(std::to_string(v)) {}
+  String(unsigned long v) : s(std::to_string(v)) {}
+
+  const char* c_str() const { return s.c_str(); }
+  size_t      length() const { return s.size(); }
+  bool        isEmpty() const { return s.empty(); }
+  bool        reserve(unsigned n) { s.reserve(n); return true; }
+  char        operator[](size_t i) const { return i < s.size() ? s[i] : 0; }
+  char        charAt(size_t i) const { return (*this)[i]; }
+
+  String& operator+=(const String& o) { s += o.s; return *this; }
+  String& operator+=(const char* o) { s += o; return *this; }
+  String& operator+=(char c) { s += c; return *this; }
+  friend String operator+(const String& a, const String& b) { return String(a.s + b.s); }
+  friend String operator+(const String& a, const char* b) { return String(a.s + b); }
+  friend String operator+(const char* a, const String& b) { return String(a + b.s); }
+
+  bool operator==(const String& o) const { return s == o.s; }
+  bool operator==(const char* o) const { return s == o; }
+  bool operator!=(const String& o) const { return s != o.s; }
+  bool operator!=(const char* o) const { return s != o; }
+  bool equalsIgnoreCase(const String& o) const { return strcasecmp(s.c_str(), o.c_str()) == 0; }
+
+  int  indexOf(char c, unsigned from = 0) const {
+    size_t i = s.find(c, from);
+    return i == std::string::npos ? -1 : (int)i;
+  }
+  int  indexOf(const char* t, unsigned from = 0) const {
+    size_t i = s.find(t, from);
+    return i == std::string::npos ? -1 : (int)i;
+  }
+  bool startsWith(const String& p) const { return s.compare(0, p.s.size(), p.s) == 0; }
+  bool endsWith(const String& p) const {
+    return s.size() >= p.s.size() && s.compare(s.size() - p.s.size(), p.s.size(), p.s) == 0;
+  }
+  String substring(unsigned from) const { return from < s.size() ? String(s.substr(from)) : String(); }
+  String substring(unsigned from, unsigned to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= s.size()) return String();
+    return String(s.substr(from, to - from));
+  }
+  void toLowerCase() { for (char& c : s) c = (char)tolower((unsigned char)c); }
+  void toUpperCase() { for (char& c : s) c = (char)toupper((unsigned char)c); }
+  void trim() {
+    size_t a = s.find_first_not_of(" \t\r\n");
+    size_t b = s.find_last_not_of(" \t\r\n");
+    s = a == std::string::npos ? "" : s.substr(a, b - a + 1);
+  }
+  long toInt() const { return strtol(s.c_str(), nullptr, 10); }
+
+  const std::string& str() const { return s; }
+
+ private:
+  std::string s;
+};
+
+inline size_t Print::print(const String& s) { return write(s.c_str(), s.length()); }
+
+class IPAddress {
+ public:
+  IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : o{ a, b, c, d } {}
+  uint8_t operator[](int i) const { return o[i]; }
+  String  toString() const;
+
+ private:
+  uint8_t o[4];
+};
+
+// Serial goes to stdout (LAMP_QUIET=1 in the environment silences it)
+class HardwareSerial : public Print {
+ public:
+  void   begin(unsigned long) {}
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* data, size_t len) override;
+  int    availableForWrite() override { return 128; }
+  operator bool() const { return true; }
+  using Print::write;
+};
+extern HardwareSerial Serial;
+
+// Heap figures count what operator new/delete hand out in this process,
+// against a notional heap of host::HEAP_BYTES, so leaks and growth show up
+// like they would on the device. The cycle counter counts nanoseconds.
+class EspClass {
+ public:
+  uint32_t getHeapSize();
+  uint32_t getFreeHeap();
+  uint32_t getMinFreeHeap();
+  uint32_t getMaxAllocHeap() { return getFreeHeap(); }
+  uint32_t getCycleCount();
+  uint32_t getCpuFreqMHz() { return 1000; }
+  void     restart();
+};
+extern EspClass ESP;
+
+// LEDC (esp32-hal-ledc)
+bool ledcAttachChannel(uint8_t pin, uint32_t freq, uint8_t resolution, uint8_t channel);
+bool ledcAttach(uint8_t pin, uint32_t freq, uint8_t resolution);
+bool ledcWrite(uint8_t pin, uint32_t duty);
+bool ledcFade(uint8_t pin, uint32_t startDuty, uint32_t targetDuty, int maxFadeTimeMs);
+
+// RMT (esp32-hal-rmt); a TX channel decodes WS2812 symbols back into
+// bytes and records the frame
+typedef enum { RMT_RX_MODE = 0, RMT_TX_MODE = 1 } rmt_ch_dir_t;
+typedef enum { RMT_MEM_NUM_BLOCKS_1 = 1, RMT_MEM_NUM_BLOCKS_2 = 2 } rmt_reserve_memsize_t;
+typedef union {
+  struct {
+    uint32_t duration0 : 15;
+    uint32_t level0 : 1;
+    uint32_t duration1 : 15;
+    uint32_t level1 : 1;
+  };
+  uint32_t val;
+} rmt_data_t;
+
+bool rmtInit(int pin, rmt_ch_dir_t dir, rmt_reserve_memsize_t mem, uint32_t freqHz);
+bool rmtSetEOT(int pin, uint8_t level);
+bool rmtWriteAsync(int pin, rmt_data_t* data, size_t numSymbols);
+bool rmtTransmitCompleted(int pin);
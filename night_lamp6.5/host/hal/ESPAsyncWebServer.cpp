@@ -0,0 +1,542 @@
+#include <ESPAsyncWebServer.h>
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <thread>
+
+#include "host_hal.h"
+
+// A connection's answer, for requests answered after their handler returned
+struct HostHttpConnection {
+  std::mutex              lock;
+  std::condition_variable cv;
+  bool                    ready = false;
+  std::string             out;
+
+  void respond(const AsyncWebServerResponse& res) {
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      out   = res.serialize();
+      ready = true;
+    }
+    cv.notify_all();
+  }
+};
+
+namespace {
+std::atomic<uint16_t> boundPort{ 0 };
+
+const size_t HEAD_MAX  = 8192;
+const size_t BODY_MAX  = 65536;
+const size_t BODY_CHUNK = 1436;  // one TCP segment, as the library sees it
+
+const char* reasonPhrase(int code) {
+  switch (code) {
+    case 200: return "OK";
+    case 204: return "No Content";
+    case 304: return "Not Modified";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 413: return "Payload Too Large";
+    case 500: return "Internal Server Error";
+    case 503: return "Service Unavailable";
+    default:  return "";
+  }
+}
+
+int hexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+std::string urlDecode(const std::string& s) {
+  std::string out;
+  for (size_t i = 0; i < s.size(); i++) {
+    if (s[i] == '+') {
+      out += ' ';
+    } else if (s[i] == '%' && i + 2 < s.size() && hexValue(s[i + 1]) >= 0 && hexValue(s[i + 2]) >= 0) {
+      out += (char)(hexValue(s[i + 1]) * 16 + hexValue(s[i + 2]));
+      i += 2;
+    } else {
+      out += s[i];
+    }
+  }
+  return out;
+}
+
+void parseParams(const std::string& s, std::vector<std::pair<String, String>>& out) {
+  size_t at = 0;
+  while (at < s.size()) {
+    size_t end = s.find('&', at);
+    if (end == std::string::npos) end = s.size();
+    std::string item = s.substr(at, end - at);
+    if (!item.empty()) {
+      size_t eq = item.find('=');
+      if (eq == std::string::npos) out.emplace_back(String(urlDecode(item)), String());
+      else out.emplace_back(String(urlDecode(item.substr(0, eq))), String(urlDecode(item.substr(eq + 1))));
+    }
+    at = end + 1;
+  }
+}
+
+WebRequestMethodComposite parseMethod(const std::string& m) {
+  if (m == "GET")     return HTTP_GET;
+  if (m == "POST")    return HTTP_POST;
+  if (m == "DELETE")  return HTTP_DELETE;
+  if (m == "PUT")     return HTTP_PUT;
+  if (m == "PATCH")   return HTTP_PATCH;
+  if (m == "HEAD")    return HTTP_HEAD;
+  if (m == "OPTIONS") return HTTP_OPTIONS;
+  return 0;
+}
+
+void sendAll(int fd, const std::string& data) {
+  size_t at = 0;
+  while (at < data.size()) {
+    ssize_t n = send(fd, data.data() + at, data.size() - at, MSG_NOSIGNAL);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return;
+    at += n;
+  }
+}
+
+bool peerClosed(int fd) {
+  pollfd p = { fd, POLLIN | POLLRDHUP, 0 };
+  if (poll(&p, 1, 0) <= 0) return false;
+  if (p.revents & (POLLRDHUP | POLLHUP | POLLERR)) return true;
+  char c;
+  return recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) == 0;
+}
+}  // namespace
+
+std::recursive_mutex& host::asyncTcpLock() {
+  static std::recursive_mutex lock;
+  return lock;
+}
+
+uint16_t host::httpPort() {
+  return boundPort.load();
+}
+
+// ---------------- Response ----------------
+bool AsyncWebServerResponse::addHeader(const char* name, const char* value, bool replaceExisting) {
+  for (auto& h : _headers) {
+    if (strcasecmp(h.first.c_str(), name) != 0) continue;
+    if (!replaceExisting) return false;
+    h.second = value;
+    return true;
+  }
+  _headers.emplace_back(name, value);
+  return true;
+}
+
+std::string AsyncWebServerResponse::serialize() const {
+  bool noBody = _code == 204 || _code == 304 || (_code >= 100 && _code < 200);
+  std::string out = "HTTP/1.1 " + std::to_string(_code) + " " + reasonPhrase(_code) + "\r\n";
+  if (!noBody) {
+    if (!_contentType.empty()) out += "Content-Type: " + _contentType + "\r\n";
+    out += "Content-Length: " + std::to_string(_body.size()) + "\r\n";
+  }
+  out += "Connection: close\r\n";
+  for (const auto& h : DefaultHeaders::Instance().headers()) out += h.first + ": " + h.second + "\r\n";
+  for (const auto& h : _headers) out += h.first + ": " + h.second + "\r\n";
+  out += "\r\n";
+  if (!noBody) out += _body;
+  return out;
+}
+
+DefaultHeaders& DefaultHeaders::Instance() {
+  static DefaultHeaders instance;
+  return instance;
+}
+
+void DefaultHeaders::addHeader(const char* name, const char* value) {
+  _headers.emplace_back(name, value);
+}
+
+// ---------------- Request ----------------
+AsyncWebServerRequest::~AsyncWebServerRequest() {
+  delete _response;
+  free(_tempObject);
+}
+
+bool AsyncWebServerRequest::hasArg(const char* name) const {
+  for (const auto& p : _params) {
+    if (p.first == name) return true;
+  }
+  return false;
+}
+
+const String& AsyncWebServerRequest::arg(const char* name) const {
+  static const String empty;
+  for (const auto& p : _params) {
+    if (p.first == name) return p.second;
+  }
+  return empty;
+}
+
+bool AsyncWebServerRequest::hasParam(const char* name, bool) const {
+  return hasArg(name);
+}
+
+bool AsyncWebServerRequest::hasHeader(const char* name) const {
+  for (const auto& h : _headers) {
+    if (strcasecmp(h.first.c_str(), name) == 0) return true;
+  }
+  return false;
+}
+
+const String& AsyncWebServerRequest::header(const char* name) const {
+  static const String empty;
+  for (const auto& h : _headers) {
+    if (strcasecmp(h.first.c_str(), name) == 0) return h.second;
+  }
+  return empty;
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(int code, const char* contentType, const char* content) {
+  AsyncWebServerResponse* res = new AsyncWebServerResponse(code, contentType);
+  res->_body = content ? content : "";
+  return res;
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(int code, const char* contentType,
+                                                             const uint8_t* content, size_t len) {
+  AsyncWebServerResponse* res = new AsyncWebServerResponse(code, contentType);
+  res->_body.assign((const char*)content, len);
+  return res;
+}
+
+AsyncResponseStream* AsyncWebServerRequest::beginResponseStream(const char* contentType, size_t bufferSize) {
+  return new AsyncResponseStream(contentType, bufferSize);
+}
+
+void AsyncWebServerRequest::send(AsyncWebServerResponse* response) {
+  if (!response) return;
+  if (_response) {
+    delete response;
+    return;
+  }
+  _response = response;
+  if (_paused && _conn) _conn->respond(*_response);
+}
+
+AsyncWebServerRequestPtr AsyncWebServerRequest::pause() {
+  _paused = true;
+  return _self;
+}
+
+// ---------------- Handlers ----------------
+bool AsyncCallbackWebHandler::canHandle(const AsyncWebServerRequest* request) const {
+  if (!(method & request->method())) return false;
+  const std::string& url = request->url().str();
+  if (uri.empty() || url == uri) return true;
+  return url.size() > uri.size() && url.compare(0, uri.size(), uri) == 0 && url[uri.size()] == '/';
+}
+
+void AsyncCallbackWebHandler::handleRequest(AsyncWebServerRequest* request) {
+  if (onRequest) onRequest(request);
+  else request->send(500);
+}
+
+void AsyncCallbackWebHandler::handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t len,
+                                         size_t index, size_t total) {
+  if (onBody) onBody(request, data, len, index, total);
+}
+
+// ---------------- Server ----------------
+AsyncWebServer::~AsyncWebServer() {
+  end();
+  for (AsyncWebHandler* h : _owned) delete h;
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char* uri, WebRequestMethodComposite method,
+                                            ArRequestHandlerFunction onRequest) {
+  return on(uri, method, onRequest, nullptr, nullptr);
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char* uri, WebRequestMethodComposite method,
+                                            ArRequestHandlerFunction onRequest, ArUploadHandlerFunction,
+                                            ArBodyHandlerFunction onBody) {
+  AsyncCallbackWebHandler* h = new AsyncCallbackWebHandler;
+  h->uri       = uri;
+  h->method    = method;
+  h->onRequest = onRequest;
+  h->onBody    = onBody;
+  _owned.push_back(h);
+  addHandler(h);
+  return *h;
+}
+
+AsyncWebHandler& AsyncWebServer::addHandler(AsyncWebHandler* handler) {
+  std::lock_guard<std::recursive_mutex> lock(host::asyncTcpLock());
+  _handlers.push_back(handler);
+  return *handler;
+}
+
+AsyncWebHandler* AsyncWebServer::findHandler(const AsyncWebServerRequest* request) const {
+  for (AsyncWebHandler* h : _handlers) {
+    if (h->canHandle(request)) return h;
+  }
+  return nullptr;
+}
+
+void AsyncWebServer::begin() {
+  if (_listenFd >= 0) return;
+  const char* env  = getenv("LAMP_HTTP_PORT");
+  uint16_t    port = env ? (uint16_t)atoi(env) : 8080;
+
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  int on = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+  sockaddr_in addr = {};
+  addr.sin_family      = AF_INET;
+  addr.sin_port        = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (fd < 0 || bind(fd, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(fd, 64) < 0) {
+    fprintf(stderr, "AsyncWebServer: cannot listen on 127.0.0.1:%u (port %u on the device): %s\n",
+            port, _port, strerror(errno));
+    if (fd >= 0) close(fd);
+    return;
+  }
+  socklen_t len = sizeof(addr);
+  getsockname(fd, (sockaddr*)&addr, &len);
+  _listenFd = fd;
+  boundPort = ntohs(addr.sin_port);
+  std::thread(&AsyncWebServer::acceptLoop, this).detach();
+}
+
+void AsyncWebServer::end() {
+  if (_listenFd < 0) return;
+  int fd    = _listenFd;
+  _listenFd = -1;
+  boundPort = 0;
+  shutdown(fd, SHUT_RDWR);
+  close(fd);
+}
+
+void AsyncWebServer::acceptLoop() {
+  for (;;) {
+    int listenFd = _listenFd;
+    if (listenFd < 0) return;
+    int fd = accept(listenFd, nullptr, nullptr);
+    if (fd < 0) {
+      if (errno == EINTR || errno == ECONNABORTED) continue;
+      return;
+    }
+    std::thread(&AsyncWebServer::serve, this, fd).detach();
+  }
+}
+
+// One request per connection: parse, run the handler under the async_tcp
+// lock, write the response (waiting for it if the request was paused)
+void AsyncWebServer::serve(int fd) {
+  std::string in;
+  char        buf[2048];
+  size_t      headEnd;
+  while ((headEnd = in.find("\r\n\r\n")) == std::string::npos) {
+    ssize_t n = recv(fd, buf, sizeof(buf), 0);
+    if (n <= 0 || in.size() > HEAD_MAX) {
+      close(fd);
+      return;
+    }
+    in.append(buf, n);
+  }
+
+  std::shared_ptr<AsyncWebServerRequest> request(new AsyncWebServerRequest);
+  std::shared_ptr<HostHttpConnection>    conn = std::make_shared<HostHttpConnection>();
+  request->_self = request;
+  request->_conn = conn;
+
+  // Request line and headers
+  size_t      lineEnd = in.find("\r\n");
+  std::string line    = in.substr(0, lineEnd);
+  size_t      sp1 = line.find(' ');
+  size_t      sp2 = line.find(' ', sp1 + 1);
+  request->_method = sp1 == std::string::npos ? 0 : parseMethod(line.substr(0, sp1));
+  std::string target = sp2 == std::string::npos ? "" : line.substr(sp1 + 1, sp2 - sp1 - 1);
+  if (!request->_method || target.empty() || target[0] != '/') {
+    sendAll(fd, AsyncWebServerResponse(400, "text/plain").serialize());
+    close(fd);
+    return;
+  }
+  size_t q = target.find('?');
+  request->_url = String(urlDecode(target.substr(0, q)));
+  if (q != std::string::npos) parseParams(target.substr(q + 1), request->_params);
+
+  for (size_t at = lineEnd + 2; at < headEnd;) {
+    size_t end   = in.find("\r\n", at);
+    size_t colon = in.find(':', at);
+    if (colon != std::string::npos && colon < end) {
+      std::string name  = in.substr(at, colon - at);
+      std::string value = in.substr(colon + 1, end - colon - 1);
+      size_t      first = value.find_first_not_of(" \t");
+      value = first == std::string::npos ? "" : value.substr(first);
+      request->_headers.emplace_back(String(name), String(value));
+    }
+    at = end + 2;
+  }
+  request->_contentType   = request->header("Content-Type");
+  request->_contentLength = strtoul(request->header("Content-Length").c_str(), nullptr, 10);
+
+  // Body
+  std::string body = in.substr(headEnd + 4);
+  if (request->_contentLength > BODY_MAX) {
+    sendAll(fd, AsyncWebServerResponse(413, "text/plain").serialize());
+    close(fd);
+    return;
+  }
+  while (body.size() < request->_contentLength) {
+    ssize_t n = recv(fd, buf, sizeof(buf), 0);
+    if (n <= 0) {
+      close(fd);
+      return;
+    }
+    body.append(buf, n);
+  }
+  body.resize(request->_contentLength);
+  bool form = request->_contentType.startsWith("application/x-www-form-urlencoded");
+  if (form) parseParams(body, request->_params);
+
+  std::string out;
+  {
+    std::lock_guard<std::recursive_mutex> lock(host::asyncTcpLock());
+    AsyncWebHandler* h = findHandler(request.get());
+    if (h && !form) {
+      for (size_t at = 0; at < body.size(); at += BODY_CHUNK) {
+        size_t n = std::min(BODY_CHUNK, body.size() - at);
+        h->handleBody(request.get(), (uint8_t*)&body[at], n, at, body.size());
+      }
+    }
+    if (h)              h->handleRequest(request.get());
+    else if (_notFound) _notFound(request.get());
+    else                request->send(404);
+
+    if (!request->_paused) {
+      if (!request->_response) request->send(500);
+      out = request->_response->serialize();
+    }
+  }
+
+  if (request->_paused) {
+    std::unique_lock<std::mutex> lock(conn->lock);
+    while (!conn->ready && !peerClosed(fd)) {
+      conn->cv.wait_for(lock, std::chrono::milliseconds(20));
+    }
+    if (conn->ready) out = conn->out;
+  }
+  if (!out.empty()) sendAll(fd, out);
+  shutdown(fd, SHUT_WR);
+  close(fd);
+  // Expires the pause() pointers; whoever still holds one frees the request
+  request.reset();
+}
+
+// ---------------- WebSocket ----------------
+AsyncWebSocket::~AsyncWebSocket() {
+  for (AsyncWebSocketClient* c : _clients) delete c;
+}
+
+void AsyncWebSocketClient::text(const char* message, size_t len) {
+  _server->record(this, message, len);
+}
+
+void AsyncWebSocketClient::binary(const uint8_t* message, size_t len) {
+  _server->record(this, (const char*)message, len);
+}
+
+void AsyncWebSocket::record(AsyncWebSocketClient* client, const char* data, size_t len) {
+  std::lock_guard<std::recursive_mutex> lock(_lock);
+  client->_sent.emplace_back(data, len);
+}
+
+size_t AsyncWebSocket::count() const {
+  std::lock_guard<std::recursive_mutex> lock(_lock);
+  return _clients.size();
+}
+
+void AsyncWebSocket::textAll(const char* message, size_t len) {
+  std::lock_guard<std::recursive_mutex> lock(_lock);
+  for (AsyncWebSocketClient* c : _clients) record(c, message, len);
+}
+
+void AsyncWebSocket::binaryAll(const uint8_t* message, size_t len) {
+  textAll((const char*)message, len);
+}
+
+// Closes the oldest clients beyond maxClients
+void AsyncWebSocket::cleanupClients(uint16_t maxClients) {
+  std::lock_guard<std::recursive_mutex> lock(_lock);
+  while (_clients.size() > maxClients) {
+    delete _clients.front();
+    _clients.erase(_clients.begin());
+  }
+}
+
+AsyncWebSocketClient* AsyncWebSocket::find(uint32_t id) {
+  std::lock_guard<std::recursive_mutex> lock(_lock);
+  for (AsyncWebSocketClient* c : _clients) {
+    if (c->_id == id) return c;
+  }
+  return nullptr;
+}
+
+uint32_t AsyncWebSocket::hostConnect() {
+  AsyncWebSocketClient* c;
+  {
+    std::lock_guard<std::recursive_mutex> lock(_lock);
+    c = new AsyncWebSocketClient(_nextId++, this);
+    _clients.push_back(c);
+  }
+  std::lock_guard<std::recursive_mutex> tcp(host::asyncTcpLock());
+  if (_handler) _handler(this, c, WS_EVT_CONNECT, nullptr, nullptr, 0);
+  return c->_id;
+}
+
+void AsyncWebSocket::hostDisconnect(uint32_t id) {
+  AsyncWebSocketClient* c = find(id);
+  if (!c) return;
+  {
+    std::lock_guard<std::recursive_mutex> tcp(host::asyncTcpLock());
+    if (_handler) _handler(this, c, WS_EVT_DISCONNECT, nullptr, nullptr, 0);
+  }
+  std::lock_guard<std::recursive_mutex> lock(_lock);
+  for (size_t i = 0; i < _clients.size(); i++) {
+    if (_clients[i] != c) continue;
+    _clients.erase(_clients.begin() + i);
+    delete c;
+    break;
+  }
+}
+
+bool AsyncWebSocket::hostReceive(uint32_t id, const uint8_t* data, size_t len, uint8_t opcode) {
+  AsyncWebSocketClient* c = find(id);
+  if (!c) return false;
+  std::vector<uint8_t> frame(data, data + len);
+  AwsFrameInfo info = {};
+  info.message_opcode = opcode;
+  info.final          = 1;
+  info.masked         = 1;
+  info.opcode         = opcode;
+  info.len            = len;
+  std::lock_guard<std::recursive_mutex> tcp(host::asyncTcpLock());
+  if (_handler) _handler(this, c, WS_EVT_DATA, &info, frame.data(), len);
+  return true;
+}
+
+std::vector<std::string> AsyncWebSocket::hostTakeSent(uint32_t id) {
+  std::vector<std::string> out;
+  std::lock_guard<std::recursive_mutex> lock(_lock);
+  if (AsyncWebSocketClient* c = find(id)) out.swap(c->_sent);
+  return out;
+}
@@ -0,0 +1,284 @@
+#pragma once
+// ESPAsyncWebServer (ESP32Async) on a real localhost socket.
+//
+// Behaves like the library where the sketch depends on it:
+//   - handlers match by exact URI or "<uri>/..." prefix, in registration
+//     order, with onNotFound() last
+//   - one handler runs at a time (the library runs them all on the
+//     async_tcp task); host::asyncTcpLock() is that task's lock
+//   - a POST body goes to the body callback before the request handler;
+//     form bodies become arguments instead
+//   - the response is written after the handler returns, so it can still
+//     be changed through getResponse()
+//   - pause() returns a weak_ptr that expires when the client hangs up;
+//     a paused request is answered whenever send() is called on it
+//   - request, response and body buffers are heap objects freed with the
+//     request (_tempObject with free())
+// The port is LAMP_HTTP_PORT from the environment (default 8080, 0 picks
+// a free one; see host::httpPort()). Every response closes the connection.
+//
+// The WebSocket has no socket behind it: tests connect virtual clients,
+// send them frames and read what the sketch pushed (the host* members).
+#include <Arduino.h>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+typedef enum {
+  HTTP_GET     = 0b00000001,
+  HTTP_POST    = 0b00000010,
+  HTTP_DELETE  = 0b00000100,
+  HTTP_PUT     = 0b00001000,
+  HTTP_PATCH   = 0b00010000,
+  HTTP_HEAD    = 0b00100000,
+  HTTP_OPTIONS = 0b01000000,
+  HTTP_ANY     = 0b01111111,
+} WebRequestMethod;
+typedef uint8_t WebRequestMethodComposite;
+
+class AsyncWebServerRequest;
+class AsyncWebServer;
+struct HostHttpConnection;
+
+using AsyncWebServerRequestPtr = std::weak_ptr<AsyncWebServerRequest>;
+typedef std::function<void(AsyncWebServerRequest*)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest*, const String&, size_t, uint8_t*, size_t, bool)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest*, uint8_t*, size_t, size_t, size_t)> ArBodyHandlerFunction;
+
+class AsyncWebServerResponse {
+ public:
+  AsyncWebServerResponse(int code, const char* contentType) : _code(code), _contentType(contentType) {}
+  virtual ~AsyncWebServerResponse() {}
+
+  void setCode(int code) { _code = code; }
+  void setContentType(const char* type) { _contentType = type; }
+  void setContentLength(size_t) {}  // always the body's length
+  bool addHeader(const char* name, const char* value, bool replaceExisting = true);
+  bool addHeader(const char* name, const String& value, bool replaceExisting = true) {
+    return addHeader(name, value.c_str(), replaceExisting);
+  }
+  int code() const { return _code; }
+
+  // Status line, headers and body as written to the socket
+  std::string serialize() const;
+
+ protected:
+  int         _code;
+  std::string _contentType;
+  std::string _body;
+  std::vector<std::pair<std::string, std::string>> _headers;
+
+  friend class AsyncWebServerRequest;
+};
+
+// Body grows as it is printed to, from bufferSize
+class AsyncResponseStream : public AsyncWebServerResponse, public Print {
+ public:
+  AsyncResponseStream(const char* contentType, size_t bufferSize)
+    : AsyncWebServerResponse(200, contentType) { _body.reserve(bufferSize); }
+  size_t write(uint8_t c) override { _body.push_back((char)c); return 1; }
+  size_t write(const uint8_t* data, size_t len) override {
+    _body.append((const char*)data, len);
+    return len;
+  }
+  using Print::write;
+};
+
+class AsyncWebServerRequest {
+ public:
+  ~AsyncWebServerRequest();
+
+  WebRequestMethodComposite method() const { return _method; }
+  const String& url() const { return _url; }
+  const String& contentType() const { return _contentType; }
+  size_t        contentLength() const { return _contentLength; }
+
+  // Query and form arguments
+  bool          hasArg(const char* name) const;
+  const String& arg(const char* name) const;
+  bool          hasParam(const char* name, bool post = false) const;
+
+  // Header names match case-insensitively
+  bool          hasHeader(const char* name) const;
+  const String& header(const char* name) const;
+
+  AsyncWebServerResponse* beginResponse(int code, const char* contentType = "", const char* content = "");
+  AsyncWebServerResponse* beginResponse(int code, const char* contentType, const String& content) {
+    return beginResponse(code, contentType, content.c_str());
+  }
+  AsyncWebServerResponse* beginResponse(int code, const char* contentType, const uint8_t* content, size_t len);
+  AsyncResponseStream*    beginResponseStream(const char* contentType, size_t bufferSize = 1460);
+
+  // The first response sent wins; later ones are deleted
+  void send(AsyncWebServerResponse* response);
+  void send(int code, const char* contentType = "", const char* content = "") {
+    send(beginResponse(code, contentType, content));
+  }
+  void send(int code, const char* contentType, const String& content) {
+    send(beginResponse(code, contentType, content.c_str()));
+  }
+
+  AsyncWebServerResponse*  getResponse() const { return _response; }
+  AsyncWebServerRequestPtr pause();
+  bool                     isPaused() const { return _paused; }
+
+  void* _tempObject = nullptr;
+
+ private:
+  AsyncWebServerRequest() {}
+
+  WebRequestMethodComposite _method = HTTP_GET;
+  String _url;
+  String _contentType;
+  size_t _contentLength = 0;
+  std::vector<std::pair<String, String>> _params;
+  std::vector<std::pair<String, String>> _headers;
+
+  AsyncWebServerResponse*               _response = nullptr;
+  bool                                  _paused   = false;
+  std::weak_ptr<AsyncWebServerRequest>  _self;
+  std::shared_ptr<HostHttpConnection>   _conn;
+
+  friend class AsyncWebServer;
+  friend struct HostHttpConnection;
+};
+
+class AsyncWebHandler {
+ public:
+  virtual ~AsyncWebHandler() {}
+  virtual bool canHandle(const AsyncWebServerRequest*) const { return false; }
+  virtual void handleRequest(AsyncWebServerRequest*) {}
+  virtual void handleBody(AsyncWebServerRequest*, uint8_t*, size_t, size_t, size_t) {}
+};
+
+class AsyncCallbackWebHandler : public AsyncWebHandler {
+ public:
+  bool canHandle(const AsyncWebServerRequest* request) const override;
+  void handleRequest(AsyncWebServerRequest* request) override;
+  void handleBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) override;
+
+ private:
+  std::string               uri;
+  WebRequestMethodComposite method = HTTP_ANY;
+  ArRequestHandlerFunction  onRequest;
+  ArBodyHandlerFunction     onBody;
+
+  friend class AsyncWebServer;
+};
+
+// ---- WebSocket ----
+typedef enum { WS_EVT_CONNECT, WS_EVT_DISCONNECT, WS_EVT_PING, WS_EVT_PONG, WS_EVT_ERROR, WS_EVT_DATA } AwsEventType;
+
+#define WS_CONTINUATION 0x00
+#define WS_TEXT         0x01
+#define WS_BINARY       0x02
+
+typedef struct {
+  uint8_t  message_opcode;
+  uint32_t num;
+  uint8_t  final;
+  uint8_t  masked;
+  uint8_t  opcode;
+  uint64_t len;
+  uint8_t  mask[4];
+  uint64_t index;
+} AwsFrameInfo;
+
+class AsyncWebSocket;
+
+class AsyncWebSocketClient {
+ public:
+  uint32_t        id() const { return _id; }
+  bool            canSend() const { return true; }
+  AsyncWebSocket* server() { return _server; }
+  void text(const char* message, size_t len);
+  void text(const char* message) { text(message, strlen(message)); }
+  void text(const String& message) { text(message.c_str(), message.length()); }
+  void binary(const uint8_t* message, size_t len);
+
+ private:
+  AsyncWebSocketClient(uint32_t id, AsyncWebSocket* server) : _id(id), _server(server) {}
+
+  uint32_t                 _id;
+  AsyncWebSocket*          _server;
+  std::vector<std::string> _sent;
+
+  friend class AsyncWebSocket;
+};
+
+typedef std::function<void(AsyncWebSocket*, AsyncWebSocketClient*, AwsEventType, void*, uint8_t*, size_t)> AwsEventHandler;
+
+class AsyncWebSocket : public AsyncWebHandler {
+ public:
+  explicit AsyncWebSocket(const char* url) : _url(url) {}
+  ~AsyncWebSocket();
+
+  const char* url() const { return _url.c_str(); }
+  void   onEvent(AwsEventHandler handler) { _handler = handler; }
+  size_t count() const;
+  void   textAll(const char* message, size_t len);
+  void   textAll(const String& message) { textAll(message.c_str(), message.length()); }
+  void   binaryAll(const uint8_t* message, size_t len);
+  bool   availableForWriteAll() { return true; }
+  void   cleanupClients(uint16_t maxClients = 8);
+
+  // ---- Host side: virtual clients ----
+  // Events run on the async_tcp lock, like the library's
+  uint32_t hostConnect();
+  void     hostDisconnect(uint32_t id);
+  bool     hostReceive(uint32_t id, const uint8_t* data, size_t len, uint8_t opcode = WS_BINARY);
+  // Messages the sketch sent to that client since the last call
+  std::vector<std::string> hostTakeSent(uint32_t id);
+
+ private:
+  AsyncWebSocketClient* find(uint32_t id);
+  void                  record(AsyncWebSocketClient* client, const char* data, size_t len);
+
+  std::string        _url;
+  AwsEventHandler    _handler;
+  std::vector<AsyncWebSocketClient*> _clients;
+  uint32_t           _nextId = 1;
+  mutable std::recursive_mutex _lock;
+
+  friend class AsyncWebSocketClient;
+};
+
+// ---- Server ----
+class AsyncWebServer {
+ public:
+  explicit AsyncWebServer(uint16_t port) : _port(port) {}
+  ~AsyncWebServer();
+
+  void begin();
+  void end();
+
+  AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest);
+  AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                              ArUploadHandlerFunction onUpload, ArBodyHandlerFunction onBody = nullptr);
+  AsyncWebHandler& addHandler(AsyncWebHandler* handler);
+  void             onNotFound(ArRequestHandlerFunction fn) { _notFound = fn; }
+
+ private:
+  void acceptLoop();
+  void serve(int fd);
+  AsyncWebHandler* findHandler(const AsyncWebServerRequest* request) const;
+
+  uint16_t _port;
+  int      _listenFd = -1;
+  std::vector<AsyncWebHandler*>  _handlers;
+  std::vector<AsyncWebHandler*>  _owned;
+  ArRequestHandlerFunction       _notFound;
+};
+
+class DefaultHeaders {
+ public:
+  static DefaultHeaders& Instance();
+  void addHeader(const char* name, const char* value);
+  const std::vector<std::pair<std::string, std::string>>& headers() const { return _headers; }
+
+ private:
+  std::vector<std::pair<std::string, std::string>> _headers;
+};
@@ -0,0 +1,128 @@
+#include <Arduino.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+#include "host_hal.h"
+
+// ---------------- Tasks ----------------
+namespace {
+struct HostTask {
+  std::mutex              lock;
+  std::condition_variable cv;
+  uint32_t                notified = 0;
+};
+
+thread_local HostTask* currentTask = nullptr;
+
+std::mutex            heldLock;
+std::set<std::string> heldTasks;
+}  // namespace
+
+void host::holdTask(const char* name) {
+  std::lock_guard<std::mutex> lock(heldLock);
+  heldTasks.insert(name);
+}
+
+// Threads not made by xTaskCreate (main, test drivers) get a task on first use
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+  if (!currentTask) currentTask = new HostTask;
+  return currentTask;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t, void* arg,
+                       UBaseType_t, TaskHandle_t* handle) {
+  HostTask* task = new HostTask;
+  if (handle) *handle = task;
+  {
+    std::lock_guard<std::mutex> lock(heldLock);
+    if (heldTasks.count(name ? name : "")) return pdPASS;
+  }
+  std::thread([fn, arg, task] {
+    currentTask = task;
+    fn(arg);
+  }).detach();
+  return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stackDepth, void* arg,
+                                   UBaseType_t priority, TaskHandle_t* handle, BaseType_t) {
+  return xTaskCreate(fn, name, stackDepth, arg, priority, handle);
+}
+
+TickType_t xTaskGetTickCount() { return millis(); }
+
+void vTaskDelay(TickType_t ticks) { delay(ticks); }
+
+void vTaskDelayUntil(TickType_t* previousWake, TickType_t increment) {
+  *previousWake += increment;
+  int32_t waitMs = (int32_t)(*previousWake - xTaskGetTickCount());
+  if (waitMs > 0) delay(waitMs);
+}
+
+BaseType_t xTaskDelayUntil(TickType_t* previousWake, TickType_t increment) {
+  TickType_t due = *previousWake + increment;
+  bool       late = (int32_t)(due - xTaskGetTickCount()) <= 0;
+  vTaskDelayUntil(previousWake, increment);
+  return late ? pdFALSE : pdTRUE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait) {
+  HostTask* task = (HostTask*)xTaskGetCurrentTaskHandle();
+  std::unique_lock<std::mutex> lock(task->lock);
+  if (ticksToWait == portMAX_DELAY) {
+    task->cv.wait(lock, [task] { return task->notified > 0; });
+  } else {
+    task->cv.wait_for(lock, std::chrono::milliseconds(ticksToWait), [task] { return task->notified > 0; });
+  }
+  uint32_t value = task->notified;
+  if (value) task->notified = clearOnExit ? 0 : value - 1;
+  return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t handle) {
+  HostTask* task = (HostTask*)handle;
+  if (!task) return pdFAIL;
+  {
+    std::lock_guard<std::mutex> lock(task->lock);
+    task->notified++;
+  }
+  task->cv.notify_one();
+  return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t handle, BaseType_t* higherPriorityTaskWoken) {
+  xTaskNotifyGive(handle);
+  if (higherPriorityTaskWoken) *higherPriorityTaskWoken = pdFALSE;
+}
+
+// ---------------- Semaphores ----------------
+// Both kinds are recursive here; a plain mutex is only ever taken once
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() { return new std::recursive_timed_mutex; }
+SemaphoreHandle_t xSemaphoreCreateMutex() { return new std::recursive_timed_mutex; }
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t sem, TickType_t ticksToWait) {
+  std::recursive_timed_mutex* m = (std::recursive_timed_mutex*)sem;
+  if (ticksToWait == portMAX_DELAY) {
+    m->lock();
+    return pdTRUE;
+  }
+  return m->try_lock_for(std::chrono::milliseconds(ticksToWait)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t sem) {
+  ((std::recursive_timed_mutex*)sem)->unlock();
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticksToWait) {
+  return xSemaphoreTakeRecursive(sem, ticksToWait);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+  return xSemaphoreGiveRecursive(sem);
+}
@@ -0,0 +1,97 @@
+#include <Preferences.h>
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "host_hal.h"
+
+namespace {
+typedef std::map<std::string, std::vector<uint8_t>> NvsNamespace;
+
+std::mutex                          nvsLock;
+std::map<std::string, NvsNamespace> nvs;
+int                                 nvsFailWrites = 0;
+uint32_t                            nvsWrites     = 0;
+
+const size_t NVS_KEY_MAX = 15;  // like NVS
+}  // namespace
+
+bool Preferences::begin(const char* name, bool ro) {
+  if (open || !name || !*name || strlen(name) > NVS_KEY_MAX) return false;
+  ns       = name;
+  readOnly = ro;
+  open     = true;
+  return true;
+}
+
+void Preferences::end() {
+  open = false;
+}
+
+bool Preferences::clear() {
+  if (!open || readOnly) return false;
+  std::lock_guard<std::mutex> lock(nvsLock);
+  nvs[ns].clear();
+  return true;
+}
+
+bool Preferences::remove(const char* key) {
+  if (!open || readOnly || !key) return false;
+  std::lock_guard<std::mutex> lock(nvsLock);
+  return nvs[ns].erase(key) != 0;
+}
+
+bool Preferences::isKey(const char* key) {
+  if (!open || !key) return false;
+  std::lock_guard<std::mutex> lock(nvsLock);
+  return nvs[ns].count(key) != 0;
+}
+
+size_t Preferences::putValue(const char* key, const void* value, size_t len) {
+  if (!open || readOnly || !key || strlen(key) > NVS_KEY_MAX || !len) return 0;
+  std::lock_guard<std::mutex> lock(nvsLock);
+  if (nvsFailWrites > 0) {
+    nvsFailWrites--;
+    return 0;
+  }
+  const uint8_t* p = (const uint8_t*)value;
+  nvs[ns][key].assign(p, p + len);
+  nvsWrites++;
+  return len;
+}
+
+bool Preferences::readValue(const char* key, void* out, size_t len) {
+  if (!open || !key) return false;
+  std::lock_guard<std::mutex> lock(nvsLock);
+  auto it = nvs[ns].find(key);
+  if (it == nvs[ns].end() || it->second.size() != len) return false;
+  memcpy(out, it->second.data(), len);
+  return true;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+  if (!open || !key) return 0;
+  std::lock_guard<std::mutex> lock(nvsLock);
+  auto it = nvs[ns].find(key);
+  return it == nvs[ns].end() ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buf, size_t maxLen) {
+  if (!open || !key || !buf) return 0;
+  std::lock_guard<std::mutex> lock(nvsLock);
+  auto it = nvs[ns].find(key);
+  if (it == nvs[ns].end() || it->second.size() > maxLen) return 0;
+  memcpy(buf, it->second.data(), it->second.size());
+  return it->second.size();
+}
+
+void host::prefsFailWrites(int count) {
+  std::lock_guard<std::mutex> lock(nvsLock);
+  nvsFailWrites = count;
+}
+
+uint32_t host::prefsWrites() {
+  std::lock_guard<std::mutex> lock(nvsLock);
+  return nvsWrites;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <Arduino.h>
+
+// NVS in RAM: namespaces of typed keys, shared by every Preferences
+// object for the life of the process. host::prefsFailWrites() makes the
+// next writes fail like a full or worn-out partition would.
+class Preferences {
+ public:
+  bool begin(const char* name, bool readOnly = false);
+  void end();
+  bool clear();
+  bool remove(const char* key);
+  bool isKey(const char* key);
+
+  size_t putBool(const char* key, bool value)         { return putValue(key, &value, sizeof(value)); }
+  size_t putUChar(const char* key, uint8_t value)     { return putValue(key, &value, sizeof(value)); }
+  size_t putUShort(const char* key, uint16_t value)   { return putValue(key, &value, sizeof(value)); }
+  size_t putInt(const char* key, int32_t value)       { return putValue(key, &value, sizeof(value)); }
+  size_t putUInt(const char* key, uint32_t value)     { return putValue(key, &value, sizeof(value)); }
+  size_t putULong(const char* key, uint32_t value)    { return putValue(key, &value, sizeof(value)); }
+  size_t putBytes(const char* key, const void* value, size_t len) { return putValue(key, value, len); }
+
+  bool     getBool(const char* key, bool def = false)          { return getValue(key, def); }
+  uint8_t  getUChar(const char* key, uint8_t def = 0)          { return getValue(key, def); }
+  uint16_t getUShort(const char* key, uint16_t def = 0)        { return getValue(key, def); }
+  int32_t  getInt(const char* key, int32_t def = 0)            { return getValue(key, def); }
+  uint32_t getUInt(const char* key, uint32_t def = 0)          { return getValue(key, def); }
+  uint32_t getULong(const char* key, uint32_t def = 0)         { return getValue(key, def); }
+  size_t   getBytesLength(const char* key);
+  size_t   getBytes(const char* key, void* buf, size_t maxLen);
+
+ private:
+  size_t putValue(const char* key, const void* value, size_t len);
+  bool   readValue(const char* key, void* out, size_t len);
+
+  template <typename T>
+  T getValue(const char* key, T def) {
+    T v;
+    return readValue(key, &v, sizeof(v)) ? v : def;
+  }
+
+  std::string ns;
+  bool        open     = false;
+  bool        readOnly = false;
+};
@@ -0,0 +1,11 @@
+#pragma once
+#include <Arduino.h>
+
+// SoftAP only; the host's "AP" is the loopback interface
+class WiFiClass {
+ public:
+  bool      softAP(const char* ssid, const char* passphrase = nullptr);
+  IPAddress softAPIP() { return IPAddress(127, 0, 0, 1); }
+  uint8_t   softAPgetStationNum() { return 0; }
+};
+extern WiFiClass WiFi;
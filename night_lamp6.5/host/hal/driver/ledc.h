@@ -0,0 +1,8 @@
+#pragma once
+#include <stdint.h>
+
+typedef enum { LEDC_LOW_SPEED_MODE = 0 } ledc_mode_t;
+typedef enum { LEDC_CHANNEL_0 = 0, LEDC_CHANNEL_1, LEDC_CHANNEL_2, LEDC_CHANNEL_3 } ledc_channel_t;
+typedef int esp_err_t;
+
+esp_err_t ledc_fade_stop(ledc_mode_t mode, ledc_channel_t channel);
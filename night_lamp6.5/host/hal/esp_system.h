@@ -0,0 +1,13 @@
+#pragma once
+#include <stdint.h>
+
+typedef int esp_err_t;
+#define ESP_OK   0
+#define ESP_FAIL -1
+
+typedef void (*shutdown_handler_t)(void);
+
+// Handlers run on esp_restart() / ESP.restart(), then the process exits
+esp_err_t esp_register_shutdown_handler(shutdown_handler_t handler);
+void      esp_restart();
+uint32_t  esp_random();
@@ -0,0 +1,32 @@
+#pragma once
+// FreeRTOS as far as the sketch uses it, on std::thread. A task is a
+// detached thread with its own notification counter; ticks are ms.
+// "Interrupts" are one global recursive lock: ISRs (see host::setPin) run
+// under it, noInterrupts() and critical sections take it.
+#include <stdint.h>
+
+typedef void*    TaskHandle_t;
+typedef void*    SemaphoreHandle_t;
+typedef uint32_t TickType_t;
+typedef int      BaseType_t;
+typedef unsigned UBaseType_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define portMAX_DELAY      0xFFFFFFFFu
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms)  ((TickType_t)(ms))
+#define pdTRUE  1
+#define pdFALSE 0
+#define pdPASS  1
+#define pdFAIL  0
+
+typedef struct { int unused; } portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED { 0 }
+
+void portENTER_CRITICAL(portMUX_TYPE* mux);
+void portEXIT_CRITICAL(portMUX_TYPE* mux);
+#define portENTER_CRITICAL_ISR(mux) portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux)  portEXIT_CRITICAL(mux)
+inline void portYIELD_FROM_ISR(BaseType_t = 0) {}
+
+int64_t esp_timer_get_time();
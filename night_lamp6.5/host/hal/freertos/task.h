@@ -0,0 +1,17 @@
+#pragma once
+#include "FreeRTOS.h"
+
+BaseType_t   xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stackDepth, void* arg,
+                         UBaseType_t priority, TaskHandle_t* handle);
+BaseType_t   xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stackDepth, void* arg,
+                                     UBaseType_t priority, TaskHandle_t* handle, BaseType_t core);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+
+void       vTaskDelay(TickType_t ticks);
+void       vTaskDelayUntil(TickType_t* previousWake, TickType_t increment);
+BaseType_t xTaskDelayUntil(TickType_t* previousWake, TickType_t increment);
+TickType_t xTaskGetTickCount();
+
+uint32_t   ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void       vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higherPriorityTaskWoken);
@@ -0,0 +1,15 @@
+#pragma once
+// Shared between the HAL sources; not for the sketch or tests
+#include <stdint.h>
+#include <stddef.h>
+#include <mutex>
+
+namespace host {
+
+// "Interrupts disabled": ISRs, noInterrupts(), critical sections
+std::recursive_mutex& interruptLock();
+
+uint64_t uptimeUs();
+void     recordPixelFrame(const uint8_t* bytes, size_t len);
+
+}  // namespace host
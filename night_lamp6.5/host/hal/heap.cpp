@@ -0,0 +1,64 @@
+// Heap accounting: the global operator new/delete, counted against a
+// notional heap of host::HEAP_BYTES for ESP.getFreeHeap() and friends.
+// In a file of their own, so they are never inlined where a delete meets
+// the new it pairs with (GCC then sees malloc()/free() against new/delete).
+#include <Arduino.h>
+
+#include <malloc.h>
+#include <atomic>
+#include <new>
+
+#include "host_hal.h"
+
+namespace {
+std::atomic<size_t>   heapLive{ 0 };
+std::atomic<size_t>   heapPeak{ 0 };
+std::atomic<uint64_t> heapAllocCount{ 0 };
+thread_local uint64_t threadAllocCount = 0;
+
+// Bookkeeping only; the operators below do their own malloc() and free()
+void* heapCount(void* p) {
+  if (!p) return nullptr;
+  size_t size = malloc_usable_size(p);
+  size_t live = heapLive.fetch_add(size) + size;
+  size_t peak = heapPeak.load();
+  while (live > peak && !heapPeak.compare_exchange_weak(peak, live)) {}
+  heapAllocCount++;
+  threadAllocCount++;
+  return p;
+}
+
+void heapUncount(void* p) {
+  if (p) heapLive.fetch_sub(malloc_usable_size(p));
+}
+}  // namespace
+
+void* operator new(size_t n, const std::nothrow_t&) noexcept { return heapCount(malloc(n ? n : 1)); }
+void* operator new[](size_t n, const std::nothrow_t&) noexcept { return heapCount(malloc(n ? n : 1)); }
+void* operator new(size_t n) {
+  void* p = heapCount(malloc(n ? n : 1));
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+void* operator new[](size_t n) { return operator new(n); }
+void  operator delete(void* p) noexcept {
+  heapUncount(p);
+  free(p);
+}
+void  operator delete[](void* p) noexcept { operator delete(p); }
+void  operator delete(void* p, size_t) noexcept { operator delete(p); }
+void  operator delete[](void* p, size_t) noexcept { operator delete(p); }
+void  operator delete(void* p, const std::nothrow_t&) noexcept { operator delete(p); }
+void  operator delete[](void* p, const std::nothrow_t&) noexcept { operator delete(p); }
+
+size_t   host::heapUsed() { return heapLive.load(); }
+uint64_t host::heapAllocs() { return heapAllocCount.load(); }
+uint64_t host::threadHeapAllocs() { return threadAllocCount; }
+
+static uint32_t heapFreeOf(size_t used) {
+  return used >= host::HEAP_BYTES ? 0 : (uint32_t)(host::HEAP_BYTES - used);
+}
+
+uint32_t EspClass::getHeapSize()    { return (uint32_t)host::HEAP_BYTES; }
+uint32_t EspClass::getFreeHeap()    { return heapFreeOf(heapLive.load()); }
+uint32_t EspClass::getMinFreeHeap() { return heapFreeOf(heapPeak.load()); }
@@ -0,0 +1,62 @@
+#pragma once
+// Test side of the host HAL: drive inputs and read back what the sketch
+// did to the hardware. Everything here is thread-safe.
+#include <stdint.h>
+#include <stddef.h>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace host {
+
+// ---- GPIO ----
+// Sets an input; an ISR attached for that edge runs on the calling thread
+// with "interrupts" disabled
+void setPin(uint8_t pin, int level);
+int  pinLevel(uint8_t pin);
+
+// ---- LEDC ----
+struct LedcFade {
+  uint32_t atUs;
+  uint8_t  pin;
+  uint32_t fromDuty;
+  uint32_t toDuty;
+  int      ms;
+};
+uint32_t              ledcDuty(uint8_t pin);  // last duty written, or the target of the last fade
+std::vector<LedcFade> takeLedcFades();        // fades started since the last call
+uint32_t              ledcFadeStops();
+
+// ---- Pixels ----
+// Frames decoded from the RMT symbols (or Adafruit_NeoPixel::show()), in
+// wire order (GRB for the ring). The last 4096 are kept.
+struct PixelFrame {
+  uint32_t             atUs;
+  std::vector<uint8_t> bytes;
+};
+uint32_t                pixelFrameCount();
+PixelFrame              lastPixelFrame();
+std::vector<PixelFrame> takePixelFrames();
+
+// ---- NVS ----
+void     prefsFailWrites(int count);  // the next count writes fail
+uint32_t prefsWrites();               // writes that stored something
+
+// ---- Tasks ----
+// xTaskCreate() with this name creates nothing: the program does that
+// task's work itself (e.g. calls renderFrame() in step with a warped clock)
+void holdTask(const char* name);
+
+// ---- Web ----
+uint16_t             httpPort();      // 0 until server.begin()
+std::recursive_mutex& asyncTcpLock(); // held while a web handler runs
+
+// ---- Heap ----
+// Counts of operator new/delete, which is what ESP.getFreeHeap() and
+// getMinFreeHeap() report against a heap of HEAP_BYTES
+const size_t HEAP_BYTES = 4u << 20;
+size_t   heapUsed();
+uint64_t heapAllocs();        // allocations so far, all threads
+uint64_t threadHeapAllocs();  // allocations so far by the calling thread
+
+}  // namespace host
@@ -0,0 +1,152 @@
+// LEDC and RMT: record what the sketch puts on the pins
+#include <Arduino.h>
+#include <driver/ledc.h>
+
+#include <deque>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "hal_internal.h"
+#include "host_hal.h"
+
+// ---------------- LEDC ----------------
+namespace {
+std::mutex                     ledcLock;
+std::map<uint8_t, uint32_t>    ledcDuties;
+std::map<uint8_t, uint8_t>     ledcChannels;  // pin -> channel
+std::vector<host::LedcFade>    ledcFades;
+uint32_t                       ledcStops = 0;
+}  // namespace
+
+bool ledcAttachChannel(uint8_t pin, uint32_t, uint8_t, uint8_t channel) {
+  std::lock_guard<std::mutex> lock(ledcLock);
+  ledcChannels[pin] = channel;
+  ledcDuties[pin]   = 0;
+  return true;
+}
+
+bool ledcAttach(uint8_t pin, uint32_t freq, uint8_t resolution) {
+  return ledcAttachChannel(pin, freq, resolution, 0);
+}
+
+bool ledcWrite(uint8_t pin, uint32_t duty) {
+  std::lock_guard<std::mutex> lock(ledcLock);
+  if (!ledcChannels.count(pin)) return false;
+  ledcDuties[pin] = duty;
+  return true;
+}
+
+bool ledcFade(uint8_t pin, uint32_t startDuty, uint32_t targetDuty, int maxFadeTimeMs) {
+  std::lock_guard<std::mutex> lock(ledcLock);
+  if (!ledcChannels.count(pin)) return false;
+  ledcDuties[pin] = targetDuty;
+  ledcFades.push_back({ micros(), pin, startDuty, targetDuty, maxFadeTimeMs });
+  return true;
+}
+
+esp_err_t ledc_fade_stop(ledc_mode_t, ledc_channel_t) {
+  std::lock_guard<std::mutex> lock(ledcLock);
+  ledcStops++;
+  return 0;
+}
+
+uint32_t host::ledcDuty(uint8_t pin) {
+  std::lock_guard<std::mutex> lock(ledcLock);
+  auto it = ledcDuties.find(pin);
+  return it == ledcDuties.end() ? 0 : it->second;
+}
+
+std::vector<host::LedcFade> host::takeLedcFades() {
+  std::lock_guard<std::mutex> lock(ledcLock);
+  std::vector<LedcFade> out;
+  out.swap(ledcFades);
+  return out;
+}
+
+uint32_t host::ledcFadeStops() {
+  std::lock_guard<std::mutex> lock(ledcLock);
+  return ledcStops;
+}
+
+// ---------------- Pixel frames ----------------
+namespace {
+const size_t                 PIXEL_FRAMES_KEPT = 4096;
+std::mutex                   pixelLock;
+std::deque<host::PixelFrame> pixelFrames;
+uint32_t                     pixelFrameTotal = 0;
+}  // namespace
+
+void host::recordPixelFrame(const uint8_t* bytes, size_t len) {
+  PixelFrame f = { micros(), std::vector<uint8_t>(bytes, bytes + len) };
+  std::lock_guard<std::mutex> lock(pixelLock);
+  if (pixelFrames.size() == PIXEL_FRAMES_KEPT) pixelFrames.pop_front();
+  pixelFrames.push_back(std::move(f));
+  pixelFrameTotal++;
+}
+
+uint32_t host::pixelFrameCount() {
+  std::lock_guard<std::mutex> lock(pixelLock);
+  return pixelFrameTotal;
+}
+
+host::PixelFrame host::lastPixelFrame() {
+  std::lock_guard<std::mutex> lock(pixelLock);
+  return pixelFrames.empty() ? PixelFrame{ 0, {} } : pixelFrames.back();
+}
+
+std::vector<host::PixelFrame> host::takePixelFrames() {
+  std::lock_guard<std::mutex> lock(pixelLock);
+  std::vector<PixelFrame> out(pixelFrames.begin(), pixelFrames.end());
+  pixelFrames.clear();
+  return out;
+}
+
+// ---------------- RMT ----------------
+// A TX channel turns WS2812 symbols back into bytes (the high part is the
+// longer one for a 1) and is busy for as long as the bits take on the wire.
+namespace {
+struct RmtChannel {
+  uint32_t ticksPerUs;
+  uint64_t busyUntilUs;
+};
+std::mutex                 rmtLock;
+std::map<int, RmtChannel>  rmtChannels;
+}  // namespace
+
+bool rmtInit(int pin, rmt_ch_dir_t dir, rmt_reserve_memsize_t, uint32_t freqHz) {
+  if (dir != RMT_TX_MODE || freqHz < 1000000) return false;
+  std::lock_guard<std::mutex> lock(rmtLock);
+  rmtChannels[pin] = { freqHz / 1000000, 0 };
+  return true;
+}
+
+bool rmtSetEOT(int pin, uint8_t) {
+  std::lock_guard<std::mutex> lock(rmtLock);
+  return rmtChannels.count(pin) != 0;
+}
+
+bool rmtWriteAsync(int pin, rmt_data_t* data, size_t numSymbols) {
+  uint64_t wireTicks = 0;
+  std::vector<uint8_t> bytes((numSymbols + 7) / 8, 0);
+  for (size_t i = 0; i < numSymbols; i++) {
+    if (data[i].duration0 > data[i].duration1) bytes[i / 8] |= 0x80 >> (i % 8);
+    wireTicks += data[i].duration0 + data[i].duration1;
+  }
+  {
+    std::lock_guard<std::mutex> lock(rmtLock);
+    auto it = rmtChannels.find(pin);
+    if (it == rmtChannels.end()) return false;
+    uint64_t now = host::uptimeUs();
+    if (now < it->second.busyUntilUs) return false;
+    it->second.busyUntilUs = now + wireTicks / it->second.ticksPerUs;
+  }
+  host::recordPixelFrame(bytes.data(), bytes.size());
+  return true;
+}
+
+bool rmtTransmitCompleted(int pin) {
+  std::lock_guard<std::mutex> lock(rmtLock);
+  auto it = rmtChannels.find(pin);
+  return it == rmtChannels.end() || host::uptimeUs() >= it->second.busyUntilUs;
+}
@@ -0,0 +1,31 @@
+// /bench on the build machine: the same writeBench() cases, run natively
+// after setup() and printed to stdout as the JSON document /bench serves.
+// Cycles here are nanoseconds (cpuMhz 1000), so the numbers compare
+// between host builds, not with the lamp's.
+#include "sketch.h"
+#include "host_hal.h"
+
+#include <unistd.h>
+
+struct StdoutPrint : Print {
+  size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+  size_t write(const uint8_t* data, size_t len) override { return fwrite(data, 1, len, stdout); }
+};
+
+int main() {
+  setenv("LAMP_QUIET", "1", 1);     // stdout is for the document
+  setenv("LAMP_HTTP_PORT", "0", 1); // the server is not used
+  host::holdTask("render");
+  setup();
+
+  static char     buf[256];
+  StdoutPrint     out;
+  JsonWriter      w(buf, sizeof(buf), &out);
+  w.beginObject();
+  writeBench(w);  // takes the state lock where it needs it, as for /bench
+  w.endObject();
+  w.flush();
+  printf("\n");
+  fflush(stdout);
+  _exit(0);  // the loop and log tasks are still up
+}
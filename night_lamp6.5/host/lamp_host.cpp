@@ -0,0 +1,12 @@
+// The firmware as a Linux program: web UI and API on 127.0.0.1 (port
+// LAMP_HTTP_PORT, default 8080), log on stdout. Same setup() and loop()
+// as on the lamp; the render and log tasks are threads.
+#include "sketch.h"
+#include "host_hal.h"
+
+int main() {
+  setup();
+  printf("lamp: http://127.0.0.1:%u/\n", host::httpPort());
+  fflush(stdout);
+  for (;;) loop();
+}
@@ -0,0 +1,6 @@
+#pragma once
+// The whole sketch as one translation unit, for host programs that drive
+// it: they reach its globals and functions directly. Needs the stand-ins
+// in hal/ and the sketch folder on the include path (see CMakeLists.txt).
+#include <Arduino.h>
+#include "night_lamp6.5.ino"
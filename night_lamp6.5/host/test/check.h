@@ -0,0 +1,45 @@
+#pragma once
+// Just enough of a test harness: a failed CHECK is reported and counted,
+// and the test carries on. finish() ends the process with the result
+// without running static destructors, as the sketch's tasks are still up.
+#include <stdio.h>
+#include <unistd.h>
+#include <string>
+
+static int checkFailures = 0;
+
+#define CHECK(cond)                                                         \
+  do {                                                                      \
+    if (!(cond)) {                                                          \
+      checkFailures++;                                                      \
+      fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    }                                                                       \
+  } while (0)
+
+#define CHECK_EQ(a, b)                                                      \
+  do {                                                                      \
+    long long va_ = (long long)(a), vb_ = (long long)(b);                   \
+    if (va_ != vb_) {                                                       \
+      checkFailures++;                                                      \
+      fprintf(stderr, "%s:%d: CHECK_EQ(%s, %s) failed: %lld != %lld\n",     \
+              __FILE__, __LINE__, #a, #b, va_, vb_);                        \
+    }                                                                       \
+  } while (0)
+
+#define CHECK_CONTAINS(haystack, needle)                                    \
+  do {                                                                      \
+    std::string h_ = (haystack);                                            \
+    if (h_.find(needle) == std::string::npos) {                             \
+      checkFailures++;                                                      \
+      fprintf(stderr, "%s:%d: \"%s\" not in: %s\n", __FILE__, __LINE__,      \
+              needle, h_.c_str());                                          \
+    }                                                                       \
+  } while (0)
+
+static void finish(const char* name) {
+  if (checkFailures) printf("%s: %d check(s) failed\n", name, checkFailures);
+  else printf("%s: ok\n", name);
+  fflush(stdout);
+  fflush(stderr);
+  _exit(checkFailures ? 1 : 0);
+}
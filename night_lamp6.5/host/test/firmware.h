@@ -0,0 +1,32 @@
+#pragma once
+// Include after sketch.h. Runs setup() and loop() on their own thread,
+// which becomes the loop task, and waits for the web server to answer.
+#include <string>
+#include <thread>
+
+#include "host_hal.h"
+#include "http_client.h"
+
+// The HTTP port, or 0 if the server never came up
+inline uint16_t startFirmware() {
+  std::thread([] {
+    setup();
+    for (;;) loop();
+  }).detach();
+  for (int i = 0; i < 500; i++) {
+    uint16_t port = host::httpPort();
+    if (port && httpGet(port, "/status").code == 200) return port;
+    delay(10);
+  }
+  return 0;
+}
+
+// Polls cond every 10 ms for up to timeoutMs
+template <typename Cond>
+bool waitFor(Cond cond, uint32_t timeoutMs = 2000) {
+  for (uint32_t waited = 0;; waited += 10) {
+    if (cond()) return true;
+    if (waited >= timeoutMs) return false;
+    delay(10);
+  }
+}
@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+"""Write the onset fixtures for test_tempo.
+
+Each fixture is a beat track as the sound sensor hears it. Onsets land
+within a few ms of the beat, some beats are not heard, and there is the
+odd stray onset between beats. Lines are
+
+    b <us>   a true beat (heard or not)
+    o <us>   an onset the sensor reports
+
+as micros() timestamps, so they wrap at 2^32. Seeded, so running this
+again gives the same files:
+
+    python3 host/test/fixtures/make_onsets.py
+"""
+
+import os
+import random
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+WRAP = 1 << 32
+
+
+def track(rng, start_us, sections, jitter_us=8000, miss=0.08, stray=0.05):
+    """sections: (seconds, bpm, heard) in order; returns (beats, onsets)."""
+    beats, onsets = [], []
+    t = 0.0
+    for seconds, bpm, heard in sections:
+        period = 60e6 / bpm
+        end = t + seconds * 1e6
+        while t < end:
+            beats.append(t)
+            if heard and rng.random() >= miss:
+                onsets.append(t + rng.uniform(-jitter_us, jitter_us))
+            if heard and rng.random() < stray:
+                onsets.append(t + rng.uniform(0.2, 0.8) * period)
+            t += period
+    return ([int(start_us + b) % WRAP for b in beats],
+            [int(start_us + o) % WRAP for o in sorted(onsets)])
+
+
+def write(name, comment, beats, onsets):
+    lines = [("b", b) for b in beats] + [("o", o) for o in onsets]
+    # Time order from the first beat, across the wrap
+    lines.sort(key=lambda l: (l[1] - beats[0] + 1_000_000) % WRAP)
+    with open(os.path.join(HERE, name), "w") as f:
+        f.write("# " + comment + "\n")
+        for kind, us in lines:
+            f.write("%s %d\n" % (kind, us))
+
+
+def main():
+    rng = random.Random(2024)
+    # Starts 20 s before micros() wraps
+    write("onsets_steady.txt", "120 BPM for 60 s; micros() wraps 20 s in",
+          *track(rng, WRAP - 20_000_000, [(60, 120, True)]))
+    write("onsets_tempo_change.txt", "100 BPM for 40 s, then 128 BPM for 40 s",
+          *track(rng, 5_000_000, [(40, 100, True), (40, 128, True)]))
+    write("onsets_dropouts.txt",
+          "90 BPM; silent 30-36 s (shorter than the freewheel) and 60-72 s (longer)",
+          *track(rng, 5_000_000, [(30, 90, True), (6, 90, False), (24, 90, True),
+                                  (12, 90, False), (28, 90, True)]))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,76 @@
+#pragma once
+// Blocking HTTP/1.1 client for the host tests: one request per
+// connection, like the lamp serves them.
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct HttpResponse {
+  int                                              code = 0;  // 0: no answer
+  std::vector<std::pair<std::string, std::string>> headers;
+  std::string                                      body;
+
+  std::string header(const char* name) const {
+    for (const auto& h : headers) {
+      if (strcasecmp(h.first.c_str(), name) == 0) return h.second;
+    }
+    return "";
+  }
+};
+
+inline HttpResponse httpRequest(uint16_t port, const std::string& method, const std::string& path,
+                                const std::string& body = "",
+                                const std::vector<std::string>& extraHeaders = {}) {
+  HttpResponse res;
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) return res;
+  sockaddr_in addr = {};
+  addr.sin_family      = AF_INET;
+  addr.sin_port        = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (connect(fd, (sockaddr*)&addr, sizeof(addr)) < 0) {
+    close(fd);
+    return res;
+  }
+
+  std::string req = method + " " + path + " HTTP/1.1\r\nHost: 127.0.0.1\r\n";
+  for (const std::string& h : extraHeaders) req += h + "\r\n";
+  if (!body.empty() || method == "POST") req += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+  req += "\r\n" + body;
+  for (size_t at = 0; at < req.size();) {
+    ssize_t n = send(fd, req.data() + at, req.size() - at, MSG_NOSIGNAL);
+    if (n <= 0) break;
+    at += n;
+  }
+
+  std::string in;
+  char        buf[4096];
+  ssize_t     n;
+  while ((n = recv(fd, buf, sizeof(buf), 0)) > 0) in.append(buf, n);
+  close(fd);
+
+  size_t headEnd = in.find("\r\n\r\n");
+  if (headEnd == std::string::npos || in.compare(0, 9, "HTTP/1.1 ") != 0) return res;
+  res.code = atoi(in.c_str() + 9);
+  for (size_t at = in.find("\r\n") + 2; at < headEnd;) {
+    size_t end   = in.find("\r\n", at);
+    size_t colon = in.find(':', at);
+    if (colon < end) {
+      size_t v = in.find_first_not_of(' ', colon + 1);
+      res.headers.emplace_back(in.substr(at, colon - at), in.substr(v, end - v));
+    }
+    at = end + 2;
+  }
+  res.body = in.substr(headEnd + 4);
+  return res;
+}
+
+inline HttpResponse httpGet(uint16_t port, const std::string& path,
+                            const std::vector<std::string>& extraHeaders = {}) {
+  return httpRequest(port, "GET", path, "", extraHeaders);
+}
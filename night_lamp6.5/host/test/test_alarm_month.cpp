@@ -0,0 +1,186 @@
+// A month of alarms on a manual clock: loop() and the render frame are
+// stepped by hand, a minute at a time (a second while an alarm runs), and
+// every sunrise is checked against the list worked out day by day here.
+// The month has weekday and weekend alarms, a skip, a disabled alarm, a
+// one-shot sharing its time with a weekly alarm, a timezone change and the
+// millis() wraparound in the middle of a ramp.
+#include "sketch.h"
+#include "check.h"
+#include "host_hal.h"
+#include "http_client.h"
+
+#include <algorithm>
+#include <vector>
+
+const uint32_t LEAD_SEC    = 900;
+const uint32_t TIMEOUT_SEC = 300;
+const uint32_t DAYS        = 31;
+
+static uint16_t port = 0;
+
+static std::string dateArg(uint32_t day) {
+  char buf[DATE_BUF_LEN];
+  formatDate(day, buf, sizeof(buf));
+  return buf;
+}
+
+static uint32_t addAlarm(const std::string& query) {
+  HttpResponse r = httpGet(port, "/alarms/add?" + query);
+  CHECK_EQ(r.code, 200);
+  return (uint32_t)strtoul(r.body.c_str(), nullptr, 10);
+}
+
+// One loop() pass and one render frame, deltaMs later
+static void step(uint32_t deltaMs) {
+  {
+    StateLock lock;
+    clk.warp(deltaMs);
+  }
+  wakeLoop();  // or loop() sleeps up to a second of real time
+  loop();
+  StateLock lock;
+  renderFrame();
+}
+
+static uint32_t localNow() {
+  StateLock lock;
+  return nowEpochLocal();
+}
+
+// The sunrise fades: one per segment, each ending on the level the ramp
+// has at the segment's end, up to full
+static void checkRamp(const std::vector<host::LedcFade>& fades) {
+  const uint32_t durationMs = LEAD_SEC * 1000;
+  CHECK_EQ(fades.size(), HP_RAMP_SEGMENTS);
+  for (size_t i = 0; i < fades.size() && i < (size_t)HP_RAMP_SEGMENTS; i++) {
+    uint32_t endMs   = (uint32_t)((uint64_t)(i + 1) * durationMs / HP_RAMP_SEGMENTS);
+    uint16_t toLevel = (uint16_t)((uint64_t)endMs * 65535 / durationMs);
+    CHECK_EQ(fades[i].pin, pwmPin);
+    CHECK_EQ(fades[i].toDuty, hpLevelToDuty(toLevel));
+    CHECK(fades[i].fromDuty <= fades[i].toDuty);
+    if (i > 0) CHECK(fades[i - 1].toDuty <= fades[i].fromDuty);
+  }
+  if (!fades.empty()) CHECK_EQ(fades.back().toDuty, hpLevelToDuty(65535));
+}
+
+int main() {
+  // Sunday 2026-03-01, 00:00 local at UTC+2; the browser's offset is -120
+  const uint32_t day0 = civilToDays(2026, 3, 1);
+  CHECK_EQ(weekdayOfDay(day0), 0);
+  int32_t tz = -120;
+
+  // millis() wraps at 08:50 on day 0, five minutes into the first ramp
+  host::holdTask("render");
+  clk.setManual((uint32_t)(0x100000000ULL - (8 * 3600 + 50 * 60) * 1000ULL));
+  setup();
+  port = host::httpPort();
+  CHECK(port != 0);
+  if (!port) finish("test_alarm_month");
+
+  CHECK_EQ(httpGet(port, "/settime?epoch=" + std::to_string(day0 * AlarmCal::DAY + tz * 60) +
+                         "&tz=" + std::to_string(tz)).code, 200);
+  CHECK_EQ(httpGet(port, "/alarmcfg/set?lead=" + std::to_string(LEAD_SEC) + "&led=1&buzz=1&timeout=" +
+                         std::to_string(TIMEOUT_SEC)).code, 200);
+  CHECK_EQ(localNow(), day0 * AlarmCal::DAY);
+
+  uint32_t weekday = addAlarm("time=06:30&mask=62");  // Mon..Fri
+  addAlarm("time=09:00&mask=65");                       // Sat, Sun
+  addAlarm("time=12:00&enabled=0");
+  uint32_t shared  = addAlarm("time=06:30&date=" + dateArg(day0 + 10));  // a Wednesday
+  uint32_t evening = addAlarm("time=22:15&date=" + dateArg(day0 + 20));
+  CHECK_EQ(httpGet(port, "/alarms/skip?id=" + std::to_string(weekday) + "&date=" + dateArg(day0 + 15)).code, 200);
+
+  std::vector<uint32_t> expected;
+  for (uint32_t d = day0; d < day0 + DAYS; d++) {
+    uint8_t wd = weekdayOfDay(d);
+    if (wd >= 1 && wd <= 5 && d != day0 + 15) expected.push_back(d * AlarmCal::DAY + 6 * 3600 + 30 * 60);
+    if (wd == 0 || wd == 6)                   expected.push_back(d * AlarmCal::DAY + 9 * 3600);
+  }
+  expected.push_back((day0 + 20) * AlarmCal::DAY + 22 * 3600 + 15 * 60);
+  std::sort(expected.begin(), expected.end());
+
+  // Day 17, 14:00: the timezone moves an hour west, away from any alarm
+  const uint32_t tzChangeLocal = (day0 + 17) * AlarmCal::DAY + 14 * 3600;
+  const uint32_t endLocal      = (day0 + DAYS) * AlarmCal::DAY;
+
+  std::vector<uint32_t>        fired;
+  std::vector<host::LedcFade>  fades;
+  bool     wasActive  = false;
+  bool     wasBeeping = false;
+  uint32_t beepEpoch  = 0;
+  host::takeLedcFades();
+
+  for (;;) {
+    uint32_t now = localNow();
+    if (now >= endLocal) break;
+    if (tz == -120 && now >= tzChangeLocal) {
+      tz = -60;
+      uint32_t utc;
+      {
+        StateLock lock;
+        utc = nowEpochUTC();
+      }
+      CHECK_EQ(httpGet(port, "/settime?epoch=" + std::to_string(utc) + "&tz=" + std::to_string(tz)).code, 200);
+      CHECK_EQ(localNow(), tzChangeLocal - 3600);
+    }
+
+    step(wasActive ? 1000 : 60000);
+
+    bool active;
+    bool beeping;
+    uint32_t beepAt;
+    {
+      StateLock lock;
+      active  = alarmActive && !alarmIsTest;
+      beeping = active && beepStarted;
+      beepAt  = sunriseBeepEpochLocal;
+    }
+    now = localNow();
+    std::vector<host::LedcFade> taken = host::takeLedcFades();
+
+    if (active && !wasActive) {
+      fired.push_back(beepAt);
+      beepEpoch = beepAt;
+      CHECK_EQ(now, beepAt - LEAD_SEC);  // the ramp window opens on time
+      fades.clear();
+    }
+    if (active) fades.insert(fades.end(), taken.begin(), taken.end());
+    if (beeping && !wasBeeping) {
+      CHECK_EQ(now, beepEpoch);
+      CHECK_EQ(host::pinLevel(buzzerPin), HIGH);
+      CHECK_EQ(host::ledcDuty(pwmPin), 65535 >> (16 - HP_PWM_BITS));
+      checkRamp(fades);
+    }
+    if (!active && wasActive) {
+      CHECK_EQ(now, beepEpoch + TIMEOUT_SEC);
+      CHECK_EQ(host::pinLevel(buzzerPin), LOW);
+      CHECK_EQ(host::ledcDuty(pwmPin), 0);
+    }
+    wasActive  = active;
+    wasBeeping = beeping;
+  }
+
+  CHECK_EQ(fired.size(), expected.size());
+  for (size_t i = 0; i < fired.size() && i < expected.size(); i++) {
+    if (fired[i] != expected[i]) {
+      checkFailures++;
+      fprintf(stderr, "fire %zu: %s at %u, expected %s at %u\n", i,
+              dateArg(fired[i] / AlarmCal::DAY).c_str(), fired[i] % AlarmCal::DAY,
+              dateArg(expected[i] / AlarmCal::DAY).c_str(), expected[i] % AlarmCal::DAY);
+    }
+  }
+
+  // The one-shots are done; next up is Wednesday's weekday alarm (UTC)
+  {
+    StateLock lock;
+    CHECK(!alarms[findAlarm(shared)].enabled);
+    CHECK(!alarms[findAlarm(evening)].enabled);
+  }
+  std::string list = httpGet(port, "/alarms/list").body;
+  uint32_t nextUtc = endLocal + 6 * 3600 + 30 * 60 + tz * 60;
+  CHECK_CONTAINS(list, ("\"next\":" + std::to_string(nextUtc) + ",").c_str());
+  CHECK_CONTAINS(list, ("\"nextId\":" + std::to_string(weekday) + "}").c_str());
+
+  printf("%zu alarms in %u days\n", fired.size(), DAYS);
+  finish("test_alarm_month");
+}
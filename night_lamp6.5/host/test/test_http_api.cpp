@@ -0,0 +1,118 @@
+// The sketch's web API end to end: requests over the localhost socket,
+// results read back from the pixel frames on the wire, the WebSocket
+// clients and NVS.
+#include "sketch.h"
+#include "check.h"
+#include "firmware.h"
+
+// Every pixel of the last frame sent is (r, g, b); the ring is GRB
+static bool pixelsAre(uint8_t r, uint8_t g, uint8_t b) {
+  host::PixelFrame f = host::lastPixelFrame();
+  if (f.bytes.size() != numPixels * 3) return false;
+  for (int i = 0; i < numPixels; i++) {
+    if (f.bytes[i * 3] != g || f.bytes[i * 3 + 1] != r || f.bytes[i * 3 + 2] != b) return false;
+  }
+  return true;
+}
+
+static bool waitForPixels(uint8_t r, uint8_t g, uint8_t b) {
+  return waitFor([=] { return pixelsAre(r, g, b); });
+}
+
+static HttpResponse postState(uint16_t port, const std::string& body) {
+  return httpRequest(port, "POST", "/state", body, { "Content-Type: application/json" });
+}
+
+int main() {
+  uint16_t port = startFirmware();
+  CHECK(port != 0);
+  if (!port) finish("test_http_api");
+
+  // ---- /status, ETag ----
+  HttpResponse status = httpGet(port, "/status");
+  CHECK_EQ(status.code, 200);
+  CHECK(status.header("Content-Type") == "application/json");
+  CHECK(!status.header("Server-Timing").empty());
+  CHECK_CONTAINS(status.body, "\"version\":");
+  std::string etag = status.header("ETag");
+  CHECK(!etag.empty());
+  CHECK_EQ(httpGet(port, "/status", { "If-None-Match: " + etag }).code, 304);
+
+  // ---- Color from the UI: coalesced, on the wire a frame or two later ----
+  CHECK_EQ(httpGet(port, "/setrgb?r=255&g=0&b=0&bri=255").code, 204);
+  CHECK(waitForPixels(255, 0, 0));
+  HttpResponse changed = httpGet(port, "/status", { "If-None-Match: " + etag });
+  CHECK_EQ(changed.code, 200);
+  CHECK_CONTAINS(changed.body, "\"rgb\":{\"r\":255,\"g\":0,\"b\":0,\"bri\":255}");
+  CHECK_CONTAINS(changed.body, "\"override\":true");
+
+  // ---- POST /state: a /status-shaped document, unknown keys skipped ----
+  HttpResponse posted = postState(port,
+    "{\"version\":7,\"state\":1,\"rgb\":{\"r\":0,\"g\":0,\"b\":255,\"bri\":255,\"x\":[1,{\"y\":2}]},"
+    "\"alarmCfg\":{\"leadSec\":600},\"party\":{\"enabled\":false,\"bpm\":0,\"color\":\"#00ff00\"}}");
+  CHECK_EQ(posted.code, 200);
+  CHECK_CONTAINS(posted.body, "\"color\":\"#00FF00\"");
+  CHECK(waitForPixels(0, 0, 255));
+
+  // Malformed documents change nothing
+  CHECK_EQ(postState(port, "{\"rgb\":{\"r\":9},\"party\":{\"color\":\"#zzzzzz\"}}").code, 400);
+  CHECK_EQ(postState(port, "{\"rgb\":").code, 400);
+  CHECK_EQ(postState(port, "").code, 400);
+  CHECK_EQ(postState(port, std::string(STATE_BODY_MAX + 1, ' ')).code, 413);
+  CHECK_CONTAINS(httpGet(port, "/status").body, "\"rgb\":{\"r\":0,\"g\":0,\"b\":255,");
+
+  // ---- WebSocket: state on connect, pushes after changes ----
+  uint32_t client = ws.hostConnect();
+  std::vector<std::string> sent = ws.hostTakeSent(client);
+  CHECK_EQ(sent.size(), 1);
+  if (!sent.empty()) CHECK_CONTAINS(sent[0], "\"t\":\"state\"");
+
+  const uint8_t green[] = { 0x01, 0, 255, 0, 255 };  // setrgb control frame
+  CHECK(ws.hostReceive(client, green, sizeof(green)));
+  CHECK(waitForPixels(0, 255, 0));
+  std::string pushed;
+  CHECK(waitFor([&] {
+    for (const std::string& m : ws.hostTakeSent(client)) pushed += m;
+    return pushed.find("\"g\":255") != std::string::npos;
+  }));
+  ws.hostDisconnect(client);
+  CHECK_EQ(ws.count(), 0);
+
+  // ---- Button: the ISR wakes loop(), which cancels the web override ----
+  // (the ISR debounces 200 ms, counted from boot for the first press)
+  while (millis() < 300) delay(10);
+  host::setPin(buttonPin, LOW);
+  host::setPin(buttonPin, HIGH);
+  CHECK(waitFor([&] {
+    return httpGet(port, "/status").body.find("\"override\":false") != std::string::npos;
+  }));
+
+  // ---- NVS: a failed commit stays pending and is retried ----
+  uint32_t writes = host::prefsWrites();
+  host::prefsFailWrites(1000);
+  CHECK_CONTAINS(httpGet(port, "/default/save").body, "\"ok\":true");
+  httpGet(port, "/nvs/stats?flush=1");
+  CHECK(waitFor([&] {
+    std::string s = httpGet(port, "/nvs/stats").body;
+    return s.find("\"failures\":0") == std::string::npos && s.find("\"pending\":0") == std::string::npos;
+  }));
+  CHECK_EQ(host::prefsWrites(), writes);
+  host::prefsFailWrites(0);
+  httpGet(port, "/nvs/stats?flush=1");
+  CHECK(waitFor([&] {
+    return httpGet(port, "/nvs/stats").body.find("\"pending\":0") != std::string::npos;
+  }));
+  CHECK(host::prefsWrites() > writes);
+
+  // ---- Log: arguments formatted as their conversions read them ----
+  CHECK_EQ(httpGet(port, "/settime?epoch=1772000000&tz=-120").code, 200);
+  CHECK(waitFor([&] {
+    return httpGet(port, "/log").body.find("synced, UTC epoch = 1772000000  tz offset (min) = -120\n") != std::string::npos;
+  }));
+  std::string log = httpGet(port, "/log").body;
+  CHECK_CONTAINS(log, "I SYS: AP SSID: lumina_Lamp  password: luminalamp\n");
+  CHECK_CONTAINS(log, "W NVS: write failed (groups 0x");
+
+  CHECK_EQ(httpGet(port, "/no/such/page").code, 404);
+  finish("test_http_api");
+}
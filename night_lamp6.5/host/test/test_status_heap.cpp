@@ -0,0 +1,69 @@
+// Heap use of /status. Building the document allocates nothing. Serving it
+// is not allocation-free: the web server allocates the request, the
+// response stream and its buffer on every poll (the count is printed).
+// They must all come back: over 10k polls the free heap must return to
+// where it was, and its low-water mark (ESP.getMinFreeHeap()) may only dip
+// by about what the warm-up peak used, when connection threads overlap.
+#include "sketch.h"
+#include "check.h"
+#include "firmware.h"
+
+const int    WARMUP_POLLS = 1000;
+const int    SOAK_POLLS   = 10000;
+const size_t HEAP_SLACK   = 1024;  // a connection thread still winding down
+
+static uint32_t settledFreeHeap(uint32_t atLeast) {
+  waitFor([&] { return ESP.getFreeHeap() >= atLeast; });
+  return ESP.getFreeHeap();
+}
+
+int main() {
+  uint16_t port = startFirmware();
+  CHECK(port != 0);
+  if (!port) finish("test_status_heap");
+
+  // ---- Rendering: no allocation, in full or as a delta ----
+  {
+    static char buf[1024];
+    StateLock   lock;
+    uint64_t    before = host::threadHeapAllocs();
+    JsonWriter  w(buf, sizeof(buf));
+    w.beginObject();
+    writeStatus(w, nullptr);
+    w.endObject();
+    JsonWriter  d(buf, sizeof(buf));
+    d.beginObject();
+    writeStatus(d, stateAt(stateVersion()));
+    d.endObject();
+    CHECK_EQ(host::threadHeapAllocs() - before, 0);
+    CHECK(!w.overflowed() && !d.overflowed());
+  }
+
+  // ---- Serving: 10k polls, full and 304 ----
+  std::string etag = httpGet(port, "/status").header("ETag");
+  CHECK(!etag.empty());
+  auto poll = [&](int i) {
+    HttpResponse r = (i & 1) ? httpGet(port, "/status", { "If-None-Match: " + etag }) : httpGet(port, "/status");
+    return r.code == ((i & 1) ? 304 : 200);
+  };
+  for (int i = 0; i < WARMUP_POLLS; i++) CHECK(poll(i));
+
+  uint32_t freeBefore = settledFreeHeap(0);
+  uint32_t minBefore  = ESP.getMinFreeHeap();
+  uint64_t allAllocs  = host::heapAllocs();
+  uint64_t ownAllocs  = host::threadHeapAllocs();  // the client's side
+  int      failed     = 0;
+  for (int i = 0; i < SOAK_POLLS; i++) {
+    if (!poll(i)) failed++;
+  }
+  uint64_t serverAllocs = (host::heapAllocs() - allAllocs) - (host::threadHeapAllocs() - ownAllocs);
+  uint32_t freeAfter = settledFreeHeap(freeBefore - HEAP_SLACK);
+  uint32_t minAfter  = ESP.getMinFreeHeap();
+
+  printf("%d polls: %.1f server allocations per poll, free heap %u -> %u, min free heap %u -> %u\n",
+         SOAK_POLLS, (double)serverAllocs / SOAK_POLLS, freeBefore, freeAfter, minBefore, minAfter);
+  CHECK_EQ(failed, 0);
+  CHECK(freeAfter + HEAP_SLACK >= freeBefore);
+  CHECK(minAfter + (freeBefore - minBefore) >= minBefore);
+  finish("test_status_heap");
+}
@@ -0,0 +1,119 @@
+// TempoTracker on recorded onset tracks (fixtures/, see make_onsets.py):
+// steady, a tempo change, and dropouts shorter and longer than the
+// freewheel. Half a beat before each true beat the test asks for the next
+// predicted beat, as the party step does, and holds the tracker to bounds
+// on tempo and phase error over the windows it should be locked in.
+// Engine only: built without the HAL, on platform.h's standard side.
+#include "tempo_tracker.h"
+#include "check.h"
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+const int32_t BPM_TOLERANCE   = 2;
+const int32_t PHASE_MAX_US    = 30000;  // onsets jitter by up to 8 ms
+const int32_t PHASE_MEAN_US   = 10000;
+const int     UNLOCKED_MAX_PERCENT = 5;  // strays knock the confidence down for a beat or two
+
+struct Window {
+  uint32_t fromMs, toMs;  // from the first beat
+  uint16_t bpm;           // 0: expect no lock
+};
+
+struct Fixture {
+  const char* file;
+  Window      windows[4];
+};
+
+// Windows start 8 s after every start, tempo change or lost lock: the
+// tracker needs a dozen onsets to lock on (or to recover from a stray one
+// among the first few). A silence shorter than the freewheel is bridged.
+const Fixture FIXTURES[] = {
+  { "onsets_steady.txt",       { { 8000, 60000, 120 } } },
+  { "onsets_tempo_change.txt", { { 8000, 40000, 100 }, { 48000, 80000, 128 } } },
+  { "onsets_dropouts.txt",     { { 8000, 60000, 90 },  { 69000, 72000, 0 },
+                                 { 80000, 100000, 90 } } },
+};
+
+static bool load(const std::string& path, std::vector<uint32_t>& beats, std::vector<uint32_t>& onsets) {
+  FILE* f = fopen(path.c_str(), "r");
+  if (!f) return false;
+  char line[64];
+  while (fgets(line, sizeof(line), f)) {
+    char kind;
+    unsigned long us;
+    if (sscanf(line, "%c %lu", &kind, &us) != 2) continue;
+    if (kind == 'b') beats.push_back((uint32_t)us);
+    if (kind == 'o') onsets.push_back((uint32_t)us);
+  }
+  fclose(f);
+  return !beats.empty();
+}
+
+static void run(const Fixture& fx, const std::string& dir) {
+  std::vector<uint32_t> beats, onsets;
+  if (!load(dir + "/" + fx.file, beats, onsets)) {
+    fprintf(stderr, "%s: cannot read\n", fx.file);
+    checkFailures++;
+    return;
+  }
+  const uint32_t start = beats[0];
+
+  TempoTracker tracker;
+  tracker.reset();
+  size_t next = 0;
+  for (const Window& w : fx.windows) {
+    if (w.toMs == 0) break;
+    int      probes = 0, fails = 0, unlocked = 0;
+    uint32_t maxErr = 0;
+    uint64_t sumErr = 0;
+    uint16_t bpmLo = 0xFFFF, bpmHi = 0;
+
+    for (size_t i = 1; i + 1 < beats.size(); i++) {
+      uint32_t atMs = (beats[i] - start) / 1000;
+      if (atMs < w.fromMs || atMs >= w.toMs) continue;
+
+      // Half a beat ahead, with only the onsets heard by then
+      uint32_t probe = beats[i] - (beats[i + 1] - beats[i]) / 2;
+      while (next < onsets.size() && (int32_t)(onsets[next] - probe) < 0) tracker.onset(onsets[next++]);
+      probes++;
+
+      bool locked = tracker.locked(probe);
+      if (!w.bpm) {
+        if (locked) fails++;
+        continue;
+      }
+      uint32_t err = (uint32_t)abs((int32_t)(tracker.nextBeat(probe) - beats[i]));
+      if (!locked) unlocked++;
+      if (abs((int32_t)tracker.bpm() - (int32_t)w.bpm) > BPM_TOLERANCE ||
+          err > (uint32_t)PHASE_MAX_US) fails++;
+      maxErr = std::max(maxErr, err);
+      sumErr += err;
+      bpmLo = std::min(bpmLo, tracker.bpm());
+      bpmHi = std::max(bpmHi, tracker.bpm());
+    }
+
+    CHECK(probes > 0);
+    if (w.bpm) {
+      printf("%s %u-%u s: %d beats, %d unlocked, bpm %u..%u, phase error max %u us, mean %u us\n",
+             fx.file, w.fromMs / 1000, w.toMs / 1000, probes, unlocked, bpmLo, bpmHi, maxErr,
+             probes ? (uint32_t)(sumErr / probes) : 0);
+      CHECK(probes && sumErr / probes <= (uint64_t)PHASE_MEAN_US);
+      CHECK(unlocked * 100 <= probes * UNLOCKED_MAX_PERCENT);
+    } else {
+      printf("%s %u-%u s: %d beats, unlocked\n", fx.file, w.fromMs / 1000, w.toMs / 1000, probes);
+    }
+    if (fails) {
+      fprintf(stderr, "%s %u-%u s: %d of %d beats out of bounds\n", fx.file,
+              w.fromMs / 1000, w.toMs / 1000, fails, probes);
+      checkFailures++;
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  std::string dir = argc > 1 ? argv[1] : "fixtures";
+  for (const Fixture& fx : FIXTURES) run(fx, dir);
+  finish("test_tempo");
+}
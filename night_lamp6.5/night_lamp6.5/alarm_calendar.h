@@ -0,0 +1,140 @@
+#pragma once
+#include "platform.h"
+#include <algorithm>
+
+// Alarm calendar index (no heap).
+//
+//   weekly  - one entry per (alarm, weekday) as minute-of-week, sorted;
+//             next() is a binary search from the current minute
+//   one-shot- min-heap by fire time; stale entries are popped on query
+//   skips   - (day, slot) exceptions for weekly alarms, sorted
+//
+// Rebuild with clear(), add*(), build() whenever the alarm list changes;
+// next() is O(log n) (plus one lookup per skipped occurrence).
+// Times are local epoch seconds, days are local days since 1970-01-01.
+// Slots are whatever the caller uses to find the alarm again.
+
+// Days since 1970-01-01 <-> civil date (proleptic Gregorian)
+inline uint32_t civilToDays(int y, unsigned m, unsigned d) {
+  y -= m <= 2;
+  int era = (y >= 0 ? y : y - 399) / 400;
+  unsigned yoe = (unsigned)(y - era * 400);
+  unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+  unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return (uint32_t)(era * 146097 + (int)doe - 719468);
+}
+
+inline void daysToCivil(uint32_t days, int& y, unsigned& m, unsigned& d) {
+  int32_t z = (int32_t)days + 719468;
+  int era = (z >= 0 ? z : z - 146096) / 146097;
+  unsigned doe = (unsigned)(z - era * 146097);
+  unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  unsigned mp  = (5 * doy + 2) / 153;
+  d = doy - (153 * mp + 2) / 5 + 1;
+  m = mp < 10 ? mp + 3 : mp - 9;
+  y = (int)yoe + era * 400 + (m <= 2);
+}
+
+// 0 = Sunday (1970-01-01 was a Thursday)
+inline uint8_t weekdayOfDay(uint32_t days) { return (uint8_t)((days + 4) % 7); }
+
+template <uint16_t MaxAlarms, uint8_t MaxSkips>
+class AlarmCalendar {
+ public:
+  static const uint32_t DAY  = 86400;
+  static const uint32_t WEEK = 7 * DAY;
+
+  struct Fire {
+    uint32_t epoch;
+    uint16_t slot;
+  };
+
+  void clear() { weeklyCount = 0; onceCount = 0; skipCount = 0; }
+
+  // daysMask: bit0 = Sun .. bit6 = Sat; 0 = every day
+  void addWeekly(uint16_t slot, uint8_t hour, uint8_t minute, uint8_t daysMask) {
+    if (daysMask == 0) daysMask = 0x7F;
+    for (uint8_t wd = 0; wd < 7; wd++) {
+      if (!(daysMask & (1 << wd))) continue;
+      weekly[weeklyCount++] = { (uint16_t)(wd * 1440 + hour * 60 + minute), slot };
+    }
+  }
+
+  void addOnce(uint16_t slot, uint32_t epoch) {
+    once[onceCount++] = { epoch, slot };
+  }
+
+  bool addSkip(uint16_t slot, uint32_t day) {
+    if (skipCount >= MaxSkips) return false;
+    skips[skipCount++] = { day, slot };
+    return true;
+  }
+
+  void build() {
+    std::sort(weekly, weekly + weeklyCount,
+              [](const WeekEntry& a, const WeekEntry& b) { return a.weekMin < b.weekMin; });
+    std::make_heap(once, once + onceCount, laterFire);
+    std::sort(skips, skips + skipCount, skipLess);
+  }
+
+  // Earliest fire at or after `from`; false when there is none
+  bool next(uint32_t from, Fire& out) {
+    while (onceCount && once[0].epoch < from) {  // missed or already fired
+      std::pop_heap(once, once + onceCount, laterFire);
+      onceCount--;
+    }
+
+    bool found = false;
+    if (weeklyCount) {
+      uint32_t weekSec   = weekdayOfDay(from / DAY) * DAY + from % DAY;
+      uint32_t weekStart = from - weekSec;
+      uint16_t fromMin   = (uint16_t)((weekSec + 59) / 60);
+      const WeekEntry* it = std::lower_bound(weekly, weekly + weeklyCount, fromMin,
+          [](const WeekEntry& e, uint16_t m) { return e.weekMin < m; });
+      uint16_t i = (uint16_t)(it - weekly);
+      // Each skip hides at most one occurrence
+      for (uint16_t n = 0; n <= skipCount; n++, i++) {
+        if (i == weeklyCount) { i = 0; weekStart += WEEK; }
+        uint32_t epoch = weekStart + weekly[i].weekMin * 60UL;
+        if (skipped(weekly[i].slot, epoch / DAY)) continue;
+        out = { epoch, weekly[i].slot };
+        found = true;
+        break;
+      }
+    }
+
+    if (onceCount && (!found || once[0].epoch < out.epoch)) {
+      out = once[0];
+      found = true;
+    }
+    return found;
+  }
+
+  bool skipped(uint16_t slot, uint32_t day) const {
+    SkipEntry key = { day, slot };
+    return std::binary_search(skips, skips + skipCount, key, skipLess);
+  }
+
+ private:
+  struct WeekEntry {
+    uint16_t weekMin;  // 0 .. 7*1440-1, Sunday 00:00 = 0
+    uint16_t slot;
+  };
+  struct SkipEntry {
+    uint32_t day;
+    uint16_t slot;
+  };
+
+  static bool laterFire(const Fire& a, const Fire& b) { return a.epoch > b.epoch; }
+  static bool skipLess(const SkipEntry& a, const SkipEntry& b) {
+    return a.day != b.day ? a.day < b.day : a.slot < b.slot;
+  }
+
+  WeekEntry weekly[MaxAlarms * 7];
+  Fire      once[MaxAlarms];
+  SkipEntry skips[MaxSkips];
+  uint16_t  weeklyCount = 0;
+  uint16_t  onceCount   = 0;
+  uint8_t   skipCount   = 0;
+};
@@ -1,76 +1,60 @@
-#pragma once
-const char ALARMS_HTML[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-  <meta charset="UTF-8" />
-  <meta name="viewport" content="width=device-width, initial-scale=1.0" />
-  <title>Lumina – Alarms</title>
-  <link href="https://fonts.googleapis.com/css2?family=Poppins:wght@400;500;600;700&display=swap" rel="stylesheet">
-  <link rel="stylesheet" href="style.css" />
-</head>
-<body>
-  <div class="app">
-    <header>
-      <h1 class="logo">Lumina</h1>
-      <nav>
-        <a href="index.html">Settings</a>
-        <a href="#" class="active">Alarms</a>
-      </nav>
-    </header>
-
-    <main>
-      <!-- Current Time (Device) -->
-      <section class="card rtc-card">
-        <h3>Current Time (Device)</h3>
-        <div class="rtc-row">
-          <div class="rtc-time" id="rtcTime">--:--:--</div>
-          <div class="rtc-date" id="rtcDate">--</div>
-          <div class="rtc-state" id="rtcStatus">Source: internal</div>
-        </div>
-        <div style="margin-top:12px;">
-          <button class="default-btn" id="syncTimeBtn">Sync Time from Browser</button>
-        </div>
-      </section>
-
-      <!-- Next Alarm -->
-      <section class="card next-alarm">
-        <h3>Next Alarm</h3>
-        <p id="nextTime">--:--</p>
-        <p class="subtext" id="timeRemaining">No upcoming alarms</p>
-      </section>
-
-      <!-- Set Alarm -->
-      <section class="card set-alarm">
-        <h3>Set Alarm</h3>
-
-        <div class="wheel-container">
-          <input type="number" id="hour" min="0" max="23" value="0">
-          <span>:</span>
-          <input type="number" id="minute" min="0" max="59" value="0">
-        </div>
-
-        <div class="days">
-          <button class="day">S</button>
-          <button class="day">M</button>
-          <button class="day">T</button>
-          <button class="day">W</button>
-          <button class="day">T</button>
-          <button class="day">F</button>
-          <button class="day">S</button>
-        </div>
-
-        <button id="addAlarm" class="add-btn">+ Add Alarm</button>
-      </section>
-
-      <!-- Alarm List -->
-      <section class="alarm-list card" id="alarmList">
-        <p class="empty">No alarms have been set yet.</p>
-      </section>
-    </main>
-  </div>
-
-  <script src="script.js"></script>
-</body>
-</html>
-)rawliteral";
+#pragma once
+// Generated by tools/build_assets.py from web/alarms.html - do not edit.
+// 1885 bytes minified, 839 bytes gzip.
+const char ALARMS_HTML_ETAG[] = "\"f9d090d8\"";
+const size_t ALARMS_HTML_GZ_LEN = 839;
+const uint8_t ALARMS_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x55, 0xdb, 0x8e, 0xdb, 0x36,
+  0x10, 0xfd, 0x15, 0x96, 0x05, 0x8a, 0x16, 0x8d, 0x2c, 0xdb, 0x7b, 0xc9, 0xae, 0x23, 0x29, 0x4d,
+  0xb2, 0xc9, 0x53, 0x6e, 0xe8, 0x6e, 0x51, 0xf4, 0x91, 0x16, 0xc7, 0x16, 0x5b, 0x8a, 0x22, 0xc8,
+  0x91, 0xbd, 0x7a, 0xeb, 0x3f, 0xf4, 0x0f, 0xfb, 0x25, 0x19, 0x52, 0xd2, 0x5a, 0x8e, 0xb3, 0xdb,
+  0x87, 0x02, 0x96, 0xa8, 0xb9, 0x0f, 0xcf, 0x5c, 0x9c, 0x7d, 0x77, 0xf3, 0xe9, 0xcd, 0xdd, 0x1f,
+  0x9f, 0xdf, 0xb2, 0x0a, 0x6b, 0x5d, 0xb0, 0x2c, 0x1c, 0x4c, 0x0b, 0xb3, 0xcd, 0x39, 0x18, 0x1e,
+  0x18, 0x20, 0x24, 0x1d, 0x35, 0xa0, 0x60, 0x65, 0x25, 0x9c, 0x07, 0xcc, 0xf9, 0x6f, 0x77, 0xef,
+  0x92, 0x2b, 0xce, 0xd2, 0x51, 0x60, 0x44, 0x0d, 0x39, 0xdf, 0x29, 0xd8, 0xdb, 0xc6, 0x21, 0x67,
+  0x65, 0x63, 0x10, 0x0c, 0x29, 0xee, 0x95, 0xc4, 0x2a, 0x97, 0xb0, 0x53, 0x25, 0x24, 0x91, 0x78,
+  0xc6, 0x94, 0x51, 0xa8, 0x84, 0x4e, 0x7c, 0x29, 0x34, 0xe4, 0x8b, 0xd9, 0xbc, 0x77, 0x84, 0x0a,
+  0x35, 0x14, 0xef, 0xdb, 0x5a, 0x19, 0xc1, 0xfe, 0xfd, 0xfb, 0x1f, 0xf6, 0x4a, 0x0b, 0x57, 0xfb,
+  0x2c, 0xed, 0x05, 0x2c, 0xd3, 0xca, 0xfc, 0xc5, 0x2a, 0x07, 0x9b, 0x9c, 0x57, 0x88, 0xd6, 0xaf,
+  0xd2, 0x74, 0x43, 0x71, 0xfc, 0x6c, 0xdb, 0x34, 0x5b, 0x0d, 0xc2, 0x2a, 0x3f, 0x2b, 0x9b, 0x3a,
+  0x2d, 0xbd, 0x5f, 0xbe, 0xdc, 0x88, 0x5a, 0xe9, 0x2e, 0xff, 0xdc, 0x58, 0xab, 0x8c, 0x5f, 0xed,
+  0xb7, 0x15, 0xfe, 0x72, 0x3e, 0x9f, 0xbf, 0xb8, 0xa0, 0xe7, 0x92, 0x9e, 0xe7, 0xf3, 0xf9, 0x0f,
+  0x52, 0x79, 0xab, 0x45, 0x97, 0xfb, 0xbd, 0xb0, 0x9c, 0x39, 0xd0, 0x39, 0xf7, 0xd8, 0x69, 0xf0,
+  0x15, 0x00, 0xf2, 0x31, 0xe2, 0xd7, 0xfc, 0x21, 0x85, 0x34, 0xb2, 0x66, 0x14, 0xec, 0xe5, 0x2e,
+  0xbf, 0x3c, 0x5f, 0x5e, 0xcb, 0xf9, 0xb9, 0xec, 0x6f, 0x92, 0x0e, 0x98, 0xad, 0x1b, 0xd9, 0xd1,
+  0x21, 0xd5, 0x8e, 0x95, 0x5a, 0x78, 0x9f, 0x73, 0x61, 0xed, 0x88, 0x29, 0xb8, 0xf0, 0xb1, 0x18,
+  0x25, 0xba, 0xd9, 0x36, 0x7c, 0xb8, 0x3d, 0x39, 0x58, 0x90, 0xd0, 0x88, 0x1d, 0xbd, 0xc5, 0x18,
+  0x4f, 0x19, 0x09, 0xf7, 0xb3, 0x50, 0x1f, 0x0a, 0x38, 0x9f, 0x5f, 0x2d, 0x2e, 0x9f, 0x5f, 0x2d,
+  0x78, 0x71, 0x0b, 0x88, 0xca, 0x6c, 0x09, 0x27, 0x31, 0xd1, 0xfe, 0x9e, 0x3f, 0x84, 0x2c, 0x51,
+  0xed, 0x80, 0x17, 0x23, 0x9a, 0x41, 0x2b, 0xed, 0x5d, 0xa7, 0x0f, 0x79, 0xd4, 0x42, 0x19, 0x3a,
+  0x3c, 0x90, 0x72, 0x63, 0x46, 0xd3, 0x52, 0x38, 0xc9, 0x1c, 0x96, 0x49, 0xf8, 0x88, 0x79, 0x9f,
+  0x15, 0x6f, 0x5a, 0xe7, 0xa8, 0xb2, 0xec, 0x4e, 0xd5, 0xc0, 0x7e, 0xbc, 0x89, 0x85, 0xfd, 0x89,
+  0x3c, 0x9d, 0x1d, 0x5f, 0x34, 0x58, 0xb9, 0x66, 0xcf, 0x4f, 0xb9, 0x48, 0x86, 0x9c, 0x29, 0x19,
+  0xa9, 0xe0, 0x85, 0x17, 0x49, 0xb2, 0x8a, 0xbf, 0x2c, 0x25, 0xdd, 0x53, 0x0b, 0x29, 0xf0, 0x60,
+  0x71, 0x13, 0x88, 0xe2, 0x51, 0x5d, 0x8f, 0x53, 0xe5, 0x5b, 0xa2, 0x5a, 0x4f, 0x18, 0x35, 0xad,
+  0x2b, 0x61, 0x45, 0x9d, 0x87, 0xe0, 0x8c, 0xd0, 0xa3, 0xf1, 0xc4, 0x47, 0xac, 0x66, 0xce, 0x6b,
+  0xe1, 0xb6, 0xca, 0x24, 0xd8, 0xd8, 0xd5, 0x62, 0x69, 0xef, 0x5f, 0x84, 0x0b, 0xac, 0x5b, 0xc4,
+  0x03, 0x28, 0x12, 0x36, 0xa2, 0xd5, 0x98, 0xac, 0xd1, 0xf4, 0x71, 0x7c, 0x67, 0xe2, 0x3d, 0x5e,
+  0x13, 0xa3, 0xb8, 0x25, 0xa2, 0xc7, 0x66, 0xe3, 0x9a, 0x9a, 0xbd, 0x26, 0x0c, 0x3c, 0xb8, 0x2c,
+  0xed, 0x7d, 0x1c, 0x42, 0xa6, 0x03, 0xd4, 0x8f, 0x80, 0x6e, 0xe0, 0x1e, 0x13, 0x11, 0x2a, 0x36,
+  0xc0, 0xfe, 0x91, 0x18, 0xfd, 0x40, 0x0c, 0x58, 0xdb, 0x18, 0x3b, 0xe8, 0x4d, 0x30, 0xcc, 0x52,
+  0x1b, 0x45, 0x83, 0x2b, 0xdf, 0xae, 0x91, 0x14, 0xfa, 0x34, 0x03, 0xee, 0xbf, 0x42, 0x28, 0x34,
+  0x75, 0x0b, 0x2f, 0x3e, 0x36, 0xac, 0xb5, 0x34, 0x2d, 0x44, 0x30, 0x31, 0xb4, 0x86, 0xfd, 0xef,
+  0xc4, 0x68, 0xfa, 0x8f, 0xf2, 0xa2, 0xee, 0x3b, 0x4a, 0x6b, 0x52, 0x8e, 0x3d, 0x4d, 0x8b, 0x4e,
+  0xc2, 0x26, 0xa0, 0x98, 0xe0, 0x82, 0x81, 0x32, 0xb6, 0x45, 0x86, 0x9d, 0x25, 0xa4, 0x4d, 0x5b,
+  0xaf, 0x89, 0x1b, 0x73, 0xab, 0xa8, 0x3e, 0x9c, 0x51, 0x2e, 0x39, 0xa7, 0x65, 0x50, 0x8b, 0xfb,
+  0x9c, 0x2f, 0xcf, 0x38, 0xdb, 0x09, 0xdd, 0x42, 0x60, 0x85, 0x64, 0xac, 0x30, 0xc5, 0x8a, 0xd2,
+  0x0b, 0xe7, 0xe3, 0x9e, 0xc8, 0x47, 0x1b, 0x1a, 0xe0, 0xc8, 0xd7, 0xc5, 0xf5, 0xb1, 0xaf, 0xd3,
+  0xd6, 0x91, 0xa2, 0xf3, 0xdf, 0x28, 0xb5, 0xe8, 0xa8, 0xa2, 0x93, 0xe2, 0x7d, 0x43, 0xfc, 0xe1,
+  0x69, 0xf1, 0xdd, 0xd3, 0xe2, 0xdf, 0xff, 0x97, 0xf5, 0xbb, 0xa7, 0xc5, 0xb7, 0xa7, 0x6d, 0x37,
+  0xb9, 0x72, 0x63, 0x68, 0x23, 0xc7, 0xd1, 0x0a, 0x8b, 0x4e, 0xac, 0x41, 0xb3, 0x4d, 0xe3, 0x68,
+  0x5f, 0x84, 0x6a, 0xf6, 0x53, 0xf6, 0xc9, 0xe8, 0x8e, 0x05, 0xbd, 0x67, 0xf4, 0xce, 0xd2, 0xa8,
+  0xf4, 0x15, 0xf6, 0x87, 0xd9, 0x9c, 0xd8, 0x3d, 0x84, 0x1b, 0x92, 0x8a, 0x62, 0x29, 0x63, 0x9f,
+  0x1c, 0xf6, 0x92, 0x94, 0x71, 0x86, 0x8a, 0x9f, 0xd9, 0x2b, 0x29, 0xc7, 0x26, 0x3a, 0x24, 0xfc,
+  0x68, 0x1f, 0xc6, 0x40, 0x89, 0x56, 0x1e, 0x59, 0xdc, 0x4b, 0x87, 0xe8, 0xef, 0x89, 0xc7, 0xa7,
+  0x03, 0x00, 0xb5, 0xc5, 0x2e, 0xf6, 0x7a, 0xdf, 0xe2, 0xac, 0x12, 0x3b, 0x60, 0x6b, 0x00, 0x13,
+  0x1a, 0x99, 0x75, 0x80, 0xb3, 0x93, 0xae, 0x4f, 0x87, 0x5d, 0x38, 0x5c, 0xc1, 0x97, 0x4e, 0x59,
+  0x64, 0xde, 0x95, 0x61, 0xe5, 0x47, 0x62, 0xf6, 0x67, 0x58, 0xf9, 0xcb, 0x8b, 0xf5, 0xa6, 0xbc,
+  0x3e, 0xdf, 0xf0, 0x22, 0x1b, 0xf8, 0xc1, 0x68, 0x58, 0xf9, 0x69, 0xfc, 0x37, 0xfd, 0x02, 0xf1,
+  0x7c, 0x44, 0xff, 0x5d, 0x07, 0x00, 0x00,
+};
@@ -0,0 +1,38 @@
+#pragma once
+#include "platform.h"
+#include <algorithm>
+
+// Microbenchmarks on the CPU cycle counter (cpuCycles(), see platform.h).
+// A case runs its body `iters` times per sample, BENCH_SAMPLES samples;
+// it reports cycles per iteration for the best and the median sample.
+// The best one is the least disturbed by interrupts and cache misses; a
+// wide gap to the median means the number is noisy.
+//
+// Bodies should hand their result to benchKeep() so the compiler cannot
+// drop the work.
+
+const int BENCH_SAMPLES = 7;
+
+struct BenchResult {
+  const char* name;
+  uint32_t    iters;
+  uint32_t    bestCycles;
+  uint32_t    medianCycles;
+};
+
+template <typename Fn>
+BenchResult benchRun(const char* name, uint32_t iters, Fn body) {
+  uint32_t samples[BENCH_SAMPLES];
+  for (int s = 0; s < BENCH_SAMPLES; s++) {
+    uint32_t t0 = cpuCycles();
+    for (uint32_t i = 0; i < iters; i++) body(i);
+    samples[s] = (cpuCycles() - t0) / iters;
+  }
+  std::sort(samples, samples + BENCH_SAMPLES);
+  return { name, iters, samples[0], samples[BENCH_SAMPLES / 2] };
+}
+
+template <typename T>
+inline void benchKeep(const T& v) {
+  asm volatile("" : : "r,m"(v) : "memory");
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include "platform.h"
+
+// Firmware clock. Everything that keeps schedule or calendar time (epoch,
+// timers, sunrise ramp, buzzer, NVS debounce) reads ms() instead of
+// millis(), so time can be warped:
+//   - on the device, warp() jumps ahead (a 2 h ramp or a week of alarms
+//     without waiting; or right up to the 49.7-day millis() wraparound)
+//   - on a host, setManual() freezes time; it then only moves by warp(),
+//     so a program can step through a month of alarms in a few ms
+// Cost measurement, render pacing and sound timestamps stay on the
+// hardware clock (micros()); warping them would only corrupt the stats.
+class Clock {
+ public:
+  uint32_t ms() const { return manual ? manualMs : millis() + offsetMs; }
+
+  // Jump ahead; timers that came due run on the scheduler's next pass
+  void warp(uint32_t deltaMs) {
+    if (manual) manualMs += deltaMs;
+    else        offsetMs += deltaMs;
+  }
+
+  void setManual(uint32_t startMs) {
+    manualMs = startMs;
+    manual   = true;
+  }
+
+  bool     isManual() const { return manual; }
+  uint32_t warpedMs() const { return offsetMs; }  // total warp so far (real mode)
+
+ private:
+  volatile uint32_t offsetMs = 0;
+  volatile uint32_t manualMs = 0;
+  bool              manual   = false;
+};
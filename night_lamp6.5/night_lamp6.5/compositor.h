@@ -0,0 +1,108 @@
+#pragma once
+#include "platform.h"
+
+// Output compositor. Each output source (base state, web override, party,
+// alarm, ...) draws into its own layer; once per frame the layers are
+// stacked by index, higher over lower, into one framebuffer of linear
+// 16-bit channels plus the HP LED level.
+//
+// A layer covers the pixels, the HP LED, both or nothing (hidden), so the
+// alarm can take the HP LED while the pixels keep showing what is below.
+// Pixel layers have an alpha for fades.
+//
+// compose() only runs after a layer was touched, and reports which
+// outputs differ from the previous frame: an unchanged frame costs no
+// show() and no PWM write.
+
+struct Rgb16 {
+  uint16_t r, g, b;
+};
+
+template <uint16_t N, uint8_t Layers>
+class Compositor {
+ public:
+  enum : uint8_t { PIXELS = 1, HP = 2 };
+
+  struct Layer {
+    Rgb16    px[N];
+    uint16_t hp;      // linear 0..65535
+    uint16_t alpha;   // pixels: 0 = transparent .. 65535 = opaque
+    uint8_t  covers;  // PIXELS | HP, 0 = hidden
+  };
+
+  // For drawing into a layer; marks the frame for composing
+  Layer& edit(uint8_t i) {
+    dirty = true;
+    return layers[i];
+  }
+
+  const Layer& layer(uint8_t i) const { return layers[i]; }
+
+  void fill(uint8_t i, Rgb16 c, uint16_t hp, uint8_t covers = PIXELS | HP) {
+    Layer& l = edit(i);
+    for (uint16_t p = 0; p < N; p++) l.px[p] = c;
+    l.hp     = hp;
+    l.alpha  = 65535;
+    l.covers = covers;
+  }
+
+  void hide(uint8_t i) {
+    if (!layers[i].covers) return;
+    layers[i].covers = 0;
+    dirty = true;
+  }
+
+  // Returns the PIXELS / HP bits of the outputs that changed
+  uint8_t compose() {
+    if (!dirty) return 0;
+    dirty = false;
+
+    Rgb16    px[N] = {};
+    uint16_t hp    = 0;
+    for (uint8_t i = 0; i < Layers; i++) {
+      const Layer& l = layers[i];
+      if (l.covers & HP) hp = l.hp;
+      if (!(l.covers & PIXELS) || !l.alpha) continue;
+      if (l.alpha == 65535) {
+        memcpy(px, l.px, sizeof(px));
+        continue;
+      }
+      for (uint16_t p = 0; p < N; p++) {
+        px[p].r = blend(px[p].r, l.px[p].r, l.alpha);
+        px[p].g = blend(px[p].g, l.px[p].g, l.alpha);
+        px[p].b = blend(px[p].b, l.px[p].b, l.alpha);
+      }
+    }
+
+    uint8_t changed = primed ? 0 : PIXELS | HP;
+    primed = true;
+    if (memcmp(px, out, sizeof(out)) != 0) {
+      memcpy(out, px, sizeof(out));
+      changed |= PIXELS;
+    }
+    if (hp != outHp) {
+      outHp = hp;
+      changed |= HP;
+    }
+    composed++;
+    if (!changed) unchanged++;
+    return changed;
+  }
+
+  const Rgb16* frame() const { return out; }
+  uint16_t     hp() const    { return outHp; }
+
+  uint32_t composed  = 0;  // frames composed
+  uint32_t unchanged = 0;  // ... that matched the previous frame
+
+ private:
+  static uint16_t blend(uint16_t below, uint16_t over, uint16_t alpha) {
+    return ((uint32_t)over * alpha + (uint32_t)below * (65535 - alpha) + 32767) / 65535;
+  }
+
+  Layer    layers[Layers] = {};
+  Rgb16    out[N]         = {};
+  uint16_t outHp          = 0;
+  bool     dirty          = true;
+  bool     primed         = false;
+};
@@ -0,0 +1,87 @@
+#pragma once
+#include "platform.h"
+#include <array>
+
+// Brightness curves as lookup tables computed at compile time (they end up
+// in flash as plain const arrays; nothing runs at boot).
+//
+//   Gamma22 - x^2.2, matches sRGB closely; right for color channels
+//   CieL    - CIE 1976 L* lightness; perceptually even brightness steps
+//
+// Tables: 8-bit input -> 16-bit output (HP LED PWM) and 8-bit input ->
+// 8-bit output (NeoPixel channels / brightness).
+
+enum class LightCurve : uint8_t { Gamma22, CieL };
+
+namespace lightcurve {
+
+// Just enough constexpr math for the curves (std::pow isn't constexpr)
+constexpr double cexp(double y) {
+  int halvings = 0;
+  while (y > 0.5 || y < -0.5) { y /= 2; halvings++; }
+  double sum = 1, term = 1;
+  for (int n = 1; n < 24; n++) { term *= y / n; sum += term; }
+  while (halvings--) sum *= sum;
+  return sum;
+}
+
+constexpr double cln(double x) {  // x > 0
+  int k = 0;
+  while (x < 0.5) { x *= 2; k--; }
+  while (x >= 1.0) { x /= 2; k++; }
+  double z = (x - 1) / (x + 1), z2 = z * z, term = z, sum = 0;
+  for (int n = 1; n < 60; n += 2) { sum += term / n; term *= z2; }
+  return 2 * sum + k * 0.6931471805599453;
+}
+
+// Linear light (0..1) for input 0..1
+constexpr double curve(LightCurve c, double x) {
+  if (x <= 0) return 0;
+  if (c == LightCurve::Gamma22) return cexp(2.2 * cln(x));
+  double l = x * 100.0;              // L* 0..100
+  if (l <= 8.0) return l / 903.3;
+  double f = (l + 16.0) / 116.0;
+  return f * f * f;
+}
+
+constexpr std::array<uint16_t, 256> table16(LightCurve c) {
+  std::array<uint16_t, 256> t{};
+  for (int i = 0; i < 256; i++) t[i] = (uint16_t)(curve(c, i / 255.0) * 65535.0 + 0.5);
+  return t;
+}
+
+// Never maps a nonzero input to 0, so the lowest settings stay visible
+constexpr std::array<uint8_t, 256> table8(LightCurve c) {
+  std::array<uint8_t, 256> t{};
+  for (int i = 0; i < 256; i++) {
+    uint8_t v = (uint8_t)(curve(c, i / 255.0) * 255.0 + 0.5);
+    t[i] = (i > 0 && v == 0) ? 1 : v;
+  }
+  return t;
+}
+
+template <LightCurve C> struct Lut {
+  static constexpr std::array<uint16_t, 256> out16 = table16(C);
+  static constexpr std::array<uint8_t, 256>  out8  = table8(C);
+};
+
+}  // namespace lightcurve
+
+// 8 -> 16 bit through curve C
+template <LightCurve C>
+inline uint16_t curve16(uint8_t x) { return lightcurve::Lut<C>::out16[x]; }
+
+// 16 -> 16 bit through curve C, interpolating between table entries. Entry
+// i is the curve at i/255, i.e. at x = i * 257, so x / 257 is the index and
+// the remainder how far along to the next one; only x = 65535 lands on 255.
+template <LightCurve C>
+inline uint16_t curve16Fine(uint16_t x) {
+  const auto& t = lightcurve::Lut<C>::out16;
+  uint16_t i = x / 257, frac = x % 257;
+  if (i == 255) return t[255];
+  return t[i] + (uint16_t)((int32_t)(t[i + 1] - t[i]) * frac / 257);
+}
+
+// 8 -> 8 bit through curve C
+template <LightCurve C>
+inline uint8_t curve8(uint8_t x) { return lightcurve::Lut<C>::out8[x]; }
@@ -1,158 +1,91 @@
-#pragma once
-const char INDEX_HTML[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html lang="en">
-<link rel="stylesheet" href="/style.css">
-<script src="/script.js" defer></script>
-
-<head>
-  <meta charset="UTF-8" />
-  <meta name="viewport" content="width=device-width, initial-scale=1.0" />
-  <title>Lumina – Smart Light Control</title>
-  <link href="https://fonts.googleapis.com/css2?family=Poppins:wght@400;500;600;700&display=swap" rel="stylesheet">
-  <link rel="stylesheet" href="style.css" />
-</head>
-<body>
-  <div class="app">
-    <header>
-      <h1 class="logo">Lumina</h1>
-      <nav>
-        <a href="#" class="active">Settings</a>
-        <a href="alarms.html">Alarms</a>
-      </nav>
-    </header>
-
-    <main>
-      <!-- Lamp State -->
-      <section class="card lamp-state">
-        <div class="lamp-circle" id="lampCircle"></div>
-        <div class="lamp-info">
-          <h2>Current Lamp State</h2>
-          <p>
-            Color: <span id="lampColor">#ABCDEF</span>,
-            Brightness: <span id="lampBrightness">80%</span>
-          </p>
-        </div>
-      </section>
-
-      <!-- Brightness + Color Picker -->
-      <section class="card">
-        <h3>Current Lamp State</h3>
-        <label>Main Brightness</label>
-        <input type="range" id="brightness" min="0" max="100" value="80" />
-
-        <label>Color Picker</label>
-        <input type="color" id="colorPicker" value="#abcdef" />
-        <button class="default-btn">Set as Default</button>
-      </section>
-
-            <!-- Modes & Party -->
-      <section class="card">
-        <!-- (no "Modes" heading text as requested) -->
-
-        <!-- Party Mode first -->
-        <div class="mode">
-          <div>
-            <p><strong>Party Mode</strong><br><span>Dynamic light patterns</span></p>
-          </div>
-          <label class="switch">
-            <input type="checkbox" id="partyMode" />
-            <span class="slider"></span>
-          </label>
-        </div>
-
-        <!-- Music Sync second -->
-        <div class="mode">
-          <div>
-            <p><strong>Music Sync</strong><br><span>Reacts to nearby sounds</span></p>
-          </div>
-          <label class="switch">
-            <input type="checkbox" id="musicMode" />
-            <span class="slider"></span>
-          </label>
-        </div>
-
-        <!-- Party settings: always visible and in the same box -->
-        <div class="party-settings" id="partySettings">
-
-          <!-- Effects -->
-          <label>Effects</label>
-          <div class="effects">
-            <button class="effect active" data-effect="0">Fade</button>
-            <button class="effect" data-effect="1">Strobe</button>
-            <button class="effect" data-effect="2">Pulse</button>
-          </div>
-
-          <!-- Speed -->
-          <label>Speed</label>
-          <input type="range" id="partySpeed" min="0" max="100" value="50">
-
-          <!-- Brightness -->
-          <label>Brightness</label>
-          <input type="range" id="partyBrightness" min="0" max="100" value="80">
-
-          <!-- Color mode -->
-          <label>Color Mode</label>
-          <div class="palette-row">
-            <label><input type="radio" name="partyColorMode" value="rgb" checked> RGB</label>
-            <label><input type="radio" name="partyColorMode" value="random"> Random</label>
-            <label><input type="radio" name="partyColorMode" value="single"> Single Color</label>
-          </div>
-
-          <!-- Single-color picker (used when "single" is selected) -->
-          <div class="custom-palette" id="partySingleColorBox">
-            <input type="color" id="partyColorPicker" value="#ff0000">
-          </div>
-        </div>
-      </section>
-
-
-      <!-- Advanced Settings -->
-      <section class="card">
-        <h3>Advanced Settings</h3>
-
-        <!-- Existing white LED manual control -->
-        <label>White LED Intensity</label>
-        <input type="range" id="hpLED" min="0" max="100" value="60" />
-
-        <!-- Ramp lead time -->
-        <div class="field-row">
-          <label for="rampSeconds">Wake-up ramp lead time (seconds)</label>
-          <input type="number" id="rampSeconds" min="10" max="7200" step="10" value="600" />
-        </div>
-
-        <!-- Alarm timeout -->
-        <div class="field-row">
-          <label for="alarmTimeoutMinutes">Alarm timeout (minutes)</label>
-          <input type="number" id="alarmTimeoutMinutes" min="1" max="120" step="1" value="10" />
-        </div>
-
-        <!-- Alarm type -->
-        <label>Alarm Type</label>
-        <div class="effects" id="alarmTypeGroup">
-          <button type="button" class="effect alarm-type active" data-type="led">LED</button>
-          <button type="button" class="effect alarm-type" data-type="buzzer">Beeper</button>
-        </div>
-
-        <!-- Ramp test -->
-        <div class="test-row">
-          <button type="button" class="default-btn test-btn" id="testRampBtn">Test Ramp</button>
-          <button type="button" class="default-btn test-btn" id="stopTestBtn" disabled>Stop Test</button>
-        </div>
-
-        <div class="progress-line" id="testProgress" aria-hidden="true">
-          <div class="progress-fill"></div>
-        </div>
-
-        <!-- Reset active alarm -->
-        <div class="test-row">
-          <button type="button" class="default-btn" id="resetAlarmBtn">Reset Alarm</button>
-        </div>
-      </section>
-    </main>
-  </div>
-
-  <script src="script.js"></script>
-</body>
-</html>
-)rawliteral";
+#pragma once
+// Generated by tools/build_assets.py from web/index.html - do not edit.
+// 3874 bytes minified, 1329 bytes gzip.
+const char INDEX_HTML_ETAG[] = "\"00816781\"";
+const size_t INDEX_HTML_GZ_LEN = 1329;
+const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x57, 0x6d, 0x6f, 0xdb, 0x36,
+  0x10, 0xfe, 0x2b, 0x1c, 0x83, 0x0d, 0x2d, 0x50, 0x45, 0xb6, 0x9b, 0xa4, 0x69, 0x66, 0xa9, 0x6b,
+  0xde, 0x8a, 0x01, 0x09, 0x66, 0xc4, 0x19, 0x8a, 0x7d, 0xa4, 0x24, 0xca, 0xe6, 0x42, 0x91, 0x04,
+  0x49, 0xd9, 0x75, 0x3f, 0xed, 0x3f, 0xec, 0x1f, 0xee, 0x97, 0xec, 0xf8, 0x62, 0x5b, 0x76, 0x9c,
+  0xb7, 0xb6, 0x06, 0x6c, 0x8b, 0xc7, 0xe3, 0xc3, 0xbb, 0x87, 0x77, 0xc7, 0xd3, 0xf0, 0xa7, 0xf3,
+  0x3f, 0xce, 0x6e, 0xff, 0x1a, 0x5d, 0xa0, 0xa9, 0x6d, 0x78, 0x8e, 0x86, 0xee, 0x0f, 0x71, 0x22,
+  0x26, 0x19, 0xa6, 0x02, 0x83, 0x80, 0x33, 0x71, 0x87, 0x34, 0xe5, 0x19, 0x36, 0x76, 0xc1, 0xa9,
+  0x99, 0x52, 0x6a, 0x31, 0x9a, 0x6a, 0x5a, 0x67, 0x38, 0xf5, 0xa2, 0xfd, 0xd2, 0x98, 0x0f, 0xb3,
+  0xec, 0xe8, 0x60, 0xf0, 0xbe, 0xea, 0x1d, 0x54, 0x6e, 0x91, 0x29, 0x35, 0x53, 0x16, 0x19, 0x5d,
+  0x3a, 0x25, 0x3f, 0xd8, 0xff, 0xdb, 0x29, 0x0d, 0x0e, 0x8b, 0xba, 0x7c, 0x7f, 0x50, 0x63, 0x54,
+  0xd1, 0x9a, 0xea, 0x7c, 0x18, 0x67, 0xdd, 0xce, 0x94, 0x54, 0xf0, 0xd7, 0x50, 0x4b, 0x50, 0x39,
+  0x25, 0xda, 0x50, 0x9b, 0xe1, 0x3f, 0x6f, 0x2f, 0x93, 0x63, 0x8c, 0xd2, 0xe5, 0x84, 0x20, 0x0d,
+  0xcd, 0xf0, 0x8c, 0xd1, 0xb9, 0x92, 0x1a, 0xec, 0x28, 0xa5, 0xb0, 0x54, 0x80, 0xe2, 0x9c, 0x55,
+  0x76, 0x9a, 0x55, 0x74, 0xc6, 0x4a, 0x9a, 0xf8, 0xc1, 0x1b, 0xc4, 0x04, 0xb3, 0x8c, 0xf0, 0xc4,
+  0x94, 0x84, 0xd3, 0xac, 0xbf, 0xdf, 0x0b, 0x40, 0x96, 0x59, 0x4e, 0xf3, 0xab, 0xb6, 0x61, 0x82,
+  0xa0, 0xff, 0xfe, 0xf9, 0x17, 0x8d, 0x1b, 0xa2, 0x2d, 0xba, 0x62, 0x93, 0xa9, 0x45, 0x67, 0x00,
+  0xa8, 0x25, 0x1f, 0xa6, 0x41, 0x2b, 0xfa, 0x1f, 0xdc, 0x9d, 0x5a, 0xab, 0xcc, 0x49, 0x9a, 0xd6,
+  0xa0, 0x63, 0xf6, 0x27, 0x52, 0x4e, 0x38, 0x25, 0x8a, 0x99, 0xfd, 0x52, 0x36, 0x29, 0x90, 0x30,
+  0xf8, 0x50, 0x93, 0x86, 0xf1, 0x45, 0x36, 0x92, 0x4a, 0x31, 0x61, 0x4e, 0xe6, 0x80, 0xf8, 0xdb,
+  0x41, 0xaf, 0xf7, 0xeb, 0x21, 0x7c, 0x8f, 0xe0, 0xfb, 0xae, 0xd7, 0xfb, 0xa5, 0x62, 0x46, 0x71,
+  0xb2, 0xc8, 0xcc, 0x9c, 0x28, 0x7c, 0x8f, 0xd9, 0x6f, 0x62, 0xdc, 0xbb, 0x95, 0x46, 0x02, 0x0b,
+  0x59, 0x2d, 0xe0, 0xaf, 0x62, 0x33, 0x54, 0x72, 0x62, 0x4c, 0x86, 0x89, 0x52, 0x38, 0x12, 0x0c,
+  0x94, 0xc3, 0x43, 0x7f, 0x39, 0xc3, 0xe5, 0x44, 0xe2, 0x48, 0x05, 0x00, 0xf4, 0x61, 0x52, 0x90,
+  0x19, 0xfc, 0x92, 0xb8, 0xdf, 0x1e, 0x5e, 0x81, 0x94, 0x96, 0xcd, 0x28, 0xce, 0xc7, 0xd4, 0x5a,
+  0x26, 0x26, 0x66, 0x98, 0x92, 0x8e, 0x1e, 0xe1, 0x44, 0x37, 0x66, 0xdf, 0x45, 0x0f, 0xce, 0x3f,
+  0xfa, 0x41, 0x50, 0x48, 0x03, 0x5e, 0xba, 0xda, 0xbc, 0x21, 0x4c, 0xb8, 0x08, 0xa1, 0x80, 0x27,
+  0xc5, 0x12, 0xbd, 0x24, 0xba, 0x82, 0xb0, 0x6b, 0x54, 0x62, 0x2c, 0xb1, 0x14, 0x6f, 0x3a, 0xe0,
+  0x27, 0x4a, 0xa6, 0x4b, 0x4e, 0x31, 0x62, 0x55, 0x10, 0x9c, 0x85, 0x31, 0x84, 0x10, 0x68, 0xee,
+  0xd0, 0x67, 0xa2, 0x96, 0xde, 0xed, 0x41, 0x7e, 0xd6, 0x6a, 0x0d, 0x51, 0x82, 0xae, 0x40, 0x8e,
+  0xc6, 0x6e, 0x03, 0x30, 0x68, 0x00, 0x73, 0x2a, 0x87, 0x03, 0xe7, 0x52, 0x9f, 0x80, 0x41, 0x8a,
+  0x88, 0x35, 0xb6, 0x13, 0xe2, 0x7c, 0xef, 0xe3, 0xe9, 0xd9, 0xf9, 0xc5, 0x25, 0x04, 0x29, 0x4c,
+  0xe6, 0x6f, 0xd0, 0xa9, 0x76, 0x31, 0x22, 0xa8, 0x31, 0xdb, 0x0b, 0xd6, 0x33, 0x38, 0x3f, 0xee,
+  0xfd, 0x1c, 0x57, 0x80, 0xdf, 0xca, 0xfd, 0x04, 0x03, 0xd3, 0xe8, 0xf3, 0x6e, 0xef, 0xbd, 0xa9,
+  0x6f, 0x77, 0x9b, 0xfa, 0xd6, 0x45, 0x05, 0x29, 0x28, 0xcf, 0xaf, 0x81, 0xbd, 0x8e, 0x19, 0xc3,
+  0x34, 0x88, 0xd1, 0x90, 0x09, 0xd5, 0x5a, 0x64, 0x17, 0x0a, 0xd2, 0x43, 0x43, 0xfa, 0x46, 0xa2,
+  0x8a, 0xb5, 0x5d, 0x08, 0x0e, 0x39, 0xc3, 0x90, 0x03, 0x0d, 0xf9, 0x92, 0xe1, 0x7e, 0x0f, 0x9e,
+  0x66, 0x84, 0xb7, 0xa0, 0x7f, 0x1c, 0x13, 0x23, 0x60, 0x79, 0xdf, 0xd1, 0x88, 0x95, 0x77, 0x54,
+  0xef, 0xc6, 0x2f, 0x3d, 0x3b, 0x1e, 0xdf, 0x3f, 0x06, 0xdd, 0x15, 0xdc, 0x1e, 0x29, 0x4a, 0xc8,
+  0xee, 0x80, 0x59, 0xb4, 0xd6, 0xae, 0x1d, 0x05, 0x31, 0x69, 0xb9, 0x4d, 0x0a, 0x2b, 0x7c, 0x24,
+  0x21, 0x62, 0xd0, 0x79, 0x90, 0x0d, 0xd3, 0xa0, 0xfa, 0x2c, 0xa2, 0x3a, 0x67, 0xdd, 0xc8, 0x6a,
+  0x19, 0x2e, 0xfe, 0x40, 0x87, 0x06, 0xf2, 0x57, 0x4c, 0xf2, 0x11, 0xe4, 0xf4, 0x02, 0x5d, 0xc3,
+  0x2c, 0xe0, 0x05, 0xd1, 0xb0, 0x80, 0x82, 0xe3, 0x0f, 0xe6, 0x7c, 0x01, 0x85, 0x84, 0x95, 0x88,
+  0xfb, 0x9c, 0x57, 0xc4, 0x5a, 0xaa, 0x85, 0x89, 0xa7, 0xb6, 0x71, 0x68, 0xde, 0xff, 0xe5, 0x5e,
+  0x66, 0xce, 0x6c, 0x39, 0xc5, 0xdb, 0x74, 0x4c, 0x69, 0x79, 0x57, 0xc8, 0x2f, 0x81, 0x11, 0xe5,
+  0xf6, 0x75, 0xdb, 0x06, 0xff, 0x7d, 0x94, 0x2c, 0x97, 0x73, 0x06, 0x39, 0xe0, 0x22, 0x76, 0x19,
+  0x1d, 0x4b, 0x76, 0xef, 0x87, 0xf0, 0x43, 0x6e, 0x5d, 0xb7, 0x06, 0xec, 0x1e, 0x2f, 0x44, 0xb9,
+  0xc3, 0xad, 0x1b, 0x0a, 0x59, 0x6a, 0x90, 0x95, 0x48, 0x50, 0xa2, 0x8b, 0x05, 0x32, 0xb2, 0x15,
+  0xd5, 0x8f, 0xf1, 0xab, 0x71, 0x1b, 0x7f, 0xbf, 0x5f, 0x9e, 0x9e, 0xc4, 0xc4, 0x22, 0xd2, 0xa1,
+  0x6c, 0x59, 0x57, 0xf0, 0x2a, 0x10, 0x2f, 0xea, 0x1a, 0x4e, 0xbf, 0x13, 0xe3, 0x1d, 0x18, 0x1a,
+  0xe6, 0xc2, 0xfa, 0x30, 0xb8, 0x62, 0xc6, 0x97, 0xcf, 0xcd, 0x88, 0x0b, 0x73, 0x28, 0x56, 0x2f,
+  0x54, 0x11, 0x4b, 0x92, 0x20, 0x73, 0xb9, 0x90, 0x5f, 0x12, 0x17, 0x1f, 0xab, 0xc8, 0xdb, 0xb5,
+  0x76, 0x6b, 0x51, 0x1f, 0x02, 0x17, 0x78, 0x2f, 0x5e, 0xb8, 0x6c, 0x80, 0xf3, 0x51, 0xcb, 0x4d,
+  0x77, 0xd5, 0x7d, 0x72, 0x82, 0x72, 0x02, 0x7c, 0x90, 0x66, 0xc3, 0xb7, 0x51, 0x90, 0xe4, 0x1b,
+  0xa7, 0x97, 0x8f, 0x15, 0xa5, 0xd5, 0x93, 0x25, 0x20, 0xb0, 0xeb, 0x54, 0x1f, 0x29, 0x01, 0x87,
+  0xbd, 0x35, 0xef, 0x2f, 0x28, 0x2f, 0x1e, 0xfb, 0xf4, 0x99, 0x35, 0x66, 0xab, 0xc2, 0x84, 0xd4,
+  0xdc, 0x71, 0xb6, 0x0a, 0x6e, 0x6b, 0x48, 0xc8, 0x44, 0xcb, 0xf9, 0x7a, 0xcd, 0x96, 0x05, 0x15,
+  0x93, 0x38, 0x36, 0x03, 0xde, 0x06, 0x0f, 0x19, 0xa2, 0x33, 0x6e, 0xa8, 0x27, 0x05, 0xdc, 0x5d,
+  0x2e, 0x84, 0x29, 0xdc, 0x8a, 0x37, 0x9f, 0x4e, 0xd7, 0x7b, 0x7d, 0x2b, 0x22, 0x11, 0x95, 0x6c,
+  0xc0, 0xa4, 0x1b, 0xff, 0xf0, 0xdd, 0x78, 0x06, 0xc2, 0xdd, 0x5d, 0x60, 0x68, 0xec, 0x1f, 0xc2,
+  0x4d, 0xf4, 0x58, 0xee, 0x94, 0xad, 0xb1, 0xb2, 0x49, 0x22, 0x3f, 0xdd, 0xd3, 0xf5, 0x00, 0x7e,
+  0xfd, 0x29, 0xe4, 0xeb, 0xc3, 0xe5, 0x7a, 0x6d, 0xc9, 0x76, 0xcd, 0xae, 0xeb, 0x1e, 0x7c, 0x70,
+  0xe7, 0xb6, 0x7a, 0xc1, 0xa5, 0xf5, 0xb1, 0x9a, 0x11, 0x51, 0xd2, 0x0a, 0xad, 0x9b, 0x83, 0xce,
+  0x9d, 0xf5, 0x79, 0xca, 0x2c, 0x45, 0x57, 0x17, 0xe7, 0xe8, 0x77, 0xd7, 0xac, 0x19, 0x66, 0x17,
+  0x4f, 0x06, 0xd6, 0x54, 0x81, 0xfe, 0x23, 0xe1, 0x74, 0x14, 0xaf, 0xac, 0x0e, 0x3b, 0x35, 0xa3,
+  0xbc, 0xda, 0x08, 0x1a, 0x54, 0x4b, 0xed, 0x50, 0x1b, 0x35, 0xa6, 0xd0, 0x28, 0x56, 0x90, 0x40,
+  0x9f, 0xc9, 0x1d, 0x4d, 0x5a, 0x85, 0x9c, 0x10, 0x41, 0xf7, 0x56, 0x21, 0xcb, 0x1a, 0x8a, 0x5e,
+  0x99, 0xa0, 0xf0, 0x7a, 0xb7, 0x61, 0xa2, 0x6d, 0x0a, 0x1a, 0x29, 0xec, 0xc2, 0x05, 0xfb, 0xfa,
+  0x4b, 0x03, 0xdf, 0x0d, 0x9c, 0x85, 0xc6, 0x52, 0x15, 0x84, 0x2b, 0x5b, 0xa3, 0xb1, 0xf7, 0x4f,
+  0xf4, 0x21, 0x9b, 0x7d, 0x3b, 0x75, 0x0b, 0x96, 0xc9, 0xd6, 0x5e, 0x33, 0xd1, 0x5a, 0x6a, 0x62,
+  0x5b, 0xe5, 0xed, 0x05, 0x29, 0x7a, 0xd5, 0x04, 0xf9, 0x33, 0x4c, 0xde, 0x85, 0x16, 0x4d, 0x5f,
+  0x52, 0x3b, 0x58, 0x1b, 0xbe, 0xb2, 0xbb, 0xbf, 0x69, 0x76, 0xd8, 0x25, 0x18, 0x71, 0x0b, 0x7b,
+  0x3c, 0x5d, 0x97, 0xc3, 0xbe, 0xa0, 0xfa, 0x49, 0xcb, 0x56, 0x75, 0x6a, 0x73, 0x30, 0x31, 0x0c,
+  0xf0, 0x76, 0xa5, 0x76, 0x8b, 0x12, 0xa7, 0xb1, 0x59, 0xb4, 0xc3, 0x1a, 0x0e, 0x55, 0x2c, 0x87,
+  0xd0, 0xb8, 0x5f, 0x7c, 0x9f, 0x87, 0xb9, 0x01, 0x56, 0xb4, 0x5f, 0xbf, 0xba, 0x7b, 0xeb, 0x94,
+  0x52, 0xe5, 0x7a, 0x9d, 0x47, 0x2a, 0x33, 0x50, 0x66, 0x97, 0xe7, 0xf4, 0xd8, 0x86, 0x9d, 0x06,
+  0x07, 0xf9, 0x35, 0xae, 0xd3, 0xf1, 0x64, 0xb8, 0xd1, 0x8d, 0xeb, 0x14, 0x5d, 0xeb, 0x73, 0x0b,
+  0x03, 0xe4, 0x46, 0xcf, 0xf4, 0xe3, 0x61, 0x58, 0xa8, 0x08, 0xca, 0xa1, 0x39, 0x58, 0x04, 0xaf,
+  0x16, 0xa4, 0x00, 0x8a, 0xe0, 0x86, 0x92, 0x0a, 0x39, 0xf1, 0xa3, 0x4e, 0x29, 0x2d, 0x27, 0x1a,
+  0xca, 0x76, 0x02, 0x6f, 0x1c, 0x74, 0x6d, 0xe5, 0x28, 0x8a, 0x31, 0x22, 0x9a, 0x91, 0x64, 0xca,
+  0xaa, 0x8a, 0x42, 0xac, 0x58, 0xdd, 0x6e, 0xf7, 0xe5, 0x2b, 0x80, 0x9a, 0x71, 0xbe, 0xbe, 0x9d,
+  0x7e, 0x08, 0x7d, 0x31, 0xdb, 0x28, 0xb4, 0x0a, 0x3e, 0xe6, 0x3c, 0x6f, 0x37, 0x6e, 0x88, 0xfc,
+  0xf8, 0xbe, 0x67, 0x9d, 0x52, 0x95, 0xc6, 0xb7, 0x8c, 0x38, 0xf3, 0xf4, 0xeb, 0x68, 0xf7, 0x45,
+  0x34, 0x8d, 0x6f, 0x50, 0xa9, 0x7f, 0x25, 0xfe, 0x1f, 0x73, 0x59, 0xf2, 0x34, 0x22, 0x0f, 0x00,
+  0x00,
+};
@@ -0,0 +1,188 @@
+#pragma once
+#include "platform.h"
+
+// Pull parser for small JSON documents in memory (no heap, no tree).
+// The caller walks the document it expects and skips the rest:
+//
+//   JsonReader r(body, len);
+//   char key[16];
+//   if (!r.beginObject()) ...
+//   while (r.nextKey(key, sizeof(key))) {
+//     if (!strcmp(key, "hp")) r.readInt(hp);
+//     else                    r.skip();
+//   }
+//   if (!r.done()) ...  // malformed, or trailing garbage
+//
+// Any error sticks: later calls fail and ok() turns false. Numbers are
+// read as integers (a fraction is dropped); \u escapes other than ASCII
+// read as '?'.
+class JsonReader {
+ public:
+  JsonReader(const char* data, size_t length) : p(data), end(data + length) {}
+
+  // Consumes '{'; then call nextKey() until it returns false
+  bool beginObject() {
+    if (!expect('{')) return false;
+    if (depth >= MAX_DEPTH) return fail();
+    first |= 1u << depth++;
+    return true;
+  }
+
+  // Next member's key, positioned at its value; false at the closing '}'
+  bool nextKey(char* key, size_t size) {
+    if (failed || !depth) return false;
+    ws();
+    uint32_t bit = 1u << (depth - 1);
+    if (p < end && *p == '}') {
+      p++;
+      depth--;
+      return false;
+    }
+    if (!(first & bit) && !expect(',')) return false;
+    first &= ~bit;
+    return readString(key, size) && expect(':');
+  }
+
+  bool readInt(int32_t& v) {
+    ws();
+    bool neg = p < end && *p == '-';
+    if (neg) p++;
+    if (p >= end || *p < '0' || *p > '9') return fail();
+    uint32_t n = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+      n = n * 10 + (*p++ - '0');
+      if (n > 0x7FFFFFFF) return fail();
+    }
+    while (p < end && (*p == '.' || *p == 'e' || *p == 'E' || *p == '+' || *p == '-' ||
+                       (*p >= '0' && *p <= '9'))) p++;
+    v = neg ? -(int32_t)n : (int32_t)n;
+    return true;
+  }
+
+  bool readBool(bool& v) {
+    ws();
+    if (literal("true"))  { v = true;  return true; }
+    if (literal("false")) { v = false; return true; }
+    return fail();
+  }
+
+  // Truncated to size - 1 characters, always terminated
+  bool readString(char* out, size_t size) {
+    if (!expect('"')) return false;
+    size_t n = 0;
+    while (p < end && *p != '"') {
+      char c = *p++;
+      if (c == '\\') {
+        if (p >= end) return fail();
+        c = *p++;
+        switch (c) {
+          case 'n': c = '\n'; break;
+          case 't': c = '\t'; break;
+          case 'r': c = '\r'; break;
+          case 'b': c = '\b'; break;
+          case 'f': c = '\f'; break;
+          case 'u': {
+            if (end - p < 4) return fail();
+            uint16_t u = 0;
+            for (int i = 0; i < 4; i++) {
+              int d = hexDigit(*p++);
+              if (d < 0) return fail();
+              u = u << 4 | d;
+            }
+            c = u < 0x80 ? (char)u : '?';
+            break;
+          }
+          default: break;  // \" \\ \/
+        }
+      }
+      if (n + 1 < size) out[n++] = c;
+    }
+    if (size) out[n] = 0;
+    return expect('"');
+  }
+
+  // Skips one value of any type
+  bool skip() {
+    ws();
+    if (p >= end) return fail();
+    char tmp[1];
+    int32_t i;
+    bool b;
+    switch (*p) {
+      case '"': return readString(tmp, sizeof(tmp));
+      case '{': {
+        if (!beginObject()) return false;
+        char key[1];
+        while (nextKey(key, sizeof(key))) {
+          if (!skip()) return false;
+        }
+        return !failed;
+      }
+      case '[': {
+        if (depth >= MAX_DEPTH) return fail();
+        p++;
+        depth++;
+        ws();
+        if (p < end && *p == ']') { p++; depth--; return true; }
+        for (;;) {
+          if (!skip()) return false;
+          ws();
+          if (p < end && *p == ',') { p++; continue; }
+          depth--;
+          return expect(']');
+        }
+      }
+      case 't': case 'f': return readBool(b);
+      case 'n': return literal("null") || fail();
+      default:  return readInt(i);
+    }
+  }
+
+  bool ok() const { return !failed; }
+
+  // Whole document read, nothing but whitespace after it
+  bool done() {
+    ws();
+    return !failed && !depth && p == end;
+  }
+
+ private:
+  static constexpr uint8_t MAX_DEPTH = 8;
+
+  void ws() {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) p++;
+  }
+
+  bool expect(char c) {
+    if (failed) return false;
+    ws();
+    if (p >= end || *p != c) return fail();
+    p++;
+    return true;
+  }
+
+  bool literal(const char* s) {
+    size_t n = strlen(s);
+    if ((size_t)(end - p) < n || memcmp(p, s, n) != 0) return false;
+    p += n;
+    return true;
+  }
+
+  static int hexDigit(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+  }
+
+  bool fail() {
+    failed = true;
+    return false;
+  }
+
+  const char* p;
+  const char* end;
+  uint32_t    first  = 0;   // bit per open object: no member read yet
+  uint8_t     depth  = 0;
+  bool        failed = false;
+};
@@ -0,0 +1,105 @@
+#pragma once
+#include "platform.h"
+
+// Small JSON writer on a caller-owned buffer (no heap).
+// When a sink is given, a full buffer is flushed to it and writing
+// continues, so documents larger than the buffer can be streamed out.
+// Without a sink, output that does not fit is dropped and overflowed()
+// reports it.
+class JsonWriter {
+ public:
+  JsonWriter(char* buffer, size_t capacity, Print* sink = nullptr)
+    : buf(buffer), cap(capacity), len(0), out(sink), needComma(false), overflow(false) {}
+
+  void beginObject(const char* key = nullptr) { open(key, '{'); }
+  void endObject()                            { close('}'); }
+  void beginArray(const char* key = nullptr)  { open(key, '['); }
+  void endArray()                             { close(']'); }
+
+  void addUInt(const char* key, uint32_t v)   { prefix(key); putUInt(v); }
+  void addInt(const char* key, int32_t v)     { prefix(key); putInt(v); }
+  void addBool(const char* key, bool v)       { prefix(key); putRaw(v ? "true" : "false"); }
+  void addStr(const char* key, const char* v) { prefix(key); putString(v); }
+  // Pre-formatted JSON (number/literal) written as-is
+  void addRaw(const char* key, const char* v) { prefix(key); putRaw(v); }
+
+  // Array elements
+  void valueUInt(uint32_t v)    { addUInt(nullptr, v); }
+  void valueStr(const char* v)  { addStr(nullptr, v); }
+
+  // Push whatever is buffered to the sink
+  void flush() {
+    if (out && len) out->write((const uint8_t*)buf, len);
+    if (out) len = 0;
+  }
+
+  const char* data() const { return buf; }
+  size_t length() const    { return len; }
+  bool overflowed() const  { return overflow; }
+
+ private:
+  char*  buf;
+  size_t cap;
+  size_t len;
+  Print* out;
+  bool   needComma;
+  bool   overflow;
+
+  void putChar(char c) {
+    if (len >= cap) {
+      if (!out) { overflow = true; return; }
+      flush();
+    }
+    buf[len++] = c;
+  }
+
+  void putRaw(const char* s) {
+    while (*s) putChar(*s++);
+  }
+
+  void putUInt(uint32_t v) {
+    char tmp[10];
+    int n = 0;
+    do { tmp[n++] = '0' + (v % 10); v /= 10; } while (v);
+    while (n) putChar(tmp[--n]);
+  }
+
+  void putInt(int32_t v) {
+    if (v < 0) { putChar('-'); putUInt((uint32_t)0 - (uint32_t)v); }
+    else       { putUInt((uint32_t)v); }
+  }
+
+  void putString(const char* s) {
+    static const char hex[] = "0123456789abcdef";
+    putChar('"');
+    for (; *s; ++s) {
+      char c = *s;
+      if (c == '"' || c == '\\') { putChar('\\'); putChar(c); }
+      else if ((uint8_t)c < 0x20) {
+        putRaw("\\u00");
+        putChar(hex[(c >> 4) & 0xF]);
+        putChar(hex[c & 0xF]);
+      } else {
+        putChar(c);
+      }
+    }
+    putChar('"');
+  }
+
+  void prefix(const char* key) {
+    if (needComma) putChar(',');
+    if (key) { putString(key); putChar(':'); }
+    needComma = true;
+  }
+
+  void open(const char* key, char bracket) {
+    prefix(key);
+    putChar(bracket);
+    needComma = false;
+  }
+
+  void close(char bracket) {
+    putChar(bracket);
+    needComma = true;
+  }
+};
@@ -0,0 +1,211 @@
+#pragma once
+#include "platform.h"
+#include <atomic>
+#include <type_traits>
+
+// Leveled logging that never waits for the UART.
+//
+//   LOGI(ALARM, "buzzer ON");
+//   LOGD(PARTY, "step %u, period %u us", step, periodUs);
+//
+// A call only stores the format, its arguments and a timestamp in a
+// lock-free ring (LogRing); a background task formats and prints them.
+// So the format must be a string literal, and arguments are integers of
+// up to 32 bits, chars or static strings (pointers are kept, not the text),
+// at most LOG_MAX_ARGS, for %d %i %c %u %x %X %o %s and %p conversions
+// (flags, width and precision are fine; length modifiers are ignored).
+//
+// Levels are compile time: a call above LOG_MAX_LEVEL or above its
+// module's LOG_LEVEL_<MODULE> (a constexpr the program defines per module)
+// is compiled out, format string included. Release builds pass e.g.
+// -DLOG_MAX_LEVEL=2 to keep only warnings and errors.
+
+enum : uint8_t { LOG_LVL_NONE, LOG_LVL_ERROR, LOG_LVL_WARN, LOG_LVL_INFO, LOG_LVL_DEBUG };
+
+#ifndef LOG_MAX_LEVEL
+#define LOG_MAX_LEVEL LOG_LVL_DEBUG
+#endif
+
+#define LOG_AT(level, mod, ...)                                              \
+  do {                                                                       \
+    if ((level) <= LOG_MAX_LEVEL && (level) <= LOG_LEVEL_##mod)              \
+      logPush(level, #mod, __VA_ARGS__);                                     \
+  } while (0)
+
+#define LOGE(mod, ...) LOG_AT(LOG_LVL_ERROR, mod, __VA_ARGS__)
+#define LOGW(mod, ...) LOG_AT(LOG_LVL_WARN,  mod, __VA_ARGS__)
+#define LOGI(mod, ...) LOG_AT(LOG_LVL_INFO,  mod, __VA_ARGS__)
+#define LOGD(mod, ...) LOG_AT(LOG_LVL_DEBUG, mod, __VA_ARGS__)
+
+constexpr uint8_t LOG_MAX_ARGS = 4;
+
+struct LogRecord {
+  uint32_t    ms;
+  const char* module;
+  const char* fmt;
+  uintptr_t   args[LOG_MAX_ARGS];
+  uint8_t     level;
+};
+
+// Hands a record to the program's ring; defined by the program
+void logSubmit(const LogRecord& r);
+
+inline uintptr_t logArg(const char* s) { return (uintptr_t)s; }
+template <typename T>
+inline uintptr_t logArg(T v) {
+  static_assert(std::is_integral<T>::value || std::is_enum<T>::value,
+                "log arguments are integers or static strings");
+  static_assert(sizeof(T) <= sizeof(uint32_t), "log arguments are 32 bits at most");
+  return (uintptr_t)v;  // sign-extended, so (int) gives a negative back
+}
+
+template <typename... Args>
+inline void logPush(uint8_t level, const char* module, const char* fmt, Args... args) {
+  static_assert(sizeof...(Args) <= LOG_MAX_ARGS, "too many log arguments");
+  LogRecord r = { (uint32_t)millis(), module, fmt, { logArg(args)... }, level };
+  logSubmit(r);
+}
+
+// r.fmt with its arguments, one conversion at a time: each gets its slot as
+// the type the conversion reads (int, unsigned or a pointer), never a
+// uintptr_t through varargs. Returns the length (truncated to size - 1).
+inline size_t logExpand(const LogRecord& r, char* out, size_t size) {
+  size_t      len  = 0;
+  uint8_t     next = 0;
+  const char* p    = r.fmt;
+  while (*p && len + 1 < size) {
+    if (*p != '%' || p[1] == '%') {
+      out[len++] = *p;
+      p += (*p == '%') ? 2 : 1;
+      continue;
+    }
+    const char* start = p++;
+    char   spec[16] = "%";
+    size_t n = 1;
+    for (; *p && strchr("-+ #0123456789.hlLjzt", *p); p++) {
+      if (!strchr("hlLjzt", *p) && n < sizeof(spec) - 2) spec[n++] = *p;
+    }
+    if (!*p) break;
+    char conv = *p++;
+    spec[n++] = conv;
+    spec[n]   = 0;
+
+    auto arg = [&] { return next < LOG_MAX_ARGS ? r.args[next++] : (uintptr_t)0; };
+    const char* s;
+    int m;
+    switch (conv) {
+      case 'd': case 'i': case 'c':           m = snprintf(out + len, size - len, spec, (int)(intptr_t)arg()); break;
+      case 'u': case 'x': case 'X': case 'o': m = snprintf(out + len, size - len, spec, (unsigned)arg()); break;
+      case 'p': m = snprintf(out + len, size - len, spec, (void*)arg()); break;
+      case 's':
+        s = (const char*)arg();
+        m = snprintf(out + len, size - len, spec, s ? s : "(null)");
+        break;
+      default:  // not ours to read (%f, %*d, ...): the text as written
+        m = snprintf(out + len, size - len, "%.*s", (int)(p - start), start);
+        break;
+    }
+    if (m > 0) len = min(len + (size_t)m, size - 1);
+  }
+  out[len] = 0;
+  return len;
+}
+
+// "[  12.345] I ALARM: buzzer ON\n"; returns the length (truncated to size - 1)
+inline size_t logFormat(const LogRecord& r, char* out, size_t size) {
+  static const char LEVEL_CHARS[] = "-EWID";
+  int n = snprintf(out, size, "[%6u.%03u] %c %s: ", (unsigned)(r.ms / 1000), (unsigned)(r.ms % 1000),
+                   LEVEL_CHARS[r.level < sizeof(LEVEL_CHARS) - 1 ? r.level : 0], r.module);
+  if (n < 0 || (size_t)n >= size) return size - 1;
+  size_t len = min((size_t)n + logExpand(r, out + n, size - n), size - 2);
+  out[len++] = '\n';
+  out[len]   = 0;
+  return len;
+}
+
+// Bounded multi-producer / single-consumer ring, lock-free: any task may
+// push (each slot carries a sequence number that says whose turn it is);
+// one task pops. A full ring drops the record and counts it.
+// N must be a power of two.
+template <uint16_t N>
+class LogRing {
+  static_assert((N & (N - 1)) == 0, "N must be a power of two");
+
+ public:
+  LogRing() {
+    for (uint16_t i = 0; i < N; i++) slots[i].seq.store(i, std::memory_order_relaxed);
+  }
+
+  bool push(const LogRecord& r) {
+    uint32_t pos = head.load(std::memory_order_relaxed);
+    for (;;) {
+      Slot& s = slots[pos & (N - 1)];
+      int32_t diff = (int32_t)(s.seq.load(std::memory_order_acquire) - pos);
+      if (diff == 0) {
+        if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          s.rec = r;
+          s.seq.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      } else {
+        pos = head.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Consumer side
+  bool pop(LogRecord& r) {
+    Slot& s = slots[tail & (N - 1)];
+    if (s.seq.load(std::memory_order_acquire) != tail + 1) return false;
+    r = s.rec;
+    s.seq.store(tail + N, std::memory_order_release);
+    tail++;
+    return true;
+  }
+
+  std::atomic<uint32_t> dropped{0};
+
+ private:
+  struct Slot {
+    std::atomic<uint32_t> seq;
+    LogRecord             rec;
+  };
+  Slot                  slots[N];
+  std::atomic<uint32_t> head{0};
+  uint32_t              tail = 0;
+};
+
+// The last N bytes of formatted log text, for reading over HTTP. Offsets
+// count every byte ever appended, so a reader passes back the offset it
+// got to and receives only what is new (or the oldest kept text, if it
+// fell behind).
+template <size_t N>
+class LogHistory {
+ public:
+  void append(const char* s, size_t len) {
+    for (size_t i = 0; i < len; i++) buf[(end + i) % N] = s[i];
+    end += len;
+  }
+
+  // Writes the text from `from` on; returns the offset to continue at
+  uint32_t read(uint32_t from, Print& out) const {
+    uint32_t first = end > N ? end - N : 0;
+    if (from < first || from > end) from = first;
+    while (from < end) {
+      size_t at    = from % N;
+      size_t chunk = min((size_t)(end - from), N - at);
+      out.write((const uint8_t*)buf + at, chunk);
+      from += chunk;
+    }
+    return end;
+  }
+
+  uint32_t offset() const { return end; }
+
+ private:
+  char     buf[N];
+  uint32_t end = 0;
+};
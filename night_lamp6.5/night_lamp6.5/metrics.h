@@ -0,0 +1,88 @@
+#pragma once
+#include "platform.h"
+#include <atomic>
+
+// Telemetry primitives for /metrics (Prometheus text format 0.0.4).
+//
+// Histogram::add() is a short scan over a few bounds and two adds, cheap
+// enough for every loop pass, frame and request. Counts are stored per
+// bucket and made cumulative only when written out.
+//
+// Each histogram has one writer task, and /metrics reads it from another.
+// The 32-bit counts are read whole; the 64-bit sum is atomic, as the
+// ESP32-S2 would move it in two halves (a short critical section there).
+
+template <size_t N>
+class Histogram {
+ public:
+  explicit Histogram(const uint32_t (&upperBounds)[N]) : bounds(upperBounds) {}
+
+  void add(uint32_t v) {
+    size_t i = 0;
+    while (i < N && v > bounds[i]) i++;
+    counts[i]++;
+    sum.fetch_add(v, std::memory_order_relaxed);
+  }
+
+  void reset() {
+    memset((void*)counts, 0, sizeof(counts));
+    sum.store(0, std::memory_order_relaxed);
+  }
+
+  uint32_t bound(size_t i) const  { return bounds[i]; }
+  uint32_t bucket(size_t i) const { return counts[i]; }  // i == N: above all bounds
+  uint64_t total() const          { return sum.load(std::memory_order_relaxed); }
+
+ private:
+  const uint32_t (&bounds)[N];
+  volatile uint32_t counts[N + 1] = {};
+  std::atomic<uint64_t> sum{0};
+};
+
+// Writes metric families to a Print (e.g. an AsyncResponseStream)
+class PromWriter {
+ public:
+  explicit PromWriter(Print& sink) : out(sink) {}
+
+  void counter(const char* name, const char* help, uint64_t v) {
+    header(name, help, "counter");
+    line("%s %llu\n", name, (unsigned long long)v);
+  }
+
+  void gauge(const char* name, const char* help, int64_t v) {
+    header(name, help, "gauge");
+    line("%s %lld\n", name, (long long)v);
+  }
+
+  // Histogram in microseconds, exported in seconds as Prometheus expects
+  template <size_t N>
+  void histogramUs(const char* name, const char* help, const Histogram<N>& h) {
+    header(name, help, "histogram");
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < N; i++) {
+      cumulative += h.bucket(i);
+      line("%s_bucket{le=\"%lu.%06lu\"} %llu\n", name,
+           (unsigned long)(h.bound(i) / 1000000), (unsigned long)(h.bound(i) % 1000000),
+           (unsigned long long)cumulative);
+    }
+    cumulative += h.bucket(N);
+    line("%s_bucket{le=\"+Inf\"} %llu\n", name, (unsigned long long)cumulative);
+    uint64_t sum = h.total();  // once: the writer may add in between
+    line("%s_sum %lu.%06lu\n", name, (unsigned long)(sum / 1000000), (unsigned long)(sum % 1000000));
+    line("%s_count %llu\n", name, (unsigned long long)cumulative);
+  }
+
+ private:
+  void header(const char* name, const char* help, const char* type) {
+    line("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+  }
+
+  template <typename... Args>
+  void line(const char* fmt, Args... args) {
+    char buf[160];
+    int n = snprintf(buf, sizeof(buf), fmt, args...);
+    if (n > 0) out.write((const uint8_t*)buf, min((size_t)n, sizeof(buf) - 1));
+  }
+
+  Print& out;
+};
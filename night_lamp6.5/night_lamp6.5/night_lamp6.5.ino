@@ -5,24 +5,49 @@
    - Alarms with configurable sunrise ramp + alarm type (LED / beeper)
    - Time from browser (no RTC)
    - Default state in flash
-   - Party mode + music sync (sound sensor on pin 6)
+   - Party mode + music sync (sound sensor on pin 6, beat tracking)
+   - Party effects from a registry (per-pixel, rendered every frame)
    - Alarm ramp test from Advanced Settings
+   - Async web server; WebSocket push channel on /ws (state events + binary control)
+   - Fixed-rate render task owns the pixels and HP LED; layered compositor
+   - Timers (alarms, buzzer, party steps) on a deadline scheduler; loop() sleeps in between
+   - Leveled log through a RAM ring: printed by a background task, readable on /log
 
    Pins (change here if needed):
-     rgbPin    = 3  (WS2812 / NeoPixel ring)
+     rgbPin    = 3  (WS2812 / NeoPixel ring, driven by RMT)
      boostPin  = 1  (boost converter enable for HP LED)
-     pwmPin    = 2  (HP LED PWM, analogWrite)
+     pwmPin    = 2  (HP LED PWM, LEDC 13-bit + hardware fade)
      buttonPin = 4  (state / cancel button, active LOW)
-     soundPin  = 6  (digital sound sensor, HIGH on beat)
+     soundPin  = 6  (digital sound sensor, HIGH on beat; edge interrupt)
      buzzerPin = 7  (active buzzer, HIGH = ON)
 */
 
 #include <Arduino.h>
 #include <WiFi.h>
-#include <WebServer.h>
+#include <AsyncTCP.h>
+#include <ESPAsyncWebServer.h>
 #include <Adafruit_NeoPixel.h>
 #include <Preferences.h>
 #include <time.h>
+#include <driver/ledc.h>
+#include <esp_system.h>
+#include <esp_rom_crc.h>
+
+#include "json_writer.h"
+#include "json_reader.h"
+#include "gamma_lut.h"
+#include "clock.h"
+#include "scheduler.h"
+#include "alarm_calendar.h"
+#include "pixel_out.h"
+#include "spsc_ring.h"
+#include "tempo_tracker.h"
+#include "bench.h"
+#include "metrics.h"
+#include "trace.h"
+#include "log.h"
+#include "compositor.h"
+#include "party_effects.h"
 
 #include "index_html.h"
 #include "alarms_html.h"
@@ -38,20 +63,78 @@ const int soundPin  = 6;
 const int buzzerPin = 7;
 
 // ---------------- NeoPixel ----------------
+// pixels is only the frame buffer (colors, brightness, GRB order); its
+// blocking show() is never called. pixelOut puts frames on the wire.
 const int numPixels = 9;
 Adafruit_NeoPixel pixels(numPixels, rgbPin, NEO_GRB + NEO_KHZ800);
+RmtPixelOut<numPixels * 3> pixelOut;
 
 // ---------------- Web server ----------------
-WebServer server(80);
+AsyncWebServer server(80);
+AsyncWebSocket ws("/ws");
+
+const size_t STATE_BODY_MAX = 512;  // POST /state
+
+// Spans of the last requests, for Server-Timing and /trace (trace.h)
+const size_t TRACE_SPANS = 32;
+typedef RequestTrace<TRACE_SPANS> Tracer;
+Tracer tracer;
+
+// ---------------- State lock ----------------
+// The async server runs handlers on the AsyncTCP task. Everything that
+// touches lamp state holds this lock; loop() holds it for its whole body,
+// so a handler runs either between two loop iterations or not at all.
+SemaphoreHandle_t stateMutex = nullptr;
+
+struct StateLock {
+  StateLock()  { xSemaphoreTakeRecursive(stateMutex, portMAX_DELAY); }
+  ~StateLock() { xSemaphoreGiveRecursive(stateMutex); }
+};
+
+// ---------------- Logging ----------------
+// LOGx() calls (log.h) only queue a record; logTask prints it and keeps
+// the text for /log. Per-module levels; calls above them are compiled out.
+constexpr uint8_t LOG_LEVEL_SYS    = LOG_LVL_INFO;
+constexpr uint8_t LOG_LEVEL_NVS    = LOG_LVL_INFO;
+constexpr uint8_t LOG_LEVEL_TIME   = LOG_LVL_INFO;
+constexpr uint8_t LOG_LEVEL_BUTTON = LOG_LVL_INFO;
+constexpr uint8_t LOG_LEVEL_ALARM  = LOG_LVL_INFO;
+constexpr uint8_t LOG_LEVEL_LOG    = LOG_LVL_WARN;
+
+const UBaseType_t LOG_PRIO = 1;  // with loop(); the UART only ever stalls this task
+LogRing<64>      logRing;
+LogHistory<2048> logHistory;     // under the state lock
+TaskHandle_t     logTaskHandle = nullptr;
+
+void logSubmit(const LogRecord& r) {
+  if (logRing.push(r) && logTaskHandle) xTaskNotifyGive(logTaskHandle);
+}
+
+// Worst loop() iteration during the last full second (microseconds)
+uint32_t loopMaxUs = 0;
+
+// Latency histograms for /metrics (metrics.h), bucket bounds in us
+const uint32_t LOOP_BOUNDS_US[]    = { 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 100000 };
+const uint32_t HANDLER_BOUNDS_US[] = { 50, 100, 250, 500, 1000, 2500, 5000, 10000, 50000 };
+const uint32_t SHOW_BOUNDS_US[]    = { 25, 50, 100, 200, 400, 800, 1600 };
+Histogram loopHist(LOOP_BOUNDS_US);        // loop() iterations, sleep excluded
+Histogram handlerHist(HANDLER_BOUNDS_US);  // web handlers, lock held
+Histogram showHist(SHOW_BOUNDS_US);        // pixelOut.show(): encode + start
 
 // ---------------- Internal time (no RTC) ----------------
+// Schedule and calendar time come from clk (clock.h) so they can be
+// warped for testing; see /clock.
+Clock clk;
+uint32_t clockMs() { return clk.ms(); }
+const uint32_t CLOCK_WARP_MAX_MS = 7UL * 86400 * 1000;
+
 volatile uint32_t baseEpoch   = 0;  // UTC epoch seconds at last sync
-volatile uint32_t baseMillis  = 0;  // millis() at last sync
+volatile uint32_t baseMillis  = 0;  // clk.ms() at last sync
 volatile int32_t  tzOffsetMin = 0;  // minutes; browser getTimezoneOffset()
 
 uint32_t nowEpochUTC() {
   if (baseEpoch == 0) return 0;
-  uint32_t elapsed = (millis() - baseMillis) / 1000;
+  uint32_t elapsed = (clk.ms() - baseMillis) / 1000;
   return baseEpoch + elapsed;
 }
 
@@ -73,18 +156,48 @@ uint8_t webR = 255, webG = 255, webB = 255, webBri = 255;
 uint8_t webHighPower = 0; // 0..255
 
 // ---------------- Alarm list ----------------
+// RAM form; see "NVS: alarms" for the stored records
 struct AlarmItem {
-  uint32_t id;
+  uint16_t id;           // nonzero, unique
   uint8_t  hour;
   uint8_t  minute;
   uint8_t  daysMask;     // bit0=Sun..bit6=Sat; 0 = everyday
   bool     enabled;
-  uint32_t lastFireMin;  // kept for compatibility; not heavily used now
+  uint16_t date;         // one-shot: local day (days since 1970); 0 = weekly
+};
+
+// "Not on this date" exception for a weekly alarm
+struct AlarmSkip {
+  uint16_t id;
+  uint16_t day;          // local day (days since 1970)
 };
 
-static const int MAX_ALARMS = 8;
-AlarmItem alarms[MAX_ALARMS];
+static const int MAX_ALARMS      = 256;
+static const int MAX_ALARM_SKIPS = 32;
+AlarmItem alarms[MAX_ALARMS];   // unordered; delete moves the last one in
 int alarmCount = 0;
+AlarmSkip alarmSkips[MAX_ALARM_SKIPS];
+int alarmSkipCount = 0;
+
+// Stored form (see "NVS: alarms")
+const char    ALARM_BLOB_KEY[]  = "alarmRec";
+const uint8_t ALARM_REC_VERSION = 2;
+const size_t  ALARM_BLOB_MAX    = 4 + MAX_ALARMS * 6 + MAX_ALARM_SKIPS * 4 + 4;
+
+// Next-fire index over the list above (slot = index into alarms[]).
+// The next fire is cached and only recomputed after alarm list, clock or
+// timezone changes, or once it has fired.
+typedef AlarmCalendar<MAX_ALARMS, MAX_ALARM_SKIPS> AlarmCal;
+
+struct NextFire {
+  AlarmCal::Fire fire      = { 0, 0 };
+  bool           valid     = false;
+  bool           found     = false;
+  uint32_t       lastFired = 0;  // local epoch; an occurrence never fires twice
+};
+
+AlarmCal alarmCal;
+NextFire nextFire;
 
 // ---------------- Alarm behavior & ramp ----------------
 Preferences prefs;
@@ -106,7 +219,7 @@ uint32_t alarmTimeoutSec  = 600;   // seconds after alarm time to auto-stop (def
 // Active alarm / test state
 bool     alarmActive          = false;  // true if either real alarm or test ramp running
 bool     alarmIsTest          = false;  // true if this is ramp test, false if real alarm
-bool     beepStarted          = false;  // for real alarms only
+bool     beepStarted          = false;  // alarm time reached / test ramp at full
 uint32_t alarmStartMs         = 0;      // used for test ramp
 uint32_t alarmTestDurationMs  = 0;      // used for test ramp
 uint32_t sunriseBeepEpochLocal  = 0;    // local epoch when alarm time is reached
@@ -115,7 +228,7 @@ uint32_t sunriseStartEpochLocal = 0;    // local epoch when ramp should be 0 ->
 // ---------------- Party / Music Sync ----------------
 bool    partyEnabled      = false;
 bool    musicSyncEnabled  = false;
-uint8_t partyEffect       = 0;   // 0=Fade,1=Strobe,2=Pulse
+uint8_t partyEffect       = 0;   // index into PARTY_EFFECTS
 uint8_t partySpeed        = 50;  // 0..100
 uint8_t partyBrightness   = 80;  // 0..100
 uint8_t partyColorMode    = 0;   // 0=RGB wheel,1=Random,2=Single color
@@ -123,22 +236,175 @@ uint8_t partySingleR      = 255;
 uint8_t partySingleG      = 0;
 uint8_t partySingleB      = 0;
 
-uint32_t lastPartyStepMs  = 0;
 uint16_t partyStep        = 0;
-bool     lastSoundLevel   = false;
+
+// Effect engine: the render task draws the selected effect every frame
+// between steps. Parameters are kept per effect, so switching back and
+// forth keeps each one's settings.
+uint8_t  partyParams[PARTY_EFFECT_COUNT][EFFECT_MAX_PARAMS];
+uint8_t  partyBaseR = 255, partyBaseG = 0, partyBaseB = 0; // color of the current step
+uint32_t partyStepUs       = 0;       // when the current beat started
+uint32_t partyBeatPeriodUs = 500000;  // expected length of the current beat
+uint32_t partyEffectMs     = 0;       // when the effect was selected
+int16_t  partyShownEffect  = -1;      // effect drawn last frame, -1 = none
+EffectState partyFxState;             // the party layer's effect state
+uint32_t effectLastUs      = 0;       // render cost of the last frame
+uint32_t effectMaxUs       = 0;
+uint32_t effectOverBudget  = 0;       // frames over their effect's budget
+uint32_t partyFrames       = 0;       // frames rendered by the effect engine
+uint32_t partyBeats        = 0;       // steps taken on a (heard or predicted) beat
+
+// Sound sensor rising edges, timestamped (micros) by an ISR and queued
+// for the render task. The sensor chatters during a loud sound, so edges
+// closer than SOUND_ONSET_GAP_US to the last onset belong to it.
+const uint32_t SOUND_ONSET_GAP_US = 80000;
+SpscRing<uint32_t, 64> soundEdges;
+uint32_t lastOnsetUs = 0;
+uint32_t soundOnsets = 0;
+
+// Onsets feed the tempo tracker; once it is locked, music-sync steps land
+// on predicted beats instead of trailing the sensor. A step is drawn in the
+// frame it is taken and on the wire right after, so it is taken up to half
+// a render period (plus the pixel transfer) before the beat.
+const uint32_t PARTY_BEAT_LEAD_US = 5300;  // 10 ms frames, ~0.3 ms of pixel data
+TempoTracker tempo;
+uint32_t partyBeatUs = 0;  // last predicted beat that was stepped
+
+// Bumped on every alarm list change so WebSocket clients can refetch
+uint16_t alarmListRev = 0;
+
+// ---------------- Scheduler ----------------
+// loop() runs whatever timer is due, then sleeps until the next deadline or
+// until woken (button ISR, web handlers, a timer armed earlier). Every
+// timed job owns one timer; all of them run under the state lock.
+const uint32_t LOOP_IDLE_MS         = 1000; // longest sleep (ws cleanup, loop stats)
+const uint32_t BUZZER_HALF_PERIOD_MS = 500;  // 0.5 s ON, 0.5 s OFF
+const uint32_t TEST_HOLD_MS          = 5000; // test ramp holds full this long
+
+TaskHandle_t loopTaskHandle = nullptr;
+void wakeLoop();
+Scheduler sched(wakeLoop, clockMs);
+
+int8_t alarmCheckTimer = -1;  // next ramp window opening (or midnight)
+int8_t alarmStageTimer = -1;  // alarm time, then timeout
+int8_t buzzerTimer     = -1;  // buzzer pattern toggle
+int8_t partyTimer      = -1;  // next party step (fallback step in music mode)
+
+bool buzzerOn    = false;     // pattern running
+bool buzzerLevel = false;     // pin level within the pattern
+
+// ---------------- Render task ----------------
+// Only the render task writes to the pixels / HP LED hardware. Everyone
+// else changes state and calls applyOutputs(), which just asks for a redraw.
+//
+// Each output source draws into its own compositor layer; higher layers
+// cover lower ones. The composed frame goes out once per frame, and only
+// when it differs from the last one.
+enum OutputLayer : uint8_t {
+  LAYER_BASE,    // currentState (always covers both)
+  LAYER_WEB,     // web override
+  LAYER_PARTY,   // party effects
+  LAYER_ALARM,   // sunrise / test: HP LED only
+  LAYER_NOTIFY,  // short confirmations: pixels only, fading out
+  LAYER_COUNT
+};
+typedef Compositor<numPixels, LAYER_COUNT> OutputCompositor;
+OutputCompositor compositor;
+
+const uint32_t RENDER_HZ        = 100;  // frames per second (divides 1000)
+const UBaseType_t RENDER_PRIO   = 5;    // above loop() and AsyncTCP
+TaskHandle_t renderTaskHandle   = nullptr;
+
+volatile bool outputsDirty = false;  // base / web layers need redrawing
+bool     pixelsDirty = false;        // pixel buffer changed since last show()
+
+// Notification layer: a color that fades out over notifyMs
+Rgb16    notifyColor   = { 0, 0, 0 };
+uint32_t notifyStartMs = 0;
+uint32_t notifyMs      = 0;
+
+// Frame start jitter against the ideal schedule, in microseconds.
+// Bucket i counts frames with jitter < RENDER_JITTER_BOUNDS_US[i];
+// the last bucket counts everything above the largest bound.
+const uint32_t RENDER_JITTER_BOUNDS_US[] = { 50, 100, 250, 500, 1000, 2000, 5000, 10000 };
+const int      RENDER_JITTER_BUCKETS = sizeof(RENDER_JITTER_BOUNDS_US) / sizeof(RENDER_JITTER_BOUNDS_US[0]) + 1;
+uint32_t renderJitterHist[RENDER_JITTER_BUCKETS];
+uint32_t renderFrames     = 0;
+uint32_t renderOverruns   = 0;   // frames that started a whole period late
+uint32_t renderJitterMax  = 0;
+uint32_t renderWorkMaxUs  = 0;   // longest frame (engines + show)
+uint32_t framesDropped    = 0;   // composed frames replaced before reaching the wire
+
+// ---------------- Brightness curves ----------------
+// Compile-time tables from gamma_lut.h. Brightness (HP LED, pixel
+// brightness) uses CIE L* for even perceived steps; pixel color channels
+// use gamma 2.2 so browser (sRGB) colors look right on the LEDs.
+constexpr LightCurve HP_CURVE     = LightCurve::CieL;
+constexpr LightCurve BRIGHT_CURVE = LightCurve::CieL;
+constexpr LightCurve COLOR_CURVE  = LightCurve::Gamma22;
+
+// ---------------- HP LED (LEDC) ----------------
+// The HP LED has its own LEDC channel/timer at 13 bits (the most that fits
+// 5 kHz on the 80 MHz clock). Sunrise ramps are cut into piecewise-linear
+// segments along the gamma curve and handed to the LEDC fade unit, so the
+// CPU only touches the PWM once per segment.
+const uint8_t  HP_LEDC_CHANNEL  = 0;
+const uint32_t HP_PWM_FREQ      = 5000;  // Hz
+const uint8_t  HP_PWM_BITS      = 13;
+const uint32_t HP_DUTY_MAX      = (1UL << HP_PWM_BITS) - 1;
+const int      HP_RAMP_SEGMENTS = 32;
+
+struct HpRamp {
+  bool     active;
+  uint32_t startMs;     // clk.ms() at ramp level 0
+  uint32_t durationMs;  // time to full brightness
+  int      segment;     // segment running in the fade unit, -1 = none
+};
+HpRamp   hpRamp      = { false, 0, 0, -1 };
+uint32_t hpShownDuty = 0;                  // duty currently on the pin
 
 // ---------------- Forward declarations ----------------
 void applyOutputs();
+void drawOutputs();
+void presentPixels();
+void notifyFlash(uint8_t r, uint8_t g, uint8_t b, uint32_t ms);
+void notifyRender();
+void alarmHp(uint16_t level);
+void renderTask(void* arg);
 void applyStateOutputs();
 void applyWebOutputs();
-void checkAlarms();
+uint32_t checkAlarms();
+void rebuildAlarmIndex();
+void expireOneShots(uint32_t epochLocal);
+void refreshNextFire(uint32_t epochLocal);
+void alarmListChanged();
+void kickAlarmCheck();
+void alarmCheckTick();
 void startSunrise(uint32_t alarmEpochLocal);
-void updateRealAlarm();
-void updateTestRamp();
+void alarmStageTick();
+void setBuzzer(bool active);
+void buzzerTick();
 void stopAlarm();
-void runPartyMode();
+void partyKick();
+void partyTick();
+void partyTakeSound();
+void partyBeatClock(uint32_t nowUs);
+void partyRender();
+void partyParamDefaults();
+bool partySetParam(uint8_t effect, uint8_t index, int value);
+void writeMetrics(PromWriter& w);
+void formatServerTiming(const TraceSpan& span, char* out, size_t size);
+bool hasArg(AsyncWebServerRequest* request, const char* key);
+const String& arg(AsyncWebServerRequest* request, const char* key);
+void writeTrace(JsonWriter& w);
+void logTask(void* arg);
+void logOut(const LogRecord& r, char* line, size_t size);
+void writePartyParams(JsonWriter& w);
+void writePartyEffects(JsonWriter& w);
+void partyStepNow(bool beat);
 uint32_t colorWheel(uint8_t pos);
-uint8_t gamma8(uint8_t x);
+uint16_t hpLevel(uint8_t x);
+Rgb16 levelColor(uint8_t r, uint8_t g, uint8_t b, uint8_t bri);
 
 void loadDefaultFromNVS();
 void saveDefaultToNVS();
@@ -146,9 +412,53 @@ void loadAlarmsFromNVS();
 void saveAlarmsToNVS();
 void loadAlarmSettingsFromNVS();
 void saveAlarmSettingsToNVS();
+void nvsMarkDirty(uint8_t groups);
+void nvsFlush();
+void writeNvsStats(JsonWriter& w);
+
+void route(const char* uri, ArRequestHandlerFunction fn);
+void routePost(const char* uri, size_t maxLen, ArRequestHandlerFunction fn);
+void routeInput(const char* uri, ArRequestHandlerFunction fn);
+void runHandler(const char* uri, AsyncWebServerRequest* request, const ArRequestHandlerFunction& fn,
+                bool input);
+void sendAsset(AsyncWebServerRequest* request, const char* contentType,
+               const uint8_t* gz, size_t len, const char* etag, const char* cacheControl);
+
+void writeAlarmCfg(JsonWriter& w);
+struct PushState;
+void writeStatus(JsonWriter& w, const PushState* since = nullptr);
+uint32_t stateVersion();
+const PushState* stateAt(uint32_t version);
+void formatStateEtag(uint32_t version, char* out, size_t size);
+void sendStatus(AsyncWebServerRequest* request, const PushState* since);
+void sendNotModified(AsyncWebServerRequest* request, uint32_t version);
+bool statusWait(AsyncWebServerRequest* request, uint32_t since);
+void statusPollService();
+void statusPollTick();
+void writeRenderStats(JsonWriter& w);
+void writeBench(JsonWriter& w);
+void resetRenderStats();
+void sendJsonOk(AsyncWebServerRequest* request);
+
+void webSetRGB(uint8_t r, uint8_t g, uint8_t b, uint8_t bri);
+void webSetHP(uint8_t val);
+struct StateUpdate;
+void applyStateUpdate(const StateUpdate& u);
+bool parseStateJson(const char* body, size_t len, StateUpdate& u);
+size_t parseControlFrame(const uint8_t* data, size_t len, StateUpdate& u);
+bool parseControlFrames(const uint8_t* data, size_t len, StateUpdate& u);
+void queueInput(const StateUpdate& u);
+void applyPendingInput();
+void wsEvent(AsyncWebSocket* server, AsyncWebSocketClient* client,
+             AwsEventType type, void* arg, uint8_t* data, size_t len);
+void wsPushChanges();
 
 uint8_t daysMaskFromString(const String& s);
-bool    isTodayEnabled(uint8_t mask, int wday);
+bool    parseDate(const String& s, uint32_t& day);
+void    formatDate(uint32_t day, char* buf, size_t len);
+const size_t DATE_BUF_LEN = 32;  // formatDate() for any day number, not just YYYY
+int     findAlarm(uint32_t id);
+uint16_t newAlarmId();
 
 // ---------------- Helpers ----------------
 void IRAM_ATTR handleButtonISR() {
@@ -156,27 +466,104 @@ void IRAM_ATTR handleButtonISR() {
   unsigned long t = millis();
   if (t - lastInterruptTime > 200) {
     isrButtonPressed = true;
+    if (loopTaskHandle) {
+      BaseType_t woken = pdFALSE;
+      vTaskNotifyGiveFromISR(loopTaskHandle, &woken);
+      if (woken) portYIELD_FROM_ISR();
+    }
   }
   lastInterruptTime = t;
 }
 
-void hpWrite(uint8_t duty) {
-  uint8_t hw = gamma8(duty);
-  if (hw == 0) {
-    analogWrite(pwmPin, 0);
+void IRAM_ATTR handleSoundISR() {
+  soundEdges.push(micros());
+}
+
+// Cut loop()'s sleep short (any task)
+void wakeLoop() {
+  if (loopTaskHandle) xTaskNotifyGive(loopTaskHandle);
+}
+
+// Perceptual level 0..65535 -> LEDC duty
+uint32_t hpLevelToDuty(uint16_t level) {
+  return curve16Fine<HP_CURVE>(level) >> (16 - HP_PWM_BITS);
+}
+
+// Start a 0 -> full ramp; it holds full brightness when done.
+void hpStartRamp(uint32_t startMs, uint32_t durationMs) {
+  hpRamp.active     = true;
+  hpRamp.startMs    = startMs;
+  hpRamp.durationMs = durationMs > 0 ? durationMs : 1;
+  // Not a real segment: forces a new fade but still stops a running one
+  if (hpRamp.segment >= 0) hpRamp.segment = HP_RAMP_SEGMENTS;
+}
+
+void hpStopRamp() {
+  hpRamp.active = false; // hpPresent() stops the fade unit
+}
+
+void hpOutputDuty(uint32_t duty) {
+  if (duty == 0) {
+    ledcWrite(pwmPin, 0);
     digitalWrite(boostPin, LOW);
   } else {
     digitalWrite(boostPin, HIGH);
-    analogWrite(pwmPin, hw);
+    ledcWrite(pwmPin, duty);
   }
 }
 
-// Simple gamma curve (~perceptual / "log") for 0..255 -> 0..255
-uint8_t gamma8(uint8_t x) {
-  uint16_t v = (uint16_t)x * (uint16_t)x; // gamma ~2.0
-  v = (v + 254) / 255;                    // round
-  if (v > 255) v = 255;
-  return (uint8_t)v;
+// Render task only: drive the pin from hpRamp or the composed level.
+void hpPresent(uint16_t level) {
+  if (hpRamp.active) {
+    uint32_t elapsed = clk.ms() - hpRamp.startMs;
+    if (elapsed < hpRamp.durationMs) {
+      int seg = (int)((uint64_t)elapsed * HP_RAMP_SEGMENTS / hpRamp.durationMs);
+      if (seg != hpRamp.segment) {
+        // A new fade would block until the previous one ends; end it now
+        if (hpRamp.segment >= 0) ledc_fade_stop(LEDC_LOW_SPEED_MODE, (ledc_channel_t)HP_LEDC_CHANNEL);
+        hpRamp.segment = seg;
+        uint32_t endMs = (uint32_t)((uint64_t)(seg + 1) * hpRamp.durationMs / HP_RAMP_SEGMENTS);
+        uint16_t fromLevel = (uint16_t)((uint64_t)elapsed * 65535 / hpRamp.durationMs);
+        uint16_t toLevel   = (uint16_t)((uint64_t)endMs   * 65535 / hpRamp.durationMs);
+        uint32_t from = hpLevelToDuty(fromLevel);
+        uint32_t to   = hpLevelToDuty(toLevel);
+        digitalWrite(boostPin, HIGH);
+        ledcFade(pwmPin, from, to, (int)max(endMs - elapsed, (uint32_t)1));
+        hpShownDuty = to;
+      }
+      return;
+    }
+    // Ramp finished: hold full brightness as a static level
+    hpRamp.active = false;
+    compositor.edit(LAYER_ALARM).hp = level = 65535;
+  }
+
+  if (hpRamp.segment >= 0) {
+    ledc_fade_stop(LEDC_LOW_SPEED_MODE, (ledc_channel_t)HP_LEDC_CHANNEL);
+    hpRamp.segment = -1;
+    hpShownDuty = UINT32_MAX; // force the static write below
+  }
+
+  uint32_t duty = level >> (16 - HP_PWM_BITS);
+  if (duty != hpShownDuty) {
+    hpShownDuty = duty;
+    hpOutputDuty(duty);
+  }
+}
+
+// Perceptual HP level 0..255 -> linear layer level
+uint16_t hpLevel(uint8_t x) {
+  return curve16<HP_CURVE>(x);
+}
+
+// Color from the UI (sRGB) -> linear 16-bit channels
+Rgb16 linearColor(uint8_t r, uint8_t g, uint8_t b) {
+  return { curve16<COLOR_CURVE>(r), curve16<COLOR_CURVE>(g), curve16<COLOR_CURVE>(b) };
+}
+
+// Same, at perceptual brightness bri 0..255
+Rgb16 levelColor(uint8_t r, uint8_t g, uint8_t b, uint8_t bri) {
+  return fx::scale(linearColor(r, g, b), curve16<BRIGHT_CURVE>(bri));
 }
 
 // SMTWTFS -> bitmask (0=Sun..6=Sat). Ambiguous letters mapped to both days.
@@ -195,11 +582,988 @@ uint8_t daysMaskFromString(const String& s) {
   return mask;
 }
 
-bool isTodayEnabled(uint8_t mask, int wday) { // 0=Sun..6=Sat
-  if (mask == 0) return true;
-  if (wday < 0) return false;
-  if (wday > 6) wday %= 7;
-  return (mask & (1 << wday)) != 0;
+// YYYY-MM-DD <-> local day number
+bool parseDate(const String& s, uint32_t& day) {
+  int y;
+  unsigned m, d;
+  if (sscanf(s.c_str(), "%d-%u-%u", &y, &m, &d) != 3) return false;
+  if (y < 1970 || m < 1 || m > 12 || d < 1 || d > 31) return false;
+  day = civilToDays(y, m, d);
+  return day <= 0xFFFF; // stored as 16 bits (until 2149)
+}
+
+void formatDate(uint32_t day, char* buf, size_t len) {
+  int y;
+  unsigned m, d;
+  daysToCivil(day, y, m, d);
+  snprintf(buf, len, "%04d-%02u-%02u", y, m, d);
+}
+
+int findAlarm(uint32_t id) {
+  for (int i = 0; i < alarmCount; i++) {
+    if (alarms[i].id == id) return i;
+  }
+  return -1;
+}
+
+uint16_t newAlarmId() {
+  uint16_t id;
+  do { id = (uint16_t)random(1, 0x10000); } while (findAlarm(id) >= 0);
+  return id;
+}
+
+// ---------------- Web assets ----------------
+// Pages revalidate every time (cheap 304); CSS/JS are versioned by URL.
+const char CACHE_PAGE[]   = "no-cache";
+const char CACHE_STATIC[] = "public, max-age=31536000, immutable";
+
+void sendAsset(AsyncWebServerRequest* request, const char* contentType,
+               const uint8_t* gz, size_t len, const char* etag, const char* cacheControl) {
+  AsyncWebServerResponse* res;
+  if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == etag) {
+    res = request->beginResponse(304);
+  } else {
+    res = request->beginResponse(200, contentType, gz, len);
+    res->addHeader("Content-Encoding", "gzip");
+  }
+  res->addHeader("Cache-Control", cacheControl);
+  res->addHeader("ETag", etag);
+  request->send(res);
+}
+
+// Every API route is a GET whose handler runs under the state lock.
+// loop() is woken afterwards so changes are pushed to WebSocket clients.
+// Each request is traced; its phases go out in a Server-Timing header
+// (the response is only sent after the handler returns).
+void route(const char* uri, ArRequestHandlerFunction fn) {
+  server.on(uri, HTTP_GET, [uri, fn](AsyncWebServerRequest* request) {
+    runHandler(uri, request, fn, false);
+  });
+}
+
+// GET route for coalesced input (see queueInput): the handler only
+// records it, so the loop isn't woken; the render task does that once it
+// has applied the input.
+void routeInput(const char* uri, ArRequestHandlerFunction fn) {
+  server.on(uri, HTTP_GET, [uri, fn](AsyncWebServerRequest* request) {
+    runHandler(uri, request, fn, true);
+  });
+}
+
+// POST route; a body of up to maxLen bytes is collected first (into
+// request->_tempObject, freed with the request) and fn sees it whole.
+// A larger body leaves _tempObject null.
+void routePost(const char* uri, size_t maxLen, ArRequestHandlerFunction fn) {
+  server.on(uri, HTTP_POST,
+    [uri, fn](AsyncWebServerRequest* request) { runHandler(uri, request, fn, false); },
+    nullptr,
+    [maxLen](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+      if (total > maxLen) return;
+      if (index == 0) request->_tempObject = malloc(total);
+      if (request->_tempObject) memcpy((uint8_t*)request->_tempObject + index, data, len);
+    });
+}
+
+void runHandler(const char* uri, AsyncWebServerRequest* request, const ArRequestHandlerFunction& fn,
+                bool input) {
+  uint32_t waitUs = micros();
+  StateLock lock;
+  uint32_t startUs = micros();
+  tracer.begin(uri, waitUs);
+  if (!input) applyPendingInput();
+  fn(request);
+  const TraceSpan& span = tracer.end();
+  handlerHist.add(micros() - startUs);
+  if (AsyncWebServerResponse* res = request->getResponse()) {
+    char timing[160];
+    formatServerTiming(span, timing, sizeof(timing));
+    res->addHeader("Server-Timing", timing);
+  }
+  if (!input) wakeLoop();
+}
+
+// "lock;dur=0.012, parse;dur=0.004, ..." in ms
+void formatServerTiming(const TraceSpan& span, char* out, size_t size) {
+  int n = snprintf(out, size, "lock;dur=%lu.%03lu",
+                   (unsigned long)(span.lockUs / 1000), (unsigned long)(span.lockUs % 1000));
+  for (uint8_t p = 0; p < TRACE_PHASES && n > 0 && (size_t)n < size; p++) {
+    n += snprintf(out + n, size - n, ", %s;dur=%lu.%03lu", TRACE_PHASE_NAMES[p],
+                  (unsigned long)(span.us[p] / 1000), (unsigned long)(span.us[p] % 1000));
+  }
+}
+
+// Request arguments; lookups count as the trace's parse phase
+bool hasArg(AsyncWebServerRequest* request, const char* key) {
+  Tracer::Scope phase(tracer, TRACE_PARSE);
+  return request->hasArg(key);
+}
+
+const String& arg(AsyncWebServerRequest* request, const char* key) {
+  Tracer::Scope phase(tracer, TRACE_PARSE);
+  return request->arg(key);
+}
+
+// ---------------- State version ----------------
+// PushState is everything a client shows, bar the clock and live readings
+// (bpm, loop stats). stateVersion() goes up by one whenever it differs
+// from the last call; the WebSocket push, the /status ETag and
+// /status?since= all go by it. It starts at a random base, so a version
+// seen before a reboot won't match one after it.
+struct PushState {
+  uint32_t baseEpoch;
+  int32_t  tz;
+  uint32_t leadSec, timeoutSec;
+  uint16_t alarmRev;
+  uint8_t  state, savedState, defaultState;
+  uint8_t  r, g, b, bri, hp;
+  uint8_t  effect, speed, partyBri, mode, sr, sg, sb;
+  uint8_t  params[EFFECT_MAX_PARAMS];
+  bool     defaultSaved, override, alarmActive, party, music, useLED, useBuzzer;
+};
+
+static void capturePushState(PushState& p) {
+  memset(&p, 0, sizeof(p)); // padding must compare equal
+  p.baseEpoch    = baseEpoch;
+  p.tz           = tzOffsetMin;
+  p.leadSec      = alarmRampLeadSec;
+  p.timeoutSec   = alarmTimeoutSec;
+  p.alarmRev     = alarmListRev;
+  p.state        = currentState;
+  p.savedState   = savedState;
+  p.defaultState = defaultStateNVS;
+  p.r = webR; p.g = webG; p.b = webB; p.bri = webBri; p.hp = webHighPower;
+  p.effect   = partyEffect;
+  memcpy(p.params, partyParams[partyEffect], sizeof(p.params));
+  p.speed    = partySpeed;
+  p.partyBri = partyBrightness;
+  p.mode     = partyColorMode;
+  if (partyColorMode != 1) { // random mode changes color every step; don't spam
+    p.sr = partySingleR; p.sg = partySingleG; p.sb = partySingleB;
+  }
+  p.defaultSaved = defaultSaved;
+  p.override     = webOverride;
+  p.alarmActive  = alarmActive;
+  p.party        = partyEnabled;
+  p.music        = musicSyncEnabled;
+  p.useLED       = alarmUseLED;
+  p.useBuzzer    = alarmUseBuzzer;
+}
+
+// The last few versions, for /status?since= deltas
+const uint8_t STATE_HISTORY = 8;
+
+struct StateSnapshot {
+  uint32_t  version;  // 0 = unused
+  PushState state;
+};
+
+StateSnapshot stateHistory[STATE_HISTORY];
+uint8_t       stateHistoryLast = 0;
+
+uint32_t stateVersion() {
+  PushState now;
+  capturePushState(now);
+  const StateSnapshot& last = stateHistory[stateHistoryLast];
+  if (last.version && memcmp(&now, &last.state, sizeof(now)) == 0) return last.version;
+
+  uint32_t version = last.version ? last.version + 1 : (esp_random() % 0x7FFF + 1) << 16;
+  stateHistoryLast = (stateHistoryLast + 1) % STATE_HISTORY;
+  stateHistory[stateHistoryLast] = { version, now };
+  return version;
+}
+
+// The state as of `version`, if still kept
+const PushState* stateAt(uint32_t version) {
+  if (!version) return nullptr;
+  for (const StateSnapshot& s : stateHistory) {
+    if (s.version == version) return &s.state;
+  }
+  return nullptr;
+}
+
+// ---------------- JSON responses ----------------
+// Responses are not allocation-free. The server allocates every request,
+// and each response allocates this stream and its buffer (sized for a
+// typical document, grown by long alarm lists); all of it is freed once
+// the response is out, so polling leaves the heap where it was (host test
+// test_status_heap, tools/load_test.py --soak). Rendering allocates
+// nothing: it goes through one static buffer (handlers run one at a time
+// under the state lock), which reaches the stream in a few large writes
+// rather than a byte at a time.
+static char jsonBuf[768];
+
+class JsonResponse {
+ public:
+  JsonResponse(AsyncWebServerRequest* req, int httpCode)
+    : request(req),
+      stream(req->beginResponseStream("application/json", sizeof(jsonBuf))),
+      w(jsonBuf, sizeof(jsonBuf), stream) {
+    stream->setCode(httpCode);
+  }
+
+  void addHeader(const char* name, const char* value) { stream->addHeader(name, value); }
+
+  void send() {
+    w.flush();
+    request->send(stream);
+  }
+
+ private:
+  AsyncWebServerRequest* request;
+  AsyncResponseStream*   stream;
+
+ public:
+  JsonWriter w;
+};
+
+void writeAlarmCfg(JsonWriter& w) {
+  w.addUInt("leadSec",    alarmRampLeadSec);
+  w.addBool("useLED",     alarmUseLED);
+  w.addBool("useBuzzer",  alarmUseBuzzer);
+  w.addUInt("timeoutSec", alarmTimeoutSec);
+}
+
+// Body of /status (also pushed over the WebSocket), without the braces.
+// With a baseline (a PushState from an earlier version) only the groups
+// that differ from it are written: /status?since=.
+void writeStatus(JsonWriter& w, const PushState* since) {
+  PushState now;
+  if (since) capturePushState(now);
+  const PushState& a = since ? *since : now;
+  bool all = !since;
+
+  w.addUInt("version", stateVersion());
+  if (all || a.baseEpoch != now.baseEpoch || a.tz != now.tz) {
+    w.addUInt("epoch",      nowEpochUTC());
+    w.addInt ("tz",         tzOffsetMin);
+  }
+  if (all || a.defaultSaved != now.defaultSaved || a.defaultState != now.defaultState) {
+    w.addBool("defaultSaved", defaultSaved);
+    w.addUInt("defaultState", defaultStateNVS);
+  }
+  if (all || a.state != now.state)             w.addInt ("state",       currentState);
+  if (all || a.override != now.override)       w.addBool("override",    webOverride);
+  if (all || a.savedState != now.savedState)   w.addInt ("savedState",  savedState);
+  if (all || a.alarmActive != now.alarmActive) w.addBool("alarmActive", alarmActive);
+  if (all || a.alarmRev != now.alarmRev)       w.addUInt("alarmRev",    alarmListRev);
+
+  if (all || a.r != now.r || a.g != now.g || a.b != now.b || a.bri != now.bri) {
+    w.beginObject("rgb");
+    w.addUInt("r",   webR);
+    w.addUInt("g",   webG);
+    w.addUInt("b",   webB);
+    w.addUInt("bri", webBri);
+    w.endObject();
+  }
+
+  if (all || a.hp != now.hp) w.addUInt("hp", webHighPower);
+
+  // Alarm config
+  if (all || a.leadSec != now.leadSec || a.timeoutSec != now.timeoutSec ||
+      a.useLED != now.useLED || a.useBuzzer != now.useBuzzer) {
+    w.beginObject("alarmCfg");
+    writeAlarmCfg(w);
+    w.endObject();
+  }
+
+  // Party status
+  if (all || a.party != now.party || a.music != now.music || a.effect != now.effect ||
+      a.speed != now.speed || a.partyBri != now.partyBri || a.mode != now.mode ||
+      a.sr != now.sr || a.sg != now.sg || a.sb != now.sb ||
+      memcmp(a.params, now.params, sizeof(a.params)) != 0) {
+    w.beginObject("party");
+    w.addBool("enabled", partyEnabled);
+    w.addBool("music",   musicSyncEnabled);
+    w.addUInt("effect",  partyEffect);
+    w.addUInt("speed",   partySpeed);
+    w.addUInt("bri",     partyBrightness);
+    w.addUInt("mode",    partyColorMode);
+    char buf[8];
+    snprintf(buf, sizeof(buf), "#%02X%02X%02X", partySingleR, partySingleG, partySingleB);
+    w.addStr("color", buf);
+    writePartyParams(w);
+    w.addUInt("bpm",        tempo.bpm());
+    w.addBool("beatLocked", tempo.locked(micros()));
+    w.endObject();
+  }
+}
+
+void formatStateEtag(uint32_t version, char* out, size_t size) {
+  snprintf(out, size, "\"%lu\"", (unsigned long)version);
+}
+
+// /status: everything, or with a baseline only what differs from it
+void sendStatus(AsyncWebServerRequest* request, const PushState* since) {
+  char etag[16];
+  formatStateEtag(stateVersion(), etag, sizeof(etag));
+  JsonResponse res(request, 200);
+  res.addHeader("ETag", etag);
+  res.addHeader("Cache-Control", "no-cache");
+  res.w.beginObject();
+  writeStatus(res.w, since);
+  if (!since) {
+    writePartyEffects(res.w);
+    res.w.addUInt("loopMaxUs", loopMaxUs);
+  }
+  res.w.endObject();
+  res.send();
+}
+
+void sendNotModified(AsyncWebServerRequest* request, uint32_t version) {
+  char etag[16];
+  formatStateEtag(version, etag, sizeof(etag));
+  AsyncWebServerResponse* res = request->beginResponse(304);
+  res->addHeader("ETag", etag);
+  res->addHeader("Cache-Control", "no-cache");
+  request->send(res);
+}
+
+void sendJsonOk(AsyncWebServerRequest* request) {
+  JsonResponse res(request, 200);
+  res.w.beginObject();
+  res.w.addBool("ok", true);
+  res.w.endObject();
+  res.send();
+}
+
+// ---------------- Web control ----------------
+// Every control path (the HTTP handlers, POST /state, WebSocket frames)
+// fills a StateUpdate with the fields it changes and applies it at once:
+// one alarm stop and one output update however many fields it carries.
+struct StateUpdate {
+  enum : uint16_t {
+    RGB       = 0x001,  // r g b bri
+    HP        = 0x002,
+    OVERRIDE  = 0x004,  // true: web override on, false: back to savedState
+    PARTY_ON  = 0x008,
+    MUSIC     = 0x010,
+    EFFECT    = 0x020,
+    SPEED     = 0x040,
+    PARTY_BRI = 0x080,
+    MODE      = 0x100,
+    COLOR     = 0x200,  // sr sg sb
+    PARAMS    = 0x400,  // paramMask bits of paramEffect's params
+    PARTY_SETTINGS = PARTY_ON | MUSIC | EFFECT | SPEED | PARTY_BRI | MODE | COLOR
+  };
+  uint16_t has = 0;
+  uint8_t  r = 0, g = 0, b = 0, bri = 0, hp = 0;
+  bool     override = false, partyOn = false, music = false;
+  uint8_t  effect = 0, speed = 0, partyBri = 0, mode = 0, sr = 0, sg = 0, sb = 0;
+  uint8_t  paramEffect = 0, paramMask = 0;
+  uint8_t  params[EFFECT_MAX_PARAMS] = {};
+};
+
+// Direct RGB / HP control goes first (it cancels party and test and
+// takes the web override), then the party settings, so a document that
+// sets both ends up in party mode like two requests in that order would.
+void applyStateUpdate(const StateUpdate& u) {
+  if (u.has & StateUpdate::RGB) {
+    webR   = u.r;
+    webG   = u.g;
+    webB   = u.b;
+    webBri = u.bri;
+  }
+  if (u.has & StateUpdate::HP) webHighPower = u.hp;
+
+  bool takeOverride = (u.has & (StateUpdate::RGB | StateUpdate::HP)) ||
+                      ((u.has & StateUpdate::OVERRIDE) && u.override);
+  if (takeOverride) {
+    partyEnabled     = false;
+    musicSyncEnabled = false;
+
+    if (!webOverride) savedState = currentState;
+    webOverride = true;
+    alarmActive = false;
+    alarmIsTest = false;
+    stopAlarm();
+  }
+  if ((u.has & StateUpdate::OVERRIDE) && !u.override && webOverride) {
+    webOverride  = false;
+    currentState = savedState;
+  }
+
+  if (u.has & StateUpdate::PARTY_ON) {
+    partyEnabled = u.partyOn;
+    if (partyEnabled) webOverride = false;
+  }
+  if (u.has & StateUpdate::MUSIC)     musicSyncEnabled = u.music;
+  if (u.has & StateUpdate::EFFECT)    partyEffect      = min(u.effect, (uint8_t)(PARTY_EFFECT_COUNT - 1));
+  if (u.has & StateUpdate::SPEED)     partySpeed       = min(u.speed, (uint8_t)100);
+  if (u.has & StateUpdate::PARTY_BRI) partyBrightness  = min(u.partyBri, (uint8_t)100);
+  if (u.has & StateUpdate::MODE)      partyColorMode   = min(u.mode, (uint8_t)2);
+  if (u.has & StateUpdate::COLOR) {
+    partySingleR = u.sr;
+    partySingleG = u.sg;
+    partySingleB = u.sb;
+  }
+  if (u.has & StateUpdate::PARAMS) {
+    for (uint8_t i = 0; i < EFFECT_MAX_PARAMS; i++) {
+      if (u.paramMask & (1 << i)) partySetParam(u.paramEffect, i, u.params[i]);
+    }
+  }
+
+  // A parameter alone doesn't restart the step pattern
+  if (partyEnabled && (u.has & StateUpdate::PARTY_SETTINGS)) partyKick();
+  applyOutputs();
+}
+
+// Input coalescing: slider drags send bursts of /setrgb, /sethp,
+// /party/set and /ws control frames. Those only merge into pendingInput
+// (last writer wins per field) and the render task applies it once per
+// frame, so a burst costs one output update per frame, not one per input.
+// Anything else that touches state applies it first (runHandler, loop(),
+// POST /state), so inputs keep their order against other changes.
+StateUpdate pendingInput;
+uint32_t    inputsQueued  = 0;
+uint32_t    inputsApplied = 0;
+
+void queueInput(const StateUpdate& u) {
+  StateUpdate& p = pendingInput;
+  // Taking the override turns party and music off and ends an earlier
+  // override cancel; drop those so the merged update ends the same way
+  if ((u.has & (StateUpdate::RGB | StateUpdate::HP)) || ((u.has & StateUpdate::OVERRIDE) && u.override)) {
+    p.has &= ~(StateUpdate::PARTY_ON | StateUpdate::MUSIC | StateUpdate::OVERRIDE);
+  }
+  if (u.has & StateUpdate::RGB) {
+    p.r = u.r; p.g = u.g; p.b = u.b; p.bri = u.bri;
+  }
+  if (u.has & StateUpdate::HP)        p.hp       = u.hp;
+  if (u.has & StateUpdate::OVERRIDE)  p.override = u.override;
+  if (u.has & StateUpdate::PARTY_ON)  p.partyOn  = u.partyOn;
+  if (u.has & StateUpdate::MUSIC)     p.music    = u.music;
+  if (u.has & StateUpdate::EFFECT)    p.effect   = u.effect;
+  if (u.has & StateUpdate::SPEED)     p.speed    = u.speed;
+  if (u.has & StateUpdate::PARTY_BRI) p.partyBri = u.partyBri;
+  if (u.has & StateUpdate::MODE)      p.mode     = u.mode;
+  if (u.has & StateUpdate::COLOR) {
+    p.sr = u.sr; p.sg = u.sg; p.sb = u.sb;
+  }
+  if (u.has & StateUpdate::PARAMS) {
+    if (!(p.has & StateUpdate::PARAMS) || p.paramEffect != u.paramEffect) p.paramMask = 0;
+    p.paramEffect = u.paramEffect;
+    p.paramMask  |= u.paramMask;
+    for (uint8_t i = 0; i < EFFECT_MAX_PARAMS; i++) {
+      if (u.paramMask & (1 << i)) p.params[i] = u.params[i];
+    }
+  }
+  p.has |= u.has;
+  inputsQueued++;
+}
+
+void applyPendingInput() {
+  if (!pendingInput.has) return;
+  StateUpdate u = pendingInput;
+  pendingInput = StateUpdate();
+  inputsApplied++;
+  applyStateUpdate(u);
+}
+
+// Recorded; the render task applies them with its next frame
+void webSetRGB(uint8_t r, uint8_t g, uint8_t b, uint8_t bri) {
+  StateUpdate u;
+  u.has = StateUpdate::RGB;
+  u.r = r; u.g = g; u.b = b; u.bri = bri;
+  queueInput(u);
+}
+
+void webSetHP(uint8_t val) {
+  StateUpdate u;
+  u.has = StateUpdate::HP;
+  u.hp  = val;
+  queueInput(u);
+}
+
+// "#RRGGBB" -> 0xRRGGBB; false unless it is exactly that
+static bool parseHexColor(const char* s, uint32_t& rgb) {
+  if (s[0] != '#' || strlen(s) != 7) return false;
+  for (int i = 1; i < 7; i++) {
+    if (!isxdigit((unsigned char)s[i])) return false;
+  }
+  rgb = strtoul(s + 1, nullptr, 16);
+  return true;
+}
+
+// JSON body of POST /state: any subset of the /status fields
+//   {"rgb":{"r":..,"g":..,"b":..,"bri":..}, "hp":.., "override":false,
+//    "party":{"enabled":..,"music":..,"effect":..,"speed":..,"bri":..,
+//             "mode":..,"color":"#RRGGBB","params":{"<key>":..}}}
+// Missing rgb channels keep their value; party params are those of the
+// effect selected after the update. Other keys are ignored, so a /status
+// document can be posted back as is. False on malformed input.
+bool parseStateJson(const char* body, size_t len, StateUpdate& u) {
+  JsonReader r(body, len);
+  char    key[16];
+  int32_t v;
+
+  char    paramKeys[EFFECT_MAX_PARAMS][16];
+  int32_t paramValues[EFFECT_MAX_PARAMS];
+  uint8_t paramCount = 0;
+
+  if (!r.beginObject()) return false;
+  while (r.nextKey(key, sizeof(key))) {
+    if (!strcmp(key, "rgb")) {
+      u.has |= StateUpdate::RGB;
+      u.r = webR; u.g = webG; u.b = webB; u.bri = webBri;
+      if (!r.beginObject()) return false;
+      while (r.nextKey(key, sizeof(key))) {
+        uint8_t* c = !strcmp(key, "r")   ? &u.r
+                   : !strcmp(key, "g")   ? &u.g
+                   : !strcmp(key, "b")   ? &u.b
+                   : !strcmp(key, "bri") ? &u.bri : nullptr;
+        if (!c) {
+          if (!r.skip()) return false;
+          continue;
+        }
+        if (!r.readInt(v)) return false;
+        *c = constrain(v, 0, 255);
+      }
+    } else if (!strcmp(key, "hp")) {
+      if (!r.readInt(v)) return false;
+      u.has |= StateUpdate::HP;
+      u.hp = constrain(v, 0, 255);
+    } else if (!strcmp(key, "override")) {
+      if (!r.readBool(u.override)) return false;
+      u.has |= StateUpdate::OVERRIDE;
+    } else if (!strcmp(key, "party")) {
+      if (!r.beginObject()) return false;
+      while (r.nextKey(key, sizeof(key))) {
+        if (!strcmp(key, "enabled")) {
+          if (!r.readBool(u.partyOn)) return false;
+          u.has |= StateUpdate::PARTY_ON;
+        } else if (!strcmp(key, "music")) {
+          if (!r.readBool(u.music)) return false;
+          u.has |= StateUpdate::MUSIC;
+        } else if (!strcmp(key, "color")) {
+          char     hex[8];
+          uint32_t rgb;
+          if (!r.readString(hex, sizeof(hex)) || !parseHexColor(hex, rgb)) return false;
+          u.has |= StateUpdate::COLOR;
+          u.sr = rgb >> 16; u.sg = rgb >> 8; u.sb = rgb;
+        } else if (!strcmp(key, "params")) {
+          if (!r.beginObject()) return false;
+          while (r.nextKey(key, sizeof(key))) {
+            if (!r.readInt(v)) return false;
+            if (paramCount == EFFECT_MAX_PARAMS) continue;
+            strcpy(paramKeys[paramCount], key);
+            paramValues[paramCount++] = v;
+          }
+        } else {
+          uint16_t bit   = 0;
+          uint8_t* field = nullptr;
+          if      (!strcmp(key, "effect")) { bit = StateUpdate::EFFECT;    field = &u.effect;   }
+          else if (!strcmp(key, "speed"))  { bit = StateUpdate::SPEED;     field = &u.speed;    }
+          else if (!strcmp(key, "bri"))    { bit = StateUpdate::PARTY_BRI; field = &u.partyBri; }
+          else if (!strcmp(key, "mode"))   { bit = StateUpdate::MODE;      field = &u.mode;     }
+          if (!field) {
+            if (!r.skip()) return false;  // bpm, beatLocked, ...
+            continue;
+          }
+          if (!r.readInt(v)) return false;
+          u.has |= bit;
+          *field = constrain(v, 0, 255);
+        }
+      }
+    } else if (!r.skip()) {
+      return false;
+    }
+  }
+  if (!r.done()) return false;
+
+  if (paramCount) {
+    uint8_t effect = (u.has & StateUpdate::EFFECT) ? min(u.effect, (uint8_t)(PARTY_EFFECT_COUNT - 1)) : partyEffect;
+    const PartyEffect& fx = PARTY_EFFECTS[effect];
+    uint8_t fxParams = min(fx.paramCount, (uint8_t)EFFECT_MAX_PARAMS);
+    u.has |= StateUpdate::PARAMS;
+    u.paramEffect = effect;
+    for (uint8_t k = 0; k < paramCount; k++) {
+      for (uint8_t i = 0; i < fxParams; i++) {
+        if (strcmp(paramKeys[k], fx.params[i].key)) continue;
+        u.paramMask |= 1 << i;
+        u.params[i]  = constrain(paramValues[k], 0, 255);
+      }
+    }
+  }
+  return true;
+}
+
+// ---------------- WebSocket push (/ws) ----------------
+// Text frames from the lamp:
+//   {"t":"state", ...same fields as /status}   on any state change
+//   {"t":"alarms","rev":n}                     when the alarm list changed
+// Binary control frames from the UI (first byte = opcode); a binary
+// POST /state body is a sequence of them:
+//   0x01 r g b bri                       -> same as /setrgb
+//   0x02 hp                              -> same as /sethp
+//   0x03 flags effect speed bri mode r g b
+//        flags bit0 = party on, bit1 = music sync -> same as /party/set
+//   0x04 effect param value              -> effect parameter (by index)
+//   0x05 on                              -> web override on / off
+enum WsOp : uint8_t { WS_OP_RGB = 0x01, WS_OP_HP = 0x02, WS_OP_PARTY = 0x03, WS_OP_PARAM = 0x04,
+                      WS_OP_OVERRIDE = 0x05 };
+
+// One control frame into u; returns its length, 0 if unknown or short
+size_t parseControlFrame(const uint8_t* data, size_t len, StateUpdate& u) {
+  if (!len) return 0;
+  switch (data[0]) {
+    case WS_OP_RGB:
+      if (len < 5) return 0;
+      u.has |= StateUpdate::RGB;
+      u.r = data[1]; u.g = data[2]; u.b = data[3]; u.bri = data[4];
+      return 5;
+    case WS_OP_HP:
+      if (len < 2) return 0;
+      u.has |= StateUpdate::HP;
+      u.hp = data[1];
+      return 2;
+    case WS_OP_PARTY:
+      if (len < 9) return 0;
+      u.has |= StateUpdate::PARTY_ON | StateUpdate::MUSIC | StateUpdate::EFFECT | StateUpdate::SPEED |
+               StateUpdate::PARTY_BRI | StateUpdate::MODE | StateUpdate::COLOR;
+      u.partyOn  = (data[1] & 0x01) != 0;
+      u.music    = (data[1] & 0x02) != 0;
+      u.effect   = data[2];
+      u.speed    = data[3];
+      u.partyBri = data[4];
+      u.mode     = data[5];
+      u.sr = data[6]; u.sg = data[7]; u.sb = data[8];
+      return 9;
+    case WS_OP_PARAM:
+      if (len < 4) return 0;
+      if (!(u.has & StateUpdate::PARAMS) || u.paramEffect != data[1]) u.paramMask = 0;
+      u.has |= StateUpdate::PARAMS;
+      u.paramEffect = data[1];
+      if (data[2] < EFFECT_MAX_PARAMS) {
+        u.paramMask |= 1 << data[2];
+        u.params[data[2]] = data[3];
+      }
+      return 4;
+    case WS_OP_OVERRIDE:
+      if (len < 2) return 0;
+      u.has |= StateUpdate::OVERRIDE;
+      u.override = data[1] != 0;
+      return 2;
+    default:
+      return 0;
+  }
+}
+
+// Binary POST /state body; false if any frame is unknown or short
+bool parseControlFrames(const uint8_t* data, size_t len, StateUpdate& u) {
+  while (len) {
+    size_t n = parseControlFrame(data, len, u);
+    if (!n) return false;
+    data += n;
+    len  -= n;
+  }
+  return true;
+}
+
+static char wsBuf[768];
+
+static size_t buildStateEvent() {
+  JsonWriter w(wsBuf, sizeof(wsBuf));
+  w.beginObject();
+  w.addStr("t", "state");
+  writeStatus(w);
+  w.endObject();
+  return w.overflowed() ? 0 : w.length();
+}
+
+static size_t buildAlarmsEvent() {
+  JsonWriter w(wsBuf, sizeof(wsBuf));
+  w.beginObject();
+  w.addStr("t", "alarms");
+  w.addUInt("rev", alarmListRev);
+  w.endObject();
+  return w.length();
+}
+
+void wsEvent(AsyncWebSocket* server, AsyncWebSocketClient* client,
+             AwsEventType type, void* arg, uint8_t* data, size_t len) {
+  StateLock lock;
+  if (type == WS_EVT_CONNECT) {
+    size_t n = buildStateEvent();
+    if (n) client->text(wsBuf, n);
+    return;
+  }
+  if (type != WS_EVT_DATA) return;
+
+  // Control frames are tiny; ignore anything fragmented
+  AwsFrameInfo* info = (AwsFrameInfo*)arg;
+  if (!info->final || info->index != 0 || info->len != len) return;
+  if (info->opcode != WS_BINARY || len == 0) return;
+
+  // Coalesced; the render task wakes the loop once it is applied
+  StateUpdate u;
+  if (parseControlFrame(data, len, u)) queueInput(u);
+}
+
+// Broadcast whatever changed since the last call; cheap when nothing did.
+static uint32_t pushedVersion  = 0;
+static uint16_t pushedAlarmRev = 0;
+
+void wsPushChanges() {
+  uint32_t version = stateVersion();
+  if (pushedVersion && version == pushedVersion) return;
+
+  bool alarmsChanged = pushedVersion && alarmListRev != pushedAlarmRev;
+  pushedVersion  = version;
+  pushedAlarmRev = alarmListRev;
+  if (ws.count() == 0) return;
+
+  size_t n = buildStateEvent();
+  if (n) ws.textAll(wsBuf, n);
+  if (alarmsChanged) {
+    n = buildAlarmsEvent();
+    ws.textAll(wsBuf, n);
+  }
+}
+
+// ---------------- Status long-poll ----------------
+// /status?since=<current version> parks the request: the async server
+// keeps the connection and no task waits on it. loop() answers it with
+// the changed groups once the version moves on (it checks after every
+// pass), or a timer answers 304 after STATUS_POLL_MS. An idle client
+// costs one request per STATUS_POLL_MS.
+const uint8_t  STATUS_WAITERS = 4;
+const uint32_t STATUS_POLL_MS = 25000;
+
+struct StatusWaiter {
+  AsyncWebServerRequestPtr request;
+  uint32_t                 since;
+  uint32_t                 deadlineMs;
+};
+
+StatusWaiter statusWaiters[STATUS_WAITERS];  // oldest first
+uint8_t      statusWaiterCount = 0;
+int8_t       statusPollTimer   = -1;
+
+// False when all slots are taken by clients still connected
+bool statusWait(AsyncWebServerRequest* request, uint32_t since) {
+  if (statusWaiterCount == STATUS_WAITERS) {
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < statusWaiterCount; i++) {
+      if (statusWaiters[i].request.expired()) continue;
+      if (kept != i) statusWaiters[kept] = std::move(statusWaiters[i]);
+      kept++;
+    }
+    for (uint8_t i = kept; i < statusWaiterCount; i++) statusWaiters[i].request.reset();
+    statusWaiterCount = kept;
+    if (kept == STATUS_WAITERS) return false;
+  }
+  uint32_t deadline = clk.ms() + STATUS_POLL_MS;
+  statusWaiters[statusWaiterCount++] = { request->pause(), since, deadline };
+  if (statusWaiterCount == 1) sched.at(statusPollTimer, deadline);
+  return true;
+}
+
+void statusPollService() {
+  if (!statusWaiterCount) return;
+  uint32_t version = stateVersion();
+  uint32_t now     = clk.ms();
+  uint8_t  kept    = 0;
+  for (uint8_t i = 0; i < statusWaiterCount; i++) {
+    StatusWaiter& sw = statusWaiters[i];
+    bool changed = version != sw.since;
+    if (!changed && (int32_t)(now - sw.deadlineMs) < 0) {
+      if (kept != i) statusWaiters[kept] = std::move(sw);
+      kept++;
+      continue;
+    }
+    // Gone if the client hung up meanwhile
+    if (std::shared_ptr<AsyncWebServerRequest> request = sw.request.lock()) {
+      if (changed) sendStatus(request.get(), stateAt(sw.since));
+      else         sendNotModified(request.get(), version);
+    }
+  }
+  for (uint8_t i = kept; i < statusWaiterCount; i++) statusWaiters[i].request.reset();
+  statusWaiterCount = kept;
+
+  if (kept) sched.at(statusPollTimer, statusWaiters[0].deadlineMs);
+  else      sched.cancel(statusPollTimer);
+}
+
+// Timer callback: a wait ran out
+void statusPollTick() {
+  statusPollService();
+}
+
+// ---------------- NVS commit layer ----------------
+// The globals are the RAM copy of everything persisted; saving only marks
+// a group dirty. Dirty groups are committed once nothing changed for
+// NVS_DEBOUNCE_MS (at most NVS_MAX_DELAY_MS after the first change), from
+// loop() outside the state lock, on /nvs/stats?flush=1 and on restart.
+// Keys that already hold the value are not rewritten. A group whose write
+// fails is marked dirty again, so the debounce timer retries it.
+enum NvsGroup : uint8_t {
+  NVS_DEFAULTS  = 0x01,
+  NVS_ALARMS    = 0x02,
+  NVS_ALARM_CFG = 0x04,
+};
+const uint32_t NVS_DEBOUNCE_MS  = 3000;
+const uint32_t NVS_MAX_DELAY_MS = 30000;
+const uint32_t NVS_ENTRY_BYTES  = 32;  // NVS writes whole 32-byte entries
+
+uint8_t       nvsDirty        = 0;
+uint32_t      nvsDirtySinceMs = 0;
+volatile bool nvsFlushDue     = false;
+int8_t        nvsTimer        = -1;
+
+uint32_t nvsCommits   = 0;  // flushes that wrote anything
+uint32_t nvsKeyWrites = 0;  // keys written
+uint32_t nvsKeySkips  = 0;  // keys left alone (value unchanged)
+uint32_t nvsBytes     = 0;  // flash bytes written, in whole entries
+uint32_t nvsWriteFailures = 0;  // flushes that left a group dirty
+uint32_t nvsAlarmsHash = 0;    // alarm blob as last written
+bool     nvsLegacyAlarms = false; // old alarm keys still to be removed
+
+uint32_t fnv1a(const void* data, size_t len) {
+  const uint8_t* p = (const uint8_t*)data;
+  uint32_t h = 2166136261u;
+  while (len--) { h ^= *p++; h *= 16777619u; }
+  return h;
+}
+
+void nvsMarkDirty(uint8_t groups) {
+  Tracer::Scope phase(tracer, TRACE_PERSIST);
+  uint32_t now = clk.ms();
+  if (!nvsDirty) nvsDirtySinceMs = now;
+  nvsDirty |= groups;
+  uint32_t due      = now + NVS_DEBOUNCE_MS;
+  uint32_t deadline = nvsDirtySinceMs + NVS_MAX_DELAY_MS;
+  sched.at(nvsTimer, (int32_t)(due - deadline) > 0 ? deadline : due);
+}
+
+// Timer callback (under the lock): loop() flushes once it lets go of it
+void nvsTick() {
+  nvsFlushDue = true;
+}
+
+static bool nvsWrote(size_t written, size_t entries) {
+  if (!written) return false;
+  nvsKeyWrites++;
+  nvsBytes += entries * NVS_ENTRY_BYTES;
+  return true;
+}
+
+static bool nvsPutUChar(const char* key, uint8_t v) {
+  if (prefs.isKey(key) && prefs.getUChar(key) == v) { nvsKeySkips++; return true; }
+  return nvsWrote(prefs.putUChar(key, v), 1);
+}
+
+static bool nvsPutULong(const char* key, uint32_t v) {
+  if (prefs.isKey(key) && prefs.getULong(key) == v) { nvsKeySkips++; return true; }
+  return nvsWrote(prefs.putULong(key, v), 1);
+}
+
+static bool nvsPutBool(const char* key, bool v) {
+  if (prefs.isKey(key) && prefs.getBool(key) == v) { nvsKeySkips++; return true; }
+  return nvsWrote(prefs.putBool(key, v), 1);
+}
+
+// Blob: index entry + data entries
+static bool nvsPutBlob(const char* key, const void* data, size_t len, uint32_t& lastHash) {
+  uint32_t h = fnv1a(data, len);
+  // Unchanged, and the key exists exactly when there is data
+  if (h == lastHash && (len == 0) != prefs.isKey(key)) { nvsKeySkips++; return true; }
+  if (len == 0) {
+    if (prefs.isKey(key) && !nvsWrote(prefs.remove(key), 1)) return false;
+  } else if (prefs.putBytes(key, data, len) != len) { // a short write counts as failed
+    return false;
+  } else {
+    nvsWrote(len, 2 + (len + NVS_ENTRY_BYTES - 1) / NVS_ENTRY_BYTES);
+  }
+  lastHash = h;
+  return true;
+}
+
+// Snapshots taken under the lock and written without it
+static struct {
+  uint8_t  state, r, g, b, bri, hp;
+} nvsDefSnap;
+static struct {
+  uint32_t lead, timeout;
+  bool     led, buzz;
+} nvsCfgSnap;
+size_t encodeAlarms(uint8_t* out);
+static uint8_t nvsAlarmBlob[ALARM_BLOB_MAX];
+static size_t  nvsAlarmBlobLen = 0;
+
+void nvsFlush() {
+  uint8_t groups;
+  {
+    StateLock lock;
+    nvsFlushDue = false;
+    groups      = nvsDirty;
+    nvsDirty    = 0;
+    sched.cancel(nvsTimer);
+    if (groups & NVS_DEFAULTS) {
+      nvsDefSnap = { defaultStateNVS, defaultR, defaultG, defaultB, defaultBri, defaultHP };
+    }
+    if (groups & NVS_ALARM_CFG) {
+      nvsCfgSnap = { alarmRampLeadSec, alarmTimeoutSec, alarmUseLED, alarmUseBuzzer };
+    }
+    if (groups & NVS_ALARMS) {
+      nvsAlarmBlobLen = encodeAlarms(nvsAlarmBlob);
+    }
+  }
+  if (!groups) return;
+
+  uint32_t writesBefore = nvsKeyWrites;
+  uint8_t  failed       = 0;
+  prefs.begin("lamp", false);
+  if (groups & NVS_DEFAULTS) {
+    bool ok = nvsPutBool ("hasDef",   true);
+    ok &= nvsPutUChar("defState", nvsDefSnap.state);
+    ok &= nvsPutUChar("defR",     nvsDefSnap.r);
+    ok &= nvsPutUChar("defG",     nvsDefSnap.g);
+    ok &= nvsPutUChar("defB",     nvsDefSnap.b);
+    ok &= nvsPutUChar("defBri",   nvsDefSnap.bri);
+    ok &= nvsPutUChar("defHP",    nvsDefSnap.hp);
+    if (!ok) failed |= NVS_DEFAULTS;
+  }
+  if (groups & NVS_ALARMS) {
+    if (!nvsPutBlob(ALARM_BLOB_KEY, nvsAlarmBlob, nvsAlarmBlobLen, nvsAlarmsHash)) {
+      failed |= NVS_ALARMS;
+    } else if (nvsLegacyAlarms && prefs.isKey(ALARM_BLOB_KEY)) { // migrated copy is safe now
+      const char* legacy[] = { "alarms", "alarmSkips", "alarmCnt", "alarmCount" };
+      for (const char* key : legacy) {
+        if (prefs.remove(key)) nvsWrote(1, 1);
+      }
+      nvsLegacyAlarms = false;
+    }
+  }
+  if (groups & NVS_ALARM_CFG) {
+    bool ok = nvsPutULong("alarmLead",    nvsCfgSnap.lead);
+    ok &= nvsPutBool ("alarmLED",     nvsCfgSnap.led);
+    ok &= nvsPutBool ("alarmBuzz",    nvsCfgSnap.buzz);
+    ok &= nvsPutULong("alarmTimeout", nvsCfgSnap.timeout);
+    if (!ok) failed |= NVS_ALARM_CFG;
+  }
+  prefs.end();
+  if (nvsKeyWrites != writesBefore) nvsCommits++;
+
+  if (failed) {
+    nvsWriteFailures++;
+    LOGW(NVS, "write failed (groups 0x%x), retrying", failed);
+    StateLock lock;
+    nvsMarkDirty(failed);
+  }
+}
+
+// Restart (esp_restart) flushes whatever is pending
+void nvsShutdownHandler() {
+  nvsFlush();
+}
+
+void writeNvsStats(JsonWriter& w) {
+  w.addUInt("commits",   nvsCommits);
+  w.addUInt("keyWrites", nvsKeyWrites);
+  w.addUInt("keySkips",  nvsKeySkips);
+  w.addUInt("bytes",     nvsBytes);
+  w.addUInt("failures",  nvsWriteFailures);
+  w.addUInt("pending",   nvsDirty);
+  w.addUInt("uptimeSec", millis() / 1000);
 }
 
 // ---------------- NVS: defaults ----------------
@@ -216,16 +1580,6 @@ void loadDefaultFromNVS() {
 }
 
 void saveDefaultToNVS() {
-  prefs.begin("lamp", false);
-  prefs.putBool("hasDef", true);
-  prefs.putUChar("defState", (uint8_t)currentState);
-  prefs.putUChar("defR",   webR);
-  prefs.putUChar("defG",   webG);
-  prefs.putUChar("defB",   webB);
-  prefs.putUChar("defBri", webBri);
-  prefs.putUChar("defHP",  webHighPower);
-  prefs.end();
-
   defaultSaved    = true;
   defaultStateNVS = (uint8_t)currentState;
   defaultR        = webR;
@@ -233,30 +1587,180 @@ void saveDefaultToNVS() {
   defaultB        = webB;
   defaultBri      = webBri;
   defaultHP       = webHighPower;
+  nvsMarkDirty(NVS_DEFAULTS);
 }
 
 // ---------------- NVS: alarms ----------------
+// One blob under ALARM_BLOB_KEY; load and save cost follow the live count.
+//   u8 version | u16 alarm count | u8 skip count
+//   alarm records | skip records | u32 CRC-32 of all bytes before it
+// Alarm record, little endian:
+//   u16 id, then bits 0-10 minute of day, 11 enabled, 12 one-shot and
+//   weekly:   bits 13-19 daysMask in 24 bits          -> 5 bytes
+//   one-shot: bits 13-28 date (local day) in 32 bits  -> 6 bytes
+// Skip record: u16 id | u16 day                        -> 4 bytes
+//
+// Version 1 was the raw AlarmItemV1 array ("alarms" + "alarmCnt" or
+// "alarmCount", skips in "alarmSkips"); it is migrated on load and
+// rewritten in the current format by the next commit.
+struct AlarmItemV1 {
+  uint32_t id;
+  uint8_t  hour;
+  uint8_t  minute;
+  uint8_t  daysMask;
+  bool     enabled;
+  uint32_t date;         // was lastFireMin (always 0) before one-shots
+};
+struct AlarmSkipV1 {
+  uint32_t id;
+  uint32_t day;
+};
+
+static size_t putLE(uint8_t* p, uint32_t v, size_t n) {
+  for (size_t i = 0; i < n; i++) p[i] = (uint8_t)(v >> (8 * i));
+  return n;
+}
+
+static uint32_t getLE(const uint8_t* p, size_t n) {
+  uint32_t v = 0;
+  for (size_t i = 0; i < n; i++) v |= (uint32_t)p[i] << (8 * i);
+  return v;
+}
+
+size_t encodeAlarms(uint8_t* out) {
+  uint8_t* p = out;
+  *p++ = ALARM_REC_VERSION;
+  p += putLE(p, alarmCount, 2);
+  *p++ = (uint8_t)alarmSkipCount;
+  for (int i = 0; i < alarmCount; i++) {
+    const AlarmItem& a = alarms[i];
+    uint32_t bits = (a.hour * 60 + a.minute) | (a.enabled ? 1UL << 11 : 0);
+    p += putLE(p, a.id, 2);
+    if (a.date) p += putLE(p, bits | 1UL << 12 | (uint32_t)a.date << 13, 4);
+    else        p += putLE(p, bits | (uint32_t)(a.daysMask & 0x7F) << 13, 3);
+  }
+  for (int k = 0; k < alarmSkipCount; k++) {
+    p += putLE(p, alarmSkips[k].id, 2);
+    p += putLE(p, alarmSkips[k].day, 2);
+  }
+  p += putLE(p, esp_rom_crc32_le(0, out, p - out), 4);
+  return p - out;
+}
+
+static bool decodeAlarms(const uint8_t* in, size_t len) {
+  if (len < 8 || in[0] != ALARM_REC_VERSION) return false;
+  if (getLE(in + len - 4, 4) != esp_rom_crc32_le(0, in, len - 4)) return false;
+
+  int count = getLE(in + 1, 2), skips = in[3];
+  if (count > MAX_ALARMS || skips > MAX_ALARM_SKIPS) return false;
+  const uint8_t* p   = in + 4;
+  const uint8_t* end = in + len - 4;
+  for (int i = 0; i < count; i++) {
+    if (end - p < 5) return false;
+    AlarmItem& a = alarms[i];
+    a.id = getLE(p, 2);
+    uint32_t bits = getLE(p + 2, 3);
+    bool once = bits & (1UL << 12);
+    if (once) {
+      if (end - p < 6) return false;
+      bits = getLE(p + 2, 4);
+    }
+    uint16_t minuteOfDay = bits & 0x7FF;
+    a.hour     = min(minuteOfDay / 60, 23);
+    a.minute   = minuteOfDay % 60;
+    a.enabled  = bits & (1UL << 11);
+    a.daysMask = once ? 0 : (bits >> 13) & 0x7F;
+    a.date     = once ? (uint16_t)(bits >> 13) : 0;
+    p += once ? 6 : 5;
+  }
+  if (end - p != skips * 4) return false;
+  for (int k = 0; k < skips; k++, p += 4) {
+    alarmSkips[k].id  = getLE(p, 2);
+    alarmSkips[k].day = getLE(p + 2, 2);
+  }
+  alarmCount     = count;
+  alarmSkipCount = skips;
+  return true;
+}
+
+// Version 1 -> RAM. Ids shrink to 16 bits (kept unique); skips follow.
+// False (and no alarms) if the old array could not be read; the v1 keys
+// are then left alone so the next boot tries again.
+static bool migrateAlarmsV1() {
+  int count = prefs.isKey("alarmCnt") ? prefs.getUShort("alarmCnt", 0)
+                                      : prefs.getUChar("alarmCount", 0);
+  size_t storedSize = prefs.getBytesLength("alarms");
+  if (storedSize % sizeof(AlarmItemV1) != 0) storedSize = 0;
+  count = min(count, (int)(storedSize / sizeof(AlarmItemV1)));
+  count = min(count, MAX_ALARMS);
+
+  // One-off at boot, so the old array goes through the heap
+  alarmCount     = 0;
+  alarmSkipCount = 0;
+  AlarmItemV1* v1 = count ? (AlarmItemV1*)malloc(storedSize) : nullptr;
+  if (count && (!v1 || prefs.getBytes("alarms", v1, storedSize) != storedSize)) {
+    free(v1);
+    return false;
+  }
+  static uint32_t oldIds[MAX_ALARMS];
+  for (int i = 0; i < count; i++) {
+    const AlarmItemV1& o = v1[i];
+    AlarmItem& a = alarms[alarmCount];
+    uint16_t id = (uint16_t)o.id;
+    a.id       = (id && findAlarm(id) < 0) ? id : newAlarmId();
+    a.hour     = min(o.hour, (uint8_t)23);
+    a.minute   = min(o.minute, (uint8_t)59);
+    a.daysMask = o.daysMask & 0x7F;
+    a.enabled  = o.enabled;
+    a.date     = o.date <= 0xFFFF ? (uint16_t)o.date : 0;
+    oldIds[alarmCount++] = o.id;
+  }
+  free(v1);
+
+  storedSize = prefs.getBytesLength("alarmSkips");
+  if (storedSize % sizeof(AlarmSkipV1) == 0 && storedSize <= MAX_ALARM_SKIPS * sizeof(AlarmSkipV1)) {
+    AlarmSkipV1 skips[MAX_ALARM_SKIPS];
+    if (storedSize) prefs.getBytes("alarmSkips", skips, storedSize);
+    for (size_t k = 0; k < storedSize / sizeof(AlarmSkipV1); k++) {
+      for (int i = 0; i < alarmCount; i++) {
+        if (oldIds[i] != skips[k].id || skips[k].day > 0xFFFF) continue;
+        alarmSkips[alarmSkipCount++] = { alarms[i].id, (uint16_t)skips[k].day };
+        break;
+      }
+    }
+  }
+  return true;
+}
+
 void saveAlarmsToNVS() {
-  prefs.begin("lamp", false);
-  prefs.putUChar("alarmCount", (uint8_t)alarmCount);
-  prefs.putBytes("alarms", alarms, sizeof(AlarmItem) * MAX_ALARMS);
-  prefs.end();
+  alarmListRev++;
+  nvsMarkDirty(NVS_ALARMS);
 }
 
 void loadAlarmsFromNVS() {
+  alarmCount     = 0;
+  alarmSkipCount = 0;
   prefs.begin("lamp", true);
-  uint8_t count = prefs.getUChar("alarmCount", 0);
-  size_t storedSize = prefs.getBytesLength("alarms");
-  if (storedSize == sizeof(AlarmItem) * (size_t)MAX_ALARMS) {
-    prefs.getBytes("alarms", alarms, storedSize);
-    alarmCount = min((int)count, MAX_ALARMS);
-  } else {
-    alarmCount = 0;
+  size_t len = prefs.getBytesLength(ALARM_BLOB_KEY);
+  if (len > 0) {
+    if (len > sizeof(nvsAlarmBlob) || prefs.getBytes(ALARM_BLOB_KEY, nvsAlarmBlob, len) != len ||
+        !decodeAlarms(nvsAlarmBlob, len)) {
+      alarmCount     = 0;
+      alarmSkipCount = 0;
+      LOGW(NVS, "stored alarms are corrupt, starting empty");
+    }
+    nvsAlarmsHash = fnv1a(nvsAlarmBlob, len);
+  } else if (prefs.isKey("alarms") || prefs.isKey("alarmSkips")) {
+    if (migrateAlarmsV1()) {
+      nvsLegacyAlarms = true;
+      LOGI(NVS, "migrated %d alarms from format v1", alarmCount);
+    } else {
+      LOGE(NVS, "could not read v1 alarms, retrying next boot");
+    }
   }
   prefs.end();
-  for (int i = 0; i < alarmCount; ++i) {
-    alarms[i].lastFireMin = 0;
-  }
+  if (nvsLegacyAlarms) nvsMarkDirty(NVS_ALARMS);
+  rebuildAlarmIndex();
 }
 
 // ---------------- NVS: alarm settings (ramp + type) ----------------
@@ -275,230 +1779,293 @@ void loadAlarmSettingsFromNVS() {
 }
 
 void saveAlarmSettingsToNVS() {
-  prefs.begin("lamp", false);
-  prefs.putULong("alarmLead", alarmRampLeadSec);
-  prefs.putBool("alarmLED", alarmUseLED);
-  prefs.putBool("alarmBuzz", alarmUseBuzzer);
-   prefs.putULong("alarmTimeout", alarmTimeoutSec);
-  prefs.end();
+  nvsMarkDirty(NVS_ALARM_CFG);
 }
 
 // ---------------- Setup ----------------
 void setup() {
+  stateMutex = xSemaphoreCreateRecursiveMutex();
+  StateLock lock; // no handler may run before the initial state is set
+
   Serial.begin(115200);
   delay(50);
+  xTaskCreate(logTask, "log", 3072, nullptr, LOG_PRIO, &logTaskHandle);
+
+  loopTaskHandle  = xTaskGetCurrentTaskHandle(); // setup() runs in the loop task
+  alarmCheckTimer = sched.add(alarmCheckTick);
+  alarmStageTimer = sched.add(alarmStageTick);
+  buzzerTimer     = sched.add(buzzerTick);
+  partyTimer      = sched.add(partyTick);
+  nvsTimer        = sched.add(nvsTick);
+  statusPollTimer = sched.add(statusPollTick);
+  esp_register_shutdown_handler(nvsShutdownHandler);
 
   pinMode(boostPin, OUTPUT);
   digitalWrite(boostPin, LOW);
 
-  pinMode(pwmPin, OUTPUT);
-  analogWrite(pwmPin, 0);
+  ledcAttachChannel(pwmPin, HP_PWM_FREQ, HP_PWM_BITS, HP_LEDC_CHANNEL);
+  ledcWrite(pwmPin, 0);
 
   pinMode(buttonPin, INPUT_PULLUP);
   attachInterrupt(digitalPinToInterrupt(buttonPin), handleButtonISR, FALLING);
 
   pinMode(soundPin, INPUT);
+  attachInterrupt(digitalPinToInterrupt(soundPin), handleSoundISR, RISING);
   pinMode(buzzerPin, OUTPUT);
   digitalWrite(buzzerPin, LOW);
 
-  pixels.begin();
+  if (!pixelOut.begin(rgbPin)) LOGE(SYS, "RMT init failed; pixels disabled");
   pixels.setBrightness(255);
   pixels.clear();
-  pixels.show();
+  pixelOut.show(pixels.getPixels(), numPixels * 3);
+  partyParamDefaults();
 
   loadDefaultFromNVS();
   loadAlarmsFromNVS();
   loadAlarmSettingsFromNVS();
 
-  Serial.printf("Default saved: %s, state=%u\n", defaultSaved ? "yes" : "no", (unsigned)defaultStateNVS);
-  Serial.printf("Alarms loaded: %d\n", alarmCount);
-  Serial.printf("Alarm ramp lead: %lu s, timeout: %lu s, LED=%d, buzzer=%d\n",
-                (unsigned long)alarmRampLeadSec,
-                (unsigned long)alarmTimeoutSec,
-                alarmUseLED, alarmUseBuzzer);
+  LOGI(NVS, "default saved: %s, state=%u", defaultSaved ? "yes" : "no", defaultStateNVS);
+  LOGI(NVS, "alarms loaded: %d", alarmCount);
+  LOGI(NVS, "alarm ramp lead: %u s, timeout: %u s, LED=%d, buzzer=%d",
+       alarmRampLeadSec, alarmTimeoutSec, alarmUseLED, alarmUseBuzzer);
 
   // Soft AP
   const char* apName = "lumina_Lamp";
   const char* apPass = "luminalamp";
   WiFi.softAP(apName, apPass);
-  Serial.print("AP SSID: "); Serial.print(apName);
-  Serial.print("  password: "); Serial.println(apPass);
-  Serial.print("AP IP: "); Serial.println(WiFi.softAPIP());
+  IPAddress apIp = WiFi.softAPIP();
+  LOGI(SYS, "AP SSID: %s  password: %s", apName, apPass);
+  LOGI(SYS, "AP IP: %u.%u.%u.%u", apIp[0], apIp[1], apIp[2], apIp[3]);
 
-  // Pages
-  server.on("/",            HTTP_GET, [](){ server.send_P(200, "text/html", INDEX_HTML); });
-  server.on("/index.html",  HTTP_GET, [](){ server.send_P(200, "text/html", INDEX_HTML); });
-  server.on("/alarms.html", HTTP_GET, [](){ server.send_P(200, "text/html", ALARMS_HTML); });
-  server.on("/style.css",   HTTP_GET, [](){ server.send_P(200, "text/css",  STYLE_CSS); });
-  server.on("/script.js",   HTTP_GET, [](){ server.send_P(200, "application/javascript", SCRIPT_JS); });
+  // Pages (gzip from tools/build_assets.py; CSS/JS URLs carry ?v=<hash>)
+  route("/",            [](AsyncWebServerRequest* request){ sendAsset(request, "text/html", INDEX_HTML_GZ,  INDEX_HTML_GZ_LEN,  INDEX_HTML_ETAG,  CACHE_PAGE); });
+  route("/index.html",  [](AsyncWebServerRequest* request){ sendAsset(request, "text/html", INDEX_HTML_GZ,  INDEX_HTML_GZ_LEN,  INDEX_HTML_ETAG,  CACHE_PAGE); });
+  route("/alarms.html", [](AsyncWebServerRequest* request){ sendAsset(request, "text/html", ALARMS_HTML_GZ, ALARMS_HTML_GZ_LEN, ALARMS_HTML_ETAG, CACHE_PAGE); });
+  route("/style.css",   [](AsyncWebServerRequest* request){ sendAsset(request, "text/css",  STYLE_CSS_GZ,   STYLE_CSS_GZ_LEN,   STYLE_CSS_ETAG,   CACHE_STATIC); });
+  route("/script.js",   [](AsyncWebServerRequest* request){ sendAsset(request, "application/javascript", SCRIPT_JS_GZ, SCRIPT_JS_GZ_LEN, SCRIPT_JS_ETAG, CACHE_STATIC); });
 
   // ---- RGB + HP control ----
-  server.on("/setrgb", HTTP_GET, [](){
-    uint16_t r   = server.hasArg("r")   ? server.arg("r").toInt()   : 0;
-    uint16_t g   = server.hasArg("g")   ? server.arg("g").toInt()   : 0;
-    uint16_t b   = server.hasArg("b")   ? server.arg("b").toInt()   : 0;
-    uint16_t bri = server.hasArg("bri") ? server.arg("bri").toInt() : 255;
-
-    webR   = constrain(r,   0, 255);
-    webG   = constrain(g,   0, 255);
-    webB   = constrain(b,   0, 255);
-    webBri = constrain(bri, 0, 255);
-
-    // Direct RGB control cancels party & test, uses web override
-    partyEnabled     = false;
-    musicSyncEnabled = false;
-
-    if (!webOverride) savedState = currentState;
-    webOverride = true;
-    alarmActive = false;
-    alarmIsTest = false;
-    stopAlarm();
-
-    applyOutputs();
-    server.send(200, "text/plain", "OK");
+  // Coalesced: 204 at once, applied with the next frame
+  routeInput("/setrgb", [](AsyncWebServerRequest* request){
+    uint16_t r   = hasArg(request, "r")   ? arg(request, "r").toInt()   : 0;
+    uint16_t g   = hasArg(request, "g")   ? arg(request, "g").toInt()   : 0;
+    uint16_t b   = hasArg(request, "b")   ? arg(request, "b").toInt()   : 0;
+    uint16_t bri = hasArg(request, "bri") ? arg(request, "bri").toInt() : 255;
+
+    webSetRGB(constrain(r, 0, 255), constrain(g, 0, 255),
+              constrain(b, 0, 255), constrain(bri, 0, 255));
+    request->send(204);
   });
 
-  server.on("/sethp", HTTP_GET, [](){
-    uint16_t val = server.hasArg("val") ? server.arg("val").toInt() : 0;
-    webHighPower = constrain(val, 0, 255);
-
-    partyEnabled     = false;
-    musicSyncEnabled = false;
-
-    if (!webOverride) savedState = currentState;
-    webOverride = true;
-    alarmActive = false;
-    alarmIsTest = false;
-    stopAlarm();
-
-    applyOutputs();
-    server.send(200, "text/plain", "OK");
+  routeInput("/sethp", [](AsyncWebServerRequest* request){
+    uint16_t val = hasArg(request, "val") ? arg(request, "val").toInt() : 0;
+    webSetHP(constrain(val, 0, 255));
+    request->send(204);
   });
 
   // ---- Time sync ----
-  server.on("/settime", HTTP_GET, [](){
-    if (!server.hasArg("epoch")) {
-      server.send(400, "text/plain", "epoch required");
+  route("/settime", [](AsyncWebServerRequest* request){
+    if (!hasArg(request, "epoch")) {
+      request->send(400, "text/plain", "epoch required");
       return;
     }
-    uint32_t e = (uint32_t) strtoul(server.arg("epoch").c_str(), nullptr, 10);
+    uint32_t e = (uint32_t) strtoul(arg(request, "epoch").c_str(), nullptr, 10);
     int32_t tz = 0;
-    if (server.hasArg("tz")) {
-      tz = (int32_t) strtol(server.arg("tz").c_str(), nullptr, 10);
+    if (hasArg(request, "tz")) {
+      tz = (int32_t) strtol(arg(request, "tz").c_str(), nullptr, 10);
     }
 
     noInterrupts();
     baseEpoch   = e;
-    baseMillis  = millis();
+    baseMillis  = clk.ms();
     tzOffsetMin = tz;
     interrupts();
 
-    Serial.print("Time synced. UTC epoch = "); Serial.print(baseEpoch);
-    Serial.print("  tz offset (min) = "); Serial.println(tzOffsetMin);
+    LOGI(TIME, "synced, UTC epoch = %u  tz offset (min) = %d", e, tz);
+    nextFire.valid = false; // clock and/or timezone moved
+    kickAlarmCheck();
 
-    server.send(200, "text/plain", "OK");
+    request->send(200, "text/plain", "OK");
+  });
+
+  // ---- Clock warp (testing) ----
+  // /clock[?warp=ms]  jumps schedule/calendar time ahead, at most a week
+  // per call (the scheduler compares deadlines within +-24 days).
+  // Ramps, buzzer, timers and the epoch all follow; uptime does not.
+  route("/clock", [](AsyncWebServerRequest* request){
+    if (hasArg(request, "warp")) {
+      uint32_t ms = (uint32_t) strtoul(arg(request, "warp").c_str(), nullptr, 10);
+      clk.warp(min(ms, CLOCK_WARP_MAX_MS));
+      nextFire.valid = false;
+      kickAlarmCheck();
+    }
+    JsonResponse res(request, 200);
+    res.w.beginObject();
+    res.w.addUInt("ms",       clk.ms());
+    res.w.addUInt("warpedMs", clk.warpedMs());
+    res.w.addUInt("epoch",    nowEpochUTC());
+    res.w.endObject();
+    res.send();
   });
 
   // ---- Alarms API ----
-  server.on("/alarms/list", HTTP_GET, [](){
-    String json = "{\"alarms\":[";
+  route("/alarms/list", [](AsyncWebServerRequest* request){
+    JsonResponse res(request, 200);
+    char buf[DATE_BUF_LEN];
+    res.w.beginObject();
+    res.w.beginArray("alarms");
     for (int i = 0; i < alarmCount; i++) {
-      if (i) json += ",";
-      json += "{";
-      json += "\"id\":" + String(alarms[i].id) + ",";
-      char buf[6];
+      res.w.beginObject();
+      res.w.addUInt("id", alarms[i].id);
       snprintf(buf, sizeof(buf), "%02u:%02u", alarms[i].hour, alarms[i].minute);
-      json += "\"time\":\"" + String(buf) + "\",";
-      json += "\"daysMask\":" + String(alarms[i].daysMask) + ",";
-      json += "\"enabled\":" + String(alarms[i].enabled ? "true" : "false");
-      json += "}";
+      res.w.addStr("time", buf);
+      res.w.addUInt("daysMask", alarms[i].daysMask);
+      if (alarms[i].date) {
+        formatDate(alarms[i].date, buf, sizeof(buf));
+        res.w.addStr("date", buf);
+      }
+      res.w.addBool("enabled", alarms[i].enabled);
+      res.w.beginArray("skip");
+      for (int k = 0; k < alarmSkipCount; k++) {
+        if (alarmSkips[k].id != alarms[i].id) continue;
+        formatDate(alarmSkips[k].day, buf, sizeof(buf));
+        res.w.valueStr(buf);
+      }
+      res.w.endArray();
+      res.w.endObject();
     }
-    json += "]}";
-    server.send(200, "application/json", json);
+    res.w.endArray();
+    // Next fire as UTC epoch (0 = none / clock not set)
+    uint32_t epochLocal = nowEpochLocal();
+    if (epochLocal) refreshNextFire(epochLocal);
+    bool hasNext = epochLocal && nextFire.found;
+    res.w.addUInt("next",   hasNext ? nextFire.fire.epoch + tzOffsetMin * 60 : 0);
+    res.w.addUInt("nextId", hasNext ? alarms[nextFire.fire.slot].id : 0);
+    res.w.endObject();
+    res.send();
   });
 
-  server.on("/alarms/add", HTTP_GET, [](){
+  // /alarms/add?time=HH:MM[&mask=0..127 | &days=SMTWTFS][&date=YYYY-MM-DD][&enabled=0/1]
+  // mask: bit0=Sun..bit6=Sat, 0 = every day; date makes it a one-shot alarm
+  route("/alarms/add", [](AsyncWebServerRequest* request){
     if (alarmCount >= MAX_ALARMS) {
-      server.send(400, "text/plain", "full");
+      request->send(400, "text/plain", "full");
       return;
     }
-    if (!server.hasArg("time")) {
-      server.send(400, "text/plain", "time HH:MM");
+    if (!hasArg(request, "time")) {
+      request->send(400, "text/plain", "time HH:MM");
       return;
     }
-    String t = server.arg("time");
+    String t = arg(request, "time");
     int h, m;
     if (sscanf(t.c_str(), "%d:%d", &h, &m) != 2) {
-      server.send(400, "text/plain", "bad time");
+      request->send(400, "text/plain", "bad time");
+      return;
+    }
+    uint32_t date = 0;
+    if (hasArg(request, "date") && arg(request, "date").length() &&
+        !parseDate(arg(request, "date"), date)) {
+      request->send(400, "text/plain", "bad date");
       return;
     }
 
-    String days = server.hasArg("days") ? server.arg("days") : "";
-    bool enabled = server.hasArg("enabled") ? (server.arg("enabled").toInt() != 0) : true;
+    bool enabled = hasArg(request, "enabled") ? (arg(request, "enabled").toInt() != 0) : true;
 
     AlarmItem a = {};
-    a.id       = millis() ^ random(0xFFFF);
+    a.id       = newAlarmId();
     a.hour     = constrain(h, 0, 23);
     a.minute   = constrain(m, 0, 59);
-    a.daysMask = daysMaskFromString(days);
+    if (hasArg(request, "mask")) a.daysMask = arg(request, "mask").toInt() & 0x7F;
+    else                         a.daysMask = daysMaskFromString(hasArg(request, "days") ? arg(request, "days") : "");
     a.enabled  = enabled;
-    a.lastFireMin = 0;
+    a.date     = (uint16_t)date;
 
     alarms[alarmCount++] = a;
     saveAlarmsToNVS();
+    alarmListChanged();
 
-    server.send(200, "text/plain", String(a.id));
+    request->send(200, "text/plain", String(a.id));
   });
 
-  server.on("/alarms/toggle", HTTP_GET, [](){
-    if (!server.hasArg("id") || !server.hasArg("enabled")) {
-      server.send(400, "text/plain", "id & enabled");
+  route("/alarms/toggle", [](AsyncWebServerRequest* request){
+    if (!hasArg(request, "id") || !hasArg(request, "enabled")) {
+      request->send(400, "text/plain", "id & enabled");
       return;
     }
-    uint32_t id = (uint32_t) strtoul(server.arg("id").c_str(), nullptr, 10);
-    bool en = server.arg("enabled").toInt() != 0;
-    for (int i = 0; i < alarmCount; i++) {
-      if (alarms[i].id == id) {
-        alarms[i].enabled = en;
-        break;
-      }
-    }
+    uint32_t id = (uint32_t) strtoul(arg(request, "id").c_str(), nullptr, 10);
+    int i = findAlarm(id);
+    if (i >= 0) alarms[i].enabled = arg(request, "enabled").toInt() != 0;
     saveAlarmsToNVS();
-    server.send(200, "text/plain", "OK");
+    alarmListChanged();
+    request->send(200, "text/plain", "OK");
   });
 
-  server.on("/alarms/delete", HTTP_GET, [](){
-    if (!server.hasArg("id")) {
-      server.send(400, "text/plain", "id");
+  route("/alarms/delete", [](AsyncWebServerRequest* request){
+    if (!hasArg(request, "id")) {
+      request->send(400, "text/plain", "id");
       return;
     }
-    uint32_t id = (uint32_t) strtoul(server.arg("id").c_str(), nullptr, 10);
-    for (int i = 0; i < alarmCount; i++) {
-      if (alarms[i].id == id) {
-        for (int j = i + 1; j < alarmCount; j++) {
-          alarms[j - 1] = alarms[j];
-        }
-        alarmCount--;
-        break;
-      }
+    uint32_t id = (uint32_t) strtoul(arg(request, "id").c_str(), nullptr, 10);
+    int i = findAlarm(id);
+    if (i >= 0) alarms[i] = alarms[--alarmCount]; // order doesn't matter
+    for (int k = 0; k < alarmSkipCount; ) {
+      if (alarmSkips[k].id == id) alarmSkips[k] = alarmSkips[--alarmSkipCount];
+      else k++;
     }
     saveAlarmsToNVS();
-    server.send(200, "text/plain", "OK");
+    alarmListChanged();
+    request->send(200, "text/plain", "OK");
+  });
+
+  // /alarms/skip?id=&date=YYYY-MM-DD[&on=0]  (on=0 removes the skip)
+  route("/alarms/skip", [](AsyncWebServerRequest* request){
+    uint32_t day;
+    if (!hasArg(request, "id") || !hasArg(request, "date") || !parseDate(arg(request, "date"), day)) {
+      request->send(400, "text/plain", "id & date");
+      return;
+    }
+    uint32_t id = (uint32_t) strtoul(arg(request, "id").c_str(), nullptr, 10);
+    bool on = hasArg(request, "on") ? arg(request, "on").toInt() != 0 : true;
+
+    // Drop this one and any that are already in the past
+    uint32_t today = nowEpochLocal() / AlarmCal::DAY;
+    int      before = alarmSkipCount;
+    for (int k = 0; k < alarmSkipCount; ) {
+      bool past = baseEpoch != 0 && alarmSkips[k].day < today;
+      if (past || (alarmSkips[k].id == id && alarmSkips[k].day == day)) alarmSkips[k] = alarmSkips[--alarmSkipCount];
+      else k++;
+    }
+    int         code  = 200;
+    const char* reply = "OK";
+    if (on) {
+      if (findAlarm(id) < 0)                      { code = 404; reply = "no such alarm"; }
+      else if (alarmSkipCount >= MAX_ALARM_SKIPS) { code = 400; reply = "full"; }
+      else alarmSkips[alarmSkipCount++] = { (uint16_t)id, (uint16_t)day };
+    }
+    if (code == 200 || alarmSkipCount != before) { // pruned even if refused
+      saveAlarmsToNVS();
+      alarmListChanged();
+    }
+    request->send(code, "text/plain", reply);
   });
 
   // ---- Default state ----
-  server.on("/default/save", HTTP_GET, [](){
+  route("/default/save", [](AsyncWebServerRequest* request){
     saveDefaultToNVS();
-    server.send(200, "application/json", "{\"ok\":true}");
+    notifyFlash(255, 255, 255, 400);
+    sendJsonOk(request);
   });
 
-  server.on("/default/apply", HTTP_GET, [](){
+  route("/default/apply", [](AsyncWebServerRequest* request){
     if (!defaultSaved) {
-      server.send(404, "application/json", "{\"ok\":false,\"reason\":\"no_default\"}");
+      JsonResponse res(request, 404);
+      res.w.beginObject();
+      res.w.addBool("ok", false);
+      res.w.addStr("reason", "no_default");
+      res.w.endObject();
+      res.send();
       return;
     }
-    loadDefaultFromNVS();
-
     webR         = defaultR;
     webG         = defaultG;
     webB         = defaultB;
@@ -513,99 +2080,148 @@ void setup() {
 
     stopAlarm();
     applyOutputs();
-    server.send(200, "application/json", "{\"ok\":true,\"applied\":true}");
+
+    JsonResponse res(request, 200);
+    res.w.beginObject();
+    res.w.addBool("ok", true);
+    res.w.addBool("applied", true);
+    res.w.endObject();
+    res.send();
   });
 
   // ---- Party / Music Sync ----
-  // /party/set?on=0/1&music=0/1&effect=0..2&speed=0..100&bri=0..100&mode=rgb|random|single&r=&g=&b=
-  server.on("/party/set", HTTP_GET, [](){
-    if (server.hasArg("on")) {
-      partyEnabled = server.arg("on").toInt() != 0;
-      if (partyEnabled) {
-        webOverride = false;
-      }
+  // /party/set?on=0/1&music=0/1&effect=n&speed=0..100&bri=0..100&mode=rgb|random|single&r=&g=&b=
+  //            &<param key>=v  (parameters of the selected effect, see /status "effects")
+  // Coalesced like /setrgb
+  routeInput("/party/set", [](AsyncWebServerRequest* request){
+    StateUpdate u;
+    if (hasArg(request, "on")) {
+      u.has |= StateUpdate::PARTY_ON;
+      u.partyOn = arg(request, "on").toInt() != 0;
     }
-    if (server.hasArg("music")) {
-      musicSyncEnabled = server.arg("music").toInt() != 0;
+    if (hasArg(request, "music")) {
+      u.has |= StateUpdate::MUSIC;
+      u.music = arg(request, "music").toInt() != 0;
     }
-    if (server.hasArg("effect")) {
-      int v = server.arg("effect").toInt();
-      partyEffect = constrain(v, 0, 2);
+    if (hasArg(request, "effect")) {
+      u.has |= StateUpdate::EFFECT;
+      u.effect = constrain(arg(request, "effect").toInt(), 0, PARTY_EFFECT_COUNT - 1);
+    }
+    uint8_t effect = (u.has & StateUpdate::EFFECT) ? u.effect : partyEffect;
+    const PartyEffect& fx = PARTY_EFFECTS[effect];
+    for (uint8_t i = 0; i < fx.paramCount; i++) {
+      if (hasArg(request, fx.params[i].key)) {
+        u.has |= StateUpdate::PARAMS;
+        u.paramEffect = effect;
+        u.paramMask  |= 1 << i;
+        u.params[i]   = constrain(arg(request, fx.params[i].key).toInt(), 0, 255);
+      }
     }
-    if (server.hasArg("speed")) {
-      int v = server.arg("speed").toInt();
-      partySpeed = constrain(v, 0, 100);
+    if (hasArg(request, "speed")) {
+      u.has |= StateUpdate::SPEED;
+      u.speed = constrain(arg(request, "speed").toInt(), 0, 100);
     }
-    if (server.hasArg("bri")) {
-      int v = server.arg("bri").toInt();
-      partyBrightness = constrain(v, 0, 100);
+    if (hasArg(request, "bri")) {
+      u.has |= StateUpdate::PARTY_BRI;
+      u.partyBri = constrain(arg(request, "bri").toInt(), 0, 100);
     }
-    if (server.hasArg("mode")) {
-      String m = server.arg("mode");
+    if (hasArg(request, "mode")) {
+      String m = arg(request, "mode");
       m.toLowerCase();
-      if (m == "rgb")      partyColorMode = 0;
-      else if (m == "random") partyColorMode = 1;
-      else if (m == "single") partyColorMode = 2;
+      u.has |= StateUpdate::MODE;
+      if (m == "rgb")         u.mode = 0;
+      else if (m == "random") u.mode = 1;
+      else if (m == "single") u.mode = 2;
+      else                    u.has &= ~StateUpdate::MODE;
     }
-    if (server.hasArg("r")) partySingleR = constrain(server.arg("r").toInt(), 0, 255);
-    if (server.hasArg("g")) partySingleG = constrain(server.arg("g").toInt(), 0, 255);
-    if (server.hasArg("b")) partySingleB = constrain(server.arg("b").toInt(), 0, 255);
+    if (hasArg(request, "r") || hasArg(request, "g") || hasArg(request, "b")) {
+      u.has |= StateUpdate::COLOR;
+      u.sr = hasArg(request, "r") ? constrain(arg(request, "r").toInt(), 0, 255) : partySingleR;
+      u.sg = hasArg(request, "g") ? constrain(arg(request, "g").toInt(), 0, 255) : partySingleG;
+      u.sb = hasArg(request, "b") ? constrain(arg(request, "b").toInt(), 0, 255) : partySingleB;
+    }
+    queueInput(u);
+    sendJsonOk(request);
+  });
 
-    if (!partyEnabled) {
-      applyOutputs();
+  // ---- Batched update ----
+  // POST /state  any subset of rgb, hp, override and party in one document:
+  // JSON (see parseStateJson) or, as application/octet-stream, a sequence
+  // of /ws control frames. Applied together with a single output update;
+  // answers with the resulting state. Nothing is applied if it is malformed.
+  routePost("/state", STATE_BODY_MAX, [](AsyncWebServerRequest* request){
+    const uint8_t* body = (const uint8_t*)request->_tempObject;
+    size_t len = request->contentLength();
+    if (len > STATE_BODY_MAX) {
+      request->send(413, "text/plain", "body too large");
+      return;
+    }
+    StateUpdate u;
+    bool ok;
+    {
+      Tracer::Scope phase(tracer, TRACE_PARSE);
+      if (!body || !len) ok = false;
+      else if (request->contentType().startsWith("application/octet-stream")) ok = parseControlFrames(body, len, u);
+      else ok = parseStateJson((const char*)body, len, u);
     }
+    if (!ok) {
+      request->send(400, "text/plain", "bad state document");
+      return;
+    }
+    applyStateUpdate(u);
 
-    server.send(200, "application/json", "{\"ok\":true}");
+    JsonResponse res(request, 200);
+    res.w.beginObject();
+    writeStatus(res.w);
+    res.w.endObject();
+    res.send();
   });
 
   // ---- Alarm configuration (ramp + type + timeout) ----
-  server.on("/alarmcfg/get", HTTP_GET, [](){
-    String json = "{";
-    json += "\"ok\":true,";
-    json += "\"leadSec\":" + String(alarmRampLeadSec) + ",";
-    json += "\"useLED\":" + String(alarmUseLED ? "true" : "false") + ",";
-    json += "\"useBuzzer\":" + String(alarmUseBuzzer ? "true" : "false") + ",";
-    json += "\"timeoutSec\":" + String(alarmTimeoutSec);
-    json += "}";
-    server.send(200, "application/json", json);
+  route("/alarmcfg/get", [](AsyncWebServerRequest* request){
+    JsonResponse res(request, 200);
+    res.w.beginObject();
+    res.w.addBool("ok", true);
+    writeAlarmCfg(res.w);
+    res.w.endObject();
+    res.send();
   });
 
   // /alarmcfg/set?lead=seconds&led=0/1&buzz=0/1&timeout=seconds
-  server.on("/alarmcfg/set", HTTP_GET, [](){
-    if (server.hasArg("lead")) {
-      uint32_t v = (uint32_t)server.arg("lead").toInt();
+  route("/alarmcfg/set", [](AsyncWebServerRequest* request){
+    if (hasArg(request, "lead")) {
+      uint32_t v = (uint32_t)arg(request, "lead").toInt();
       v = constrain(v, 10u, 7200u);
       alarmRampLeadSec = v;
     }
-    if (server.hasArg("led")) {
-      alarmUseLED = (server.arg("led").toInt() != 0);
+    if (hasArg(request, "led")) {
+      alarmUseLED = (arg(request, "led").toInt() != 0);
     }
-    if (server.hasArg("buzz")) {
-      alarmUseBuzzer = (server.arg("buzz").toInt() != 0);
+    if (hasArg(request, "buzz")) {
+      alarmUseBuzzer = (arg(request, "buzz").toInt() != 0);
     }
-    if (server.hasArg("timeout")) {
-      uint32_t v = (uint32_t)server.arg("timeout").toInt();
+    if (hasArg(request, "timeout")) {
+      uint32_t v = (uint32_t)arg(request, "timeout").toInt();
       v = constrain(v, 60u, 7200u);
       alarmTimeoutSec = v;
     }
     saveAlarmSettingsToNVS();
-
-    String json = "{";
-    json += "\"ok\":true,";
-    json += "\"leadSec\":" + String(alarmRampLeadSec) + ",";
-    json += "\"useLED\":" + String(alarmUseLED ? "true" : "false") + ",";
-    json += "\"useBuzzer\":" + String(alarmUseBuzzer ? "true" : "false") + ",";
-    json += "\"timeoutSec\":" + String(alarmTimeoutSec);
-    json += "}";
-    server.send(200, "application/json", json);
+    kickAlarmCheck();
+
+    JsonResponse res(request, 200);
+    res.w.beginObject();
+    res.w.addBool("ok", true);
+    writeAlarmCfg(res.w);
+    res.w.endObject();
+    res.send();
   });
 
   // ---- Alarm ramp test ----
   // /alarmtest/start?duration=seconds  (if omitted, uses alarmRampLeadSec)
-  server.on("/alarmtest/start", HTTP_GET, [](){
+  route("/alarmtest/start", [](AsyncWebServerRequest* request){
     uint32_t dur = alarmRampLeadSec;
-    if (server.hasArg("duration")) {
-      uint32_t d = (uint32_t)server.arg("duration").toInt();
+    if (hasArg(request, "duration")) {
+      uint32_t d = (uint32_t)arg(request, "duration").toInt();
       if (d > 0) dur = d;
     }
     dur = constrain(dur, 5u, 7200u);
@@ -615,76 +2231,136 @@ void setup() {
     beepStarted         = false;
     sunriseBeepEpochLocal  = 0;
     sunriseStartEpochLocal = 0;
-    alarmStartMs        = millis();
+    alarmStartMs        = clk.ms();
     alarmTestDurationMs = dur * 1000UL;
 
-    digitalWrite(buzzerPin, LOW);
-    hpWrite(0);
-
-    String json = "{\"ok\":true,\"duration\":" + String(dur) + "}";
-    server.send(200, "application/json", json);
+    setBuzzer(false);
+    alarmHp(0);
+    if (alarmUseLED) hpStartRamp(alarmStartMs, alarmTestDurationMs);
+    else             hpStopRamp();
+    sched.at(alarmStageTimer, alarmStartMs + alarmTestDurationMs);
+
+    JsonResponse res(request, 200);
+    res.w.beginObject();
+    res.w.addBool("ok", true);
+    res.w.addUInt("duration", dur);
+    res.w.endObject();
+    res.send();
   });
 
-  server.on("/alarmtest/stop", HTTP_GET, [](){
+  route("/alarmtest/stop", [](AsyncWebServerRequest* request){
     stopAlarm();
-    server.send(200, "application/json", "{\"ok\":true}");
+    sendJsonOk(request);
   });
 
   // ---- Alarm reset (stop any active alarm or test) ----
-  server.on("/alarm/reset", HTTP_GET, [](){
+  route("/alarm/reset", [](AsyncWebServerRequest* request){
     stopAlarm();
-    server.send(200, "application/json", "{\"ok\":true}");
+    sendJsonOk(request);
   });
 
   // ---- Status ----
-  server.on("/status", HTTP_GET, [](){
-    uint32_t epochUtc = nowEpochUTC();
-    String json = "{";
-    json += "\"epoch\":" + String(epochUtc) + ",";
-    json += "\"tz\":" + String(tzOffsetMin) + ",";
-    json += "\"defaultSaved\":" + String(defaultSaved ? "true" : "false") + ",";
-    json += "\"defaultState\":" + String(defaultStateNVS) + ",";
-    json += "\"state\":" + String(currentState) + ",";
-    json += "\"override\":" + String(webOverride ? "true" : "false") + ",";
-    json += "\"savedState\":" + String(savedState) + ",";
-    json += "\"alarmActive\":" + String(alarmActive ? "true" : "false") + ",";
-
-    json += "\"rgb\":{";
-    json += "\"r\":" + String(webR) + ",";
-    json += "\"g\":" + String(webG) + ",";
-    json += "\"b\":" + String(webB) + ",";
-    json += "\"bri\":" + String(webBri);
-    json += "},";
-
-    json += "\"hp\":" + String(webHighPower) + ",";
-
-    // Alarm config
-    json += "\"alarmCfg\":{";
-    json += "\"leadSec\":" + String(alarmRampLeadSec) + ",";
-    json += "\"useLED\":" + String(alarmUseLED ? "true" : "false") + ",";
-    json += "\"useBuzzer\":" + String(alarmUseBuzzer ? "true" : "false") + ",";
-    json += "\"timeoutSec\":" + String(alarmTimeoutSec);
-    json += "},";
-
-    // Party status
-    json += "\"party\":{";
-    json += "\"enabled\":" + String(partyEnabled ? "true" : "false") + ",";
-    json += "\"music\":"   + String(musicSyncEnabled ? "true" : "false") + ",";
-    json += "\"effect\":"  + String(partyEffect) + ",";
-    json += "\"speed\":"   + String(partySpeed) + ",";
-    json += "\"bri\":"     + String(partyBrightness) + ",";
-    json += "\"mode\":"    + String((int)partyColorMode) + ",";
-    char buf[8];
-    snprintf(buf, sizeof(buf), "#%02X%02X%02X", partySingleR, partySingleG, partySingleB);
-    json += "\"color\":\"" + String(buf) + "\"";
-    json += "}";
+  // ---- Render timing ----
+  // /render/stats[?reset=1]
+  route("/render/stats", [](AsyncWebServerRequest* request){
+    JsonResponse res(request, 200);
+    res.w.beginObject();
+    writeRenderStats(res.w);
+    res.w.endObject();
+    res.send();
+    if (hasArg(request, "reset")) resetRenderStats();
+  });
+
+  // ---- Benchmarks ----
+  // /bench  cycles per call of the hot paths, see writeBench(). Not a
+  // route(): writeBench() takes the state lock only where it reads lamp
+  // state, so this writes through a buffer of its own, not jsonBuf
+  server.on("/bench", HTTP_GET, [](AsyncWebServerRequest* request){
+    AsyncResponseStream* res = request->beginResponseStream("application/json");
+    char buf[256];
+    JsonWriter w(buf, sizeof(buf), res);
+    w.beginObject();
+    writeBench(w);
+    w.endObject();
+    w.flush();
+    request->send(res);
+  });
+
+  // ---- Metrics ----
+  // /metrics  Prometheus text format, see writeMetrics()
+  route("/metrics", [](AsyncWebServerRequest* request){
+    AsyncResponseStream* res = request->beginResponseStream("text/plain; version=0.0.4");
+    res->addHeader("Cache-Control", "no-store");
+    PromWriter w(*res);
+    writeMetrics(w);
+    request->send(res);
+  });
+
+  // ---- Log ----
+  // /log[?from=offset]  log text kept in RAM; X-Log-Next is the offset to
+  // pass next time, so polling with it follows the log like a tail -f
+  route("/log", [](AsyncWebServerRequest* request){
+    uint32_t from = hasArg(request, "from") ? (uint32_t) strtoul(arg(request, "from").c_str(), nullptr, 10) : 0;
+    AsyncResponseStream* res = request->beginResponseStream("text/plain");
+    res->addHeader("Cache-Control", "no-store");
+    res->addHeader("X-Log-Next", String(logHistory.offset()));
+    logHistory.read(from, *res);
+    request->send(res);
+  });
+
+  // ---- Request trace ----
+  // /trace[?clear=1]  the last TRACE_SPANS requests, oldest first
+  route("/trace", [](AsyncWebServerRequest* request){
+    JsonResponse res(request, 200);
+    res.w.beginObject();
+    writeTrace(res.w);
+    res.w.endObject();
+    res.send();
+    if (hasArg(request, "clear")) tracer.clear();
+  });
+
+  // ---- Flash wear ----
+  // /nvs/stats[?flush=1]  (flush: commit pending changes now)
+  route("/nvs/stats", [](AsyncWebServerRequest* request){
+    if (hasArg(request, "flush") && nvsDirty) nvsFlushDue = true; // loop() commits
+    JsonResponse res(request, 200);
+    res.w.beginObject();
+    writeNvsStats(res.w);
+    res.w.endObject();
+    res.send();
+  });
 
-    json += "}";
-    server.send(200, "application/json", json);
+  // /status[?since=version]
+  // The ETag is the state version; If-None-Match with it gets a 304.
+  // since= waits until the state moves on from that version (see
+  // statusWait) and then returns only the groups that changed, or
+  // everything if that version is no longer kept.
+  route("/status", [](AsyncWebServerRequest* request){
+    uint32_t version = stateVersion();
+    if (hasArg(request, "since")) {
+      uint32_t since = (uint32_t) strtoul(arg(request, "since").c_str(), nullptr, 10);
+      if (since != version) {
+        sendStatus(request, stateAt(since));
+      } else if (!statusWait(request, since)) {
+        AsyncWebServerResponse* res = request->beginResponse(503, "text/plain", "too many waiting");
+        res->addHeader("Retry-After", "5");
+        request->send(res);
+      }
+      return;
+    }
+    char etag[16];
+    formatStateEtag(version, etag, sizeof(etag));
+    if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == etag) {
+      sendNotModified(request, version);
+      return;
+    }
+    sendStatus(request, nullptr);
   });
 
+  ws.onEvent(wsEvent);
+  server.addHandler(&ws);
   server.begin();
-  Serial.println("HTTP server started.");
+  LOGI(SYS, "HTTP server started");
 
   // Initial state: use default color in state 1 if available
   currentState = defaultSaved ? 1 : 0;
@@ -696,300 +2372,561 @@ void setup() {
   beepStarted  = false;
 
   applyOutputs();
+  xTaskCreate(renderTask, "render", 4096, nullptr, RENDER_PRIO, &renderTaskHandle);
 }
 
 // ---------------- Loop ----------------
 void loop() {
-  server.handleClient();
-
-  // Button behavior:
-  // 1) If alarm/test active -> stop alarm
-  // 2) Else if party active  -> turn off party
-  // 3) Else if web override  -> cancel override (return to saved state)
-  // 4) Else cycle physical states
-  if (isrButtonPressed) {
-    noInterrupts();
-    isrButtonPressed = false;
-    interrupts();
+  uint32_t loopStartUs = micros();
+  uint32_t waitMs;
+  {
+    StateLock lock;
+
+    // Inputs still waiting for a frame come before anything done here
+    applyPendingInput();
+
+    // Button behavior:
+    // 1) If alarm/test active -> stop alarm
+    // 2) Else if party active  -> turn off party
+    // 3) Else if web override  -> cancel override (return to saved state)
+    // 4) Else cycle physical states
+    if (isrButtonPressed) {
+      noInterrupts();
+      isrButtonPressed = false;
+      interrupts();
+
+      if (alarmActive) {
+        stopAlarm();
+        LOGI(BUTTON, "alarm/test cancelled");
+      } else if (partyEnabled) {
+        partyEnabled = false;
+        LOGI(BUTTON, "party mode off");
+        applyOutputs();
+      } else if (webOverride) {
+        webOverride = false;
+        currentState = savedState;
+        LOGI(BUTTON, "cancel web override, restore state %d", currentState);
+        applyOutputs();
+      } else {
+        currentState = (currentState + 1) % 5;
+        LOGI(BUTTON, "state -> %d", currentState);
+        applyOutputs();
+      }
+    }
 
-    if (alarmActive) {
-      stopAlarm();
-      Serial.println("Button: alarm/test cancelled.");
-    } else if (partyEnabled) {
-      partyEnabled = false;
-      Serial.println("Button: party mode off.");
-      applyOutputs();
-    } else if (webOverride) {
-      webOverride = false;
-      currentState = savedState;
-      Serial.println("Button: cancel web override, restore state " + String(currentState));
-      applyOutputs();
-    } else {
-      currentState = (currentState + 1) % 5;
-      Serial.println("Button: state -> " + String(currentState));
-      applyOutputs();
+    // Alarm checks, alarm stages, buzzer pattern, party steps
+    waitMs = sched.run(clk.ms());
+
+    wsPushChanges();
+    statusPollService();
+    ws.cleanupClients();
+  }
+
+  // Flash writes stall for erases; never do them while holding the lock
+  if (nvsFlushDue) nvsFlush();
+
+  static uint32_t windowStartMs = 0;
+  static uint32_t windowMaxUs   = 0;
+  uint32_t loopUs = micros() - loopStartUs;
+  loopHist.add(loopUs);
+  if (loopUs > windowMaxUs) windowMaxUs = loopUs;
+  if (millis() - windowStartMs >= 1000) {
+    loopMaxUs     = windowMaxUs;
+    windowMaxUs   = 0;
+    windowStartMs = millis();
+  }
+
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(min(waitMs, LOOP_IDLE_MS)));
+}
+
+// ---------------- Render task ----------------
+// Takes queued sound onsets for party beats and redraws at RENDER_HZ. The
+// state lock is held for the whole frame, which is short: 9 pixels and a
+// PWM write. Timed work (alarm stages, party steps) runs from loop().
+void renderFrame() {
+  if (pendingInput.has) {
+    applyPendingInput();
+    wakeLoop();  // push the change to WebSocket clients
+  }
+  partyTakeSound();
+  if (partyEnabled && !alarmActive) partyRender();
+  if (notifyMs) notifyRender();
+
+  if (outputsDirty) {
+    outputsDirty = false;
+    drawOutputs();
+  }
+
+  if (compositor.compose() & OutputCompositor::PIXELS) {
+    if (pixelsDirty) framesDropped++;
+    presentPixels();
+  }
+
+  // Returns at once; a frame still on the wire defers this one a frame
+  if (pixelsDirty && pixelOut.show(pixels.getPixels(), numPixels * 3)) {
+    pixelsDirty = false;
+    showHist.add(pixelOut.lastCpuUs);
+  }
+  hpPresent(compositor.hp());
+}
+
+// Composed linear frame -> wire bytes, rounded. Like the 8-bit tables,
+// a lit channel never rounds down to off.
+void presentPixels() {
+  const Rgb16* px = compositor.frame();
+  for (int i = 0; i < numPixels; i++) {
+    uint16_t c[3] = { px[i].r, px[i].g, px[i].b };
+    uint8_t  o[3];
+    for (int k = 0; k < 3; k++) {
+      o[k] = c[k] >= 0xFF80 ? 255 : (c[k] + 0x80) >> 8;
+      if (c[k] && !o[k]) o[k] = 1;
     }
+    pixels.setPixelColor(i, o[0], o[1], o[2]);
   }
+  pixelsDirty = true;
+}
 
-  // Alarm scheduler
-  checkAlarms();
+void renderTask(void* arg) {
+  const uint32_t periodUs = 1000000UL / RENDER_HZ;
+  TickType_t lastWake = xTaskGetTickCount();
+  uint32_t dueUs = micros();
+
+  for (;;) {
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(1000 / RENDER_HZ));
+    dueUs += periodUs;
+
+    uint32_t startUs = micros();
+    int32_t late = (int32_t)(startUs - dueUs);
+    uint32_t jitter = late > 0 ? (uint32_t)late : 0;
+    if (jitter >= periodUs) {
+      renderOverruns++;
+      dueUs = startUs; // resync instead of bursting to catch up
+    }
 
-  // Active alarm / test engine
-  if (alarmActive) {
-    if (alarmIsTest) {
-      updateTestRamp();
-    } else {
-      updateRealAlarm();
+    {
+      StateLock lock;
+      renderFrame();
     }
-  } else {
-    runPartyMode();
+
+    uint32_t workUs = micros() - startUs;
+    int b = 0;
+    while (b < RENDER_JITTER_BUCKETS - 1 && jitter >= RENDER_JITTER_BOUNDS_US[b]) b++;
+    renderJitterHist[b]++;
+    if (jitter > renderJitterMax) renderJitterMax = jitter;
+    if (workUs > renderWorkMaxUs) renderWorkMaxUs = workUs;
+    renderFrames++;
   }
 }
 
+void writeRenderStats(JsonWriter& w) {
+  w.addUInt("hz",        RENDER_HZ);
+  w.addUInt("frames",    renderFrames);
+  w.addUInt("overruns",  renderOverruns);
+  w.addUInt("jitterMaxUs", renderJitterMax);
+  w.addUInt("workMaxUs", renderWorkMaxUs);
+  w.addUInt("showUs",        pixelOut.lastCpuUs);
+  w.addUInt("showMaxUs",     pixelOut.maxCpuUs);
+  w.addUInt("pixelTxUs",     pixelOut.lastTxUs);
+  w.addUInt("pixelFrames",   pixelOut.frames);
+  w.addUInt("pixelDeferred", pixelOut.deferred);
+  w.addUInt("soundEdges",    soundEdges.pushed);
+  w.addUInt("soundDropped",  soundEdges.dropped);
+  w.addUInt("soundOnsets",   soundOnsets);
+  w.addUInt("effectUs",      effectLastUs);
+  w.addUInt("effectMaxUs",   effectMaxUs);
+  w.addUInt("effectOverBudget", effectOverBudget);
+  w.addUInt("composed",      compositor.composed);
+  w.addUInt("unchanged",     compositor.unchanged);
+  w.beginArray("boundsUs");
+  for (int i = 0; i < RENDER_JITTER_BUCKETS - 1; i++) w.valueUInt(RENDER_JITTER_BOUNDS_US[i]);
+  w.endArray();
+  w.beginArray("jitter");
+  for (int i = 0; i < RENDER_JITTER_BUCKETS; i++) w.valueUInt(renderJitterHist[i]);
+  w.endArray();
+}
+
+void resetRenderStats() {
+  memset(renderJitterHist, 0, sizeof(renderJitterHist));
+  renderFrames    = 0;
+  renderOverruns  = 0;
+  renderJitterMax = 0;
+  renderWorkMaxUs = 0;
+  effectMaxUs      = 0;
+  effectOverBudget = 0;
+  compositor.composed  = 0;
+  compositor.unchanged = 0;
+  pixelOut.resetStats();
+}
+
 // ---------------- Outputs ----------------
+// Ask the render task to redraw the base / web layers on its next frame.
 void applyOutputs() {
-  if (alarmActive) return; // alarm/test owns HP LED
-
-  if (partyEnabled) {
-    // party engine owns pixels; HP is usually off or small strobe
-    return;
-  }
+  Tracer::Scope phase(tracer, TRACE_OUTPUT);
+  outputsDirty = true;
+}
 
-  if (webOverride) {
-    applyWebOutputs();
-  } else {
-    applyStateOutputs();
-  }
+// Party and alarm keep their own layers up to date; only hide them here
+void drawOutputs() {
+  applyStateOutputs();
+  if (webOverride) applyWebOutputs();
+  else             compositor.hide(LAYER_WEB);
+  if (!partyEnabled) compositor.hide(LAYER_PARTY);
 }
 
 void applyStateOutputs() {
+  const Rgb16 off = { 0, 0, 0 };
   switch (currentState) {
-    case 0: // All off
-      pixels.clear();
-      pixels.show();
-      hpWrite(0);
-      break;
-
     case 1: { // RGB default color, HP off
       uint8_t r   = defaultSaved ? defaultR   : 255;
       uint8_t g   = defaultSaved ? defaultG   : 180;
       uint8_t b   = defaultSaved ? defaultB   : 100;
       uint8_t bri = defaultSaved ? defaultBri : 255;
+      compositor.fill(LAYER_BASE, levelColor(r, g, b, bri), 0);
 
-      pixels.setBrightness(gamma8(bri));
-      for (int i = 0; i < numPixels; i++) {
-        pixels.setPixelColor(i, pixels.Color(r, g, b));
+      if (!webOverride && !partyEnabled && !alarmActive) { // the RGB controls show it
+        webR   = r;
+        webG   = g;
+        webB   = b;
+        webBri = bri;
       }
-      pixels.show();
-      hpWrite(0);
-
-      webR   = r;
-      webG   = g;
-      webB   = b;
-      webBri = bri;
       break;
     }
 
     case 2: // HP @10%, RGB off
-      pixels.clear();
-      pixels.show();
-      hpWrite(26);
+      compositor.fill(LAYER_BASE, off, hpLevel(26));
       break;
 
     case 3: // HP @50%
-      pixels.clear();
-      pixels.show();
-      hpWrite(128);
+      compositor.fill(LAYER_BASE, off, hpLevel(128));
       break;
 
     case 4: // HP @100%
-      pixels.clear();
-      pixels.show();
-      hpWrite(255);
+      compositor.fill(LAYER_BASE, off, hpLevel(255));
       break;
 
-    default:
-      pixels.clear();
-      pixels.show();
-      hpWrite(0);
+    default: // 0 = all off
+      compositor.fill(LAYER_BASE, off, 0);
       break;
   }
-
-  if (currentState != 1) {
-    pixels.setBrightness(255);
-  }
 }
 
 void applyWebOutputs() {
-  pixels.setBrightness(gamma8(webBri));
-  for (int i = 0; i < numPixels; i++) {
-    pixels.setPixelColor(i, pixels.Color(webR, webG, webB));
+  compositor.fill(LAYER_WEB, levelColor(webR, webG, webB, webBri), hpLevel(webHighPower));
+}
+
+// Alarm / ramp test: the alarm layer takes the HP LED (a running hpRamp
+// drives the pin itself); stopAlarm() hides it again.
+void alarmHp(uint16_t level) {
+  OutputCompositor::Layer& l = compositor.edit(LAYER_ALARM);
+  l.hp     = level;
+  l.covers = OutputCompositor::HP;
+}
+
+// Short confirmation over whatever is showing
+void notifyFlash(uint8_t r, uint8_t g, uint8_t b, uint32_t ms) {
+  Tracer::Scope phase(tracer, TRACE_OUTPUT);
+  notifyColor   = linearColor(r, g, b);
+  notifyStartMs = millis();
+  notifyMs      = ms;
+}
+
+void notifyRender() {
+  uint32_t elapsed = millis() - notifyStartMs;
+  if (elapsed >= notifyMs) {
+    notifyMs = 0;
+    compositor.hide(LAYER_NOTIFY);
+    return;
   }
-  pixels.show();
-  hpWrite(webHighPower);
+  OutputCompositor::Layer& l = compositor.edit(LAYER_NOTIFY);
+  for (int i = 0; i < numPixels; i++) l.px[i] = notifyColor;
+  l.alpha  = 65535 - (uint16_t)((uint64_t)elapsed * 65535 / notifyMs);
+  l.covers = OutputCompositor::PIXELS;
 }
 
 // ---------------- Party engine ----------------
 uint32_t colorWheel(uint8_t pos) {
-  pos = 255 - pos;
-  if (pos < 85) {
-    return pixels.Color(255 - pos * 3, 0, pos * 3);
-  }
-  if (pos < 170) {
-    pos -= 85;
-    return pixels.Color(0, pos * 3, 255 - pos * 3);
-  }
-  pos -= 170;
-  return pixels.Color(pos * 3, 255 - pos * 3, 0);
+  uint8_t r, g, b;
+  fx::wheel(pos, r, g, b);
+  return pixels.Color(r, g, b);
 }
 
-void runPartyMode() {
-  if (!partyEnabled || alarmActive) return;
-
-  uint32_t now = millis();
-
+// Steps come from partyTimer (every interval, or a slow fallback in music
+// mode) and, in music mode, from the render task: on predicted beats while
+// the tempo tracker is locked, else on each sound onset.
+uint32_t partyIntervalMs() {
   uint32_t baseInterval = map(partySpeed, 0, 100, 700, 60);
   if (baseInterval < 20) baseInterval = 20;
+  return musicSyncEnabled ? baseInterval * 4 : baseInterval;
+}
+
+// (Re)start stepping now, e.g. after the settings changed
+void partyKick() {
+  if (partyEnabled && !alarmActive) sched.at(partyTimer, clk.ms());
+}
+
+void partyTick() {
+  if (!partyEnabled || alarmActive) return; // stays idle until kicked
+  if (!musicSyncEnabled || !tempo.locked(micros())) partyStepNow(false);
+  sched.after(partyTimer, partyIntervalMs());
+}
 
+// Render task: drain every queued edge (also when party mode is off, so
+// nothing stale is left and the tracker keeps listening); a new onset is
+// a beat until the tracker has locked.
+void partyTakeSound() {
+  uint32_t edgeUs;
   bool beat = false;
-  int soundVal = digitalRead(soundPin);
-  bool level = (soundVal == HIGH);
-  if (musicSyncEnabled && level && !lastSoundLevel) {
+  while (soundEdges.pop(edgeUs)) {
+    if (soundOnsets && edgeUs - lastOnsetUs < SOUND_ONSET_GAP_US) continue;
+    lastOnsetUs = edgeUs;
+    soundOnsets++;
+    tempo.onset(edgeUs);
     beat = true;
   }
-  lastSoundLevel = level;
-
-  bool timeForStep = false;
-  if (musicSyncEnabled) {
-    if (beat) {
-      timeForStep = true;
-    } else if (now - lastPartyStepMs >= baseInterval * 4) {
-      timeForStep = true; // slow fallback
-    }
-  } else {
-    if (now - lastPartyStepMs >= baseInterval) {
-      timeForStep = true;
-    }
+  if (!partyEnabled || !musicSyncEnabled || alarmActive) return;
+
+  uint32_t nowUs = micros();
+  if (tempo.locked(nowUs)) {
+    partyBeatClock(nowUs);
+  } else if (beat) {
+    partyStepNow(true);
+    sched.after(partyTimer, partyIntervalMs()); // fallback counts from the beat
   }
+}
 
-  if (!timeForStep) return;
+// Step once per predicted beat, PARTY_BEAT_LEAD_US early. Phase corrections
+// move the prediction by a few ms, so a beat within half a period of the
+// last stepped one is the same beat.
+void partyBeatClock(uint32_t nowUs) {
+  uint32_t beatUs = tempo.nextBeat(nowUs);
+  if (beatUs - nowUs > PARTY_BEAT_LEAD_US) return;
+  if (beatUs - partyBeatUs < tempo.periodUs() / 2) return;
+  partyBeatUs = beatUs;
+  partyStepNow(true);
+  sched.after(partyTimer, partyIntervalMs());
+}
 
-  lastPartyStepMs = now;
+// A step starts a beat: it advances the effects and picks the color for
+// the beat. Drawing happens every frame in partyRender().
+void partyStepNow(bool beat) {
+  uint32_t nowUs = micros();
+  if (!musicSyncEnabled) {
+    partyBeatPeriodUs = partyIntervalMs() * 1000;
+  } else if (tempo.periodUs()) {
+    partyBeatPeriodUs = tempo.periodUs();
+  } else {
+    partyBeatPeriodUs = constrain(nowUs - partyStepUs, 100000UL, 2000000UL);
+  }
+  partyStepUs = nowUs;
   partyStep++;
-
-  // Base color
-  uint8_t baseR = partySingleR;
-  uint8_t baseG = partySingleG;
-  uint8_t baseB = partySingleB;
+  if (beat) partyBeats++;
 
   if (partyColorMode == 0) {
     uint32_t col = colorWheel((partyStep * 5) & 0xFF);
-    baseR = (col >> 16) & 0xFF;
-    baseG = (col >> 8)  & 0xFF;
-    baseB = col & 0xFF;
+    partyBaseR = (col >> 16) & 0xFF;
+    partyBaseG = (col >> 8)  & 0xFF;
+    partyBaseB = col & 0xFF;
   } else if (partyColorMode == 1) {
     if (!musicSyncEnabled || beat) {
-      baseR = (uint8_t)random(0, 256);
-      baseG = (uint8_t)random(0, 256);
-      baseB = (uint8_t)random(0, 256);
-      partySingleR = baseR;
-      partySingleG = baseG;
-      partySingleB = baseB;
-    } else {
-      baseR = partySingleR;
-      baseG = partySingleG;
-      baseB = partySingleB;
+      partySingleR = (uint8_t)random(0, 256);
+      partySingleG = (uint8_t)random(0, 256);
+      partySingleB = (uint8_t)random(0, 256);
     }
+    partyBaseR = partySingleR;
+    partyBaseG = partySingleG;
+    partyBaseB = partySingleB;
   } else {
-    baseR = partySingleR;
-    baseG = partySingleG;
-    baseB = partySingleB;
+    partyBaseR = partySingleR;
+    partyBaseG = partySingleG;
+    partyBaseB = partySingleB;
   }
+}
 
-  uint8_t maxBri = map(partyBrightness, 0, 100, 0, 255);
+// Render task, every frame while party mode is on (and no alarm runs)
+void partyRender() {
+  OutputCompositor::Layer& layer = compositor.edit(LAYER_PARTY);
+  partyFrames++;
+  if (partyShownEffect != partyEffect) {
+    partyShownEffect = partyEffect;
+    partyEffectMs = millis();
+    memset(layer.px, 0, sizeof(layer.px));
+    partyFxState = EffectState();
+  }
 
-  switch (partyEffect) {
-    case 0: { // Fade
-      uint16_t wavePos = (partyStep * 8) & 0x1FF;
-      uint8_t wave = (wavePos < 256) ? wavePos : (511 - wavePos);
-      uint16_t bri = (uint16_t)maxBri * wave / 255;
-      pixels.setBrightness(gamma8((uint8_t)bri));
-      for (int i = 0; i < numPixels; i++) {
-        pixels.setPixelColor(i, pixels.Color(baseR, baseG, baseB));
-      }
-      hpWrite(0);
-      break;
-    }
-    case 1: { // Strobe
-      bool on = (partyStep % 2) == 0;
-      uint8_t bri = on ? maxBri : 0;
-      pixels.setBrightness(gamma8(bri));
-      for (int i = 0; i < numPixels; i++) {
-        pixels.setPixelColor(i, pixels.Color(baseR, baseG, baseB));
-      }
-      hpWrite(on ? 60 : 0);
-      break;
-    }
-    case 2: { // Pulse chase
-      pixels.setBrightness(gamma8(maxBri));
-      int head = partyStep % numPixels;
-      for (int i = 0; i < numPixels; i++) {
-        int dist = abs(i - head);
-        uint8_t scale = (dist == 0) ? 255 : (dist == 1 ? 120 : 30);
-        uint8_t r = (uint16_t)baseR * scale / 255;
-        uint8_t g = (uint16_t)baseG * scale / 255;
-        uint8_t b = (uint16_t)baseB * scale / 255;
-        pixels.setPixelColor(i, pixels.Color(r, g, b));
-      }
-      hpWrite(0);
-      break;
+  uint32_t intoBeat = micros() - partyStepUs;
+  uint16_t beatPhase = intoBeat >= partyBeatPeriodUs ? 65535
+                     : (uint16_t)(((uint64_t)intoBeat << 16) / partyBeatPeriodUs);
+
+  EffectCtx ctx;
+  ctx.beats  = partyStep;
+  ctx.level  = curve16<BRIGHT_CURVE>(map(partyBrightness, 0, 100, 0, 255));
+  ctx.color  = fx::scale(linearColor(partyBaseR, partyBaseG, partyBaseB), ctx.level);
+  ctx.params = partyParams[partyEffect];
+
+  const PartyEffect& effect = PARTY_EFFECTS[partyEffect];
+  EffectFrame frame = { layer.px, numPixels, 0, partyFxState };
+  uint32_t t0 = micros();
+  effect.render(frame, millis() - partyEffectMs, beatPhase, ctx);
+  effectLastUs = micros() - t0;
+  if (effectLastUs > effectMaxUs) effectMaxUs = effectLastUs;
+  if (effectLastUs > effect.budgetUs) effectOverBudget++;
+
+  layer.hp     = hpLevel(frame.hp);
+  layer.alpha  = 65535;
+  layer.covers = OutputCompositor::PIXELS | OutputCompositor::HP;
+}
+
+void partyParamDefaults() {
+  for (uint8_t e = 0; e < PARTY_EFFECT_COUNT; e++) {
+    for (uint8_t i = 0; i < PARTY_EFFECTS[e].paramCount; i++) {
+      partyParams[e][i] = PARTY_EFFECTS[e].params[i].def;
     }
-    default:
-      pixels.clear();
-      hpWrite(0);
-      break;
   }
-
-  pixels.show();
 }
 
-// ---------------- Alarm scheduler ----------------
-void checkAlarms() {
-  if (alarmActive) return;
-  if (baseEpoch == 0) return;
+// Clamps to the parameter's range; false for an unknown effect/parameter
+bool partySetParam(uint8_t effect, uint8_t index, int value) {
+  if (effect >= PARTY_EFFECT_COUNT || index >= PARTY_EFFECTS[effect].paramCount) return false;
+  const EffectParam& p = PARTY_EFFECTS[effect].params[index];
+  partyParams[effect][index] = constrain(value, p.min, p.max);
+  return true;
+}
 
-  uint32_t epochLocal = nowEpochLocal();
-  if (epochLocal == 0) return;
+// Current values of the selected effect's parameters
+void writePartyParams(JsonWriter& w) {
+  const PartyEffect& effect = PARTY_EFFECTS[partyEffect];
+  w.beginObject("params");
+  for (uint8_t i = 0; i < effect.paramCount; i++) {
+    w.addUInt(effect.params[i].key, partyParams[partyEffect][i]);
+  }
+  w.endObject();
+}
 
-  time_t tt = (time_t)epochLocal;
-  struct tm tmlocal;
-  localtime_r(&tt, &tmlocal);
-  int wday = tmlocal.tm_wday;
-  int nowSecInDay = tmlocal.tm_hour * 3600 + tmlocal.tm_min * 60 + tmlocal.tm_sec;
+// The registry, for the UI: names and parameter metadata
+void writePartyEffects(JsonWriter& w) {
+  w.beginArray("effects");
+  for (uint8_t e = 0; e < PARTY_EFFECT_COUNT; e++) {
+    const PartyEffect& effect = PARTY_EFFECTS[e];
+    w.beginObject();
+    w.addStr("name", effect.name);
+    w.beginArray("params");
+    for (uint8_t i = 0; i < effect.paramCount; i++) {
+      const EffectParam& p = effect.params[i];
+      w.beginObject();
+      w.addStr("key",   p.key);
+      w.addStr("label", p.label);
+      w.addUInt("min",  p.min);
+      w.addUInt("max",  p.max);
+      w.addUInt("def",  p.def);
+      w.endObject();
+    }
+    w.endArray();
+    w.endObject();
+  }
+  w.endArray();
+}
 
-  uint32_t window = alarmRampLeadSec > 0 ? alarmRampLeadSec : 1;
-  int32_t bestDiff = INT32_MAX;
-  uint32_t bestAlarmEpoch = 0;
+// ---------------- Alarm scheduler ----------------
+// Local epoch of a one-shot alarm
+uint32_t oneShotEpoch(const AlarmItem& a) {
+  return a.date * AlarmCal::DAY + a.hour * 3600UL + a.minute * 60UL;
+}
 
+void rebuildAlarmIndex() {
+  alarmCal.clear();
   for (int i = 0; i < alarmCount; i++) {
-    AlarmItem &a = alarms[i];
+    const AlarmItem& a = alarms[i];
     if (!a.enabled) continue;
-    if (!isTodayEnabled(a.daysMask, wday)) continue;
-
-    int alarmSecInDay = a.hour * 3600 + a.minute * 60;
-    int32_t diff = alarmSecInDay - nowSecInDay; // seconds until alarm time TODAY
-
-    if (diff < 0) continue;                      // already passed today
-    if (diff > (int32_t)window) continue;        // not yet in ramp window
-    if (diff < bestDiff) {
-      bestDiff = diff;
-      bestAlarmEpoch = epochLocal + diff;
-    }
+    if (a.date) alarmCal.addOnce(i, oneShotEpoch(a));
+    else        alarmCal.addWeekly(i, a.hour, a.minute, a.daysMask);
+  }
+  for (int k = 0; k < alarmSkipCount; k++) {
+    int i = findAlarm(alarmSkips[k].id);
+    if (i >= 0) alarmCal.addSkip(i, alarmSkips[k].day);
   }
+  alarmCal.build();
+}
 
-  if (bestAlarmEpoch != 0) {
-    startSunrise(bestAlarmEpoch);
+// Disables the one-shots due before `epochLocal`: fired, or missed (the
+// clock was unset at boot, jumped, or the lamp was off). The calendar
+// drops them from the index either way; this keeps the list in step.
+void expireOneShots(uint32_t epochLocal) {
+  bool changed = false;
+  for (int i = 0; i < alarmCount; i++) {
+    AlarmItem& a = alarms[i];
+    if (!a.enabled || !a.date || oneShotEpoch(a) >= epochLocal) continue;
+    a.enabled = false;
+    changed   = true;
   }
+  if (!changed) return;
+  saveAlarmsToNVS();
+  rebuildAlarmIndex();
+}
+
+// Brings `nf` up to date for `epochLocal`, asking `cal` only when the
+// cached answer went stale. Returns the time it asked from, 0 if it didn't.
+// On the lamp's calendar via the overload below; /bench runs it on its own.
+uint32_t refreshNextFire(AlarmCal& cal, NextFire& nf, uint32_t epochLocal, uint32_t leadSec) {
+  // A clock set backwards past the last fire must not hold alarms back
+  if (nf.lastFired > epochLocal + leadSec) nf.lastFired = 0;
+  if (nf.valid && !(nf.found && nf.fire.epoch < epochLocal)) return 0;
+  uint32_t from = max(epochLocal, nf.lastFired + 1);
+  nf.found = cal.next(from, nf.fire);
+  nf.valid = true;
+  return from;
+}
+
+// The only place the calendar is queried; next() has passed over the
+// one-shots before `from`, this takes them off the list too
+void refreshNextFire(uint32_t epochLocal) {
+  uint32_t from = refreshNextFire(alarmCal, nextFire, epochLocal, alarmRampLeadSec);
+  if (from) expireOneShots(from);
+}
+
+// Call after any change to alarms[] / alarmSkips[]
+void alarmListChanged() {
+  rebuildAlarmIndex();
+  nextFire.valid = false;
+  kickAlarmCheck();
+}
+
+// Starts the alarm whose ramp window is open. Returns seconds until the
+// next window opens, 0 when nothing is pending (changes kick it again).
+uint32_t checkAlarms() {
+  if (alarmActive) return 0; // stopAlarm() kicks
+  if (baseEpoch == 0) return 0;
+
+  uint32_t epochLocal = nowEpochLocal();
+  if (epochLocal == 0) return 0;
+
+  refreshNextFire(epochLocal);
+  if (!nextFire.found) return 0;
+
+  uint32_t window = alarmRampLeadSec > 0 ? alarmRampLeadSec : 1;
+  uint32_t diff = nextFire.fire.epoch - epochLocal;  // seconds until alarm time
+  if (diff > window) return diff - window;           // not yet in ramp window
+
+  nextFire.lastFired = nextFire.fire.epoch;
+  nextFire.valid     = false;
+  // Every alarm due at this time fires with this sunrise; the one-shots
+  // among them (not only the one the calendar returned) are done after it
+  expireOneShots(nextFire.lastFired + 1);
+  startSunrise(nextFire.lastFired);
+  return 0;
+}
+
+// Re-evaluate alarms on the next loop() pass
+void kickAlarmCheck() {
+  sched.at(alarmCheckTimer, clk.ms());
+}
+
+void alarmCheckTick() {
+  uint32_t sec = checkAlarms();
+  if (sec == 0) return;
+  sec = min(sec, (uint32_t)3600); // one-shots can be months out; look again hourly
+  // Land on the wall-clock second boundary
+  uint32_t intoSecond = (clk.ms() - baseMillis) % 1000;
+  sched.after(alarmCheckTimer, sec * 1000UL - intoSecond);
 }
 
 void startSunrise(uint32_t alarmEpochLocal) {
@@ -1004,123 +2941,283 @@ void startSunrise(uint32_t alarmEpochLocal) {
     sunriseStartEpochLocal = sunriseBeepEpochLocal - alarmRampLeadSec;
   }
 
-  Serial.print("Alarm: scheduling ramp, beep at local epoch ");
-  Serial.println(sunriseBeepEpochLocal);
+  // The ramp runs in the LEDC fade unit; it may have started a little
+  // before this check ran
+  uint32_t nowMs = clk.ms();
+  uint32_t epochLocal = nowEpochLocal();
+  uint32_t untilBeepMs = (alarmEpochLocal - epochLocal) * 1000UL;
+  uint32_t leadMs = alarmRampLeadSec * 1000UL;
+  alarmStartMs = nowMs + untilBeepMs - leadMs;
+
+  alarmHp(0);
+  if (alarmUseLED) hpStartRamp(alarmStartMs, leadMs);
+  else             hpStopRamp();
+  sched.at(alarmStageTimer, nowMs + untilBeepMs);
+
+  LOGI(ALARM, "scheduling ramp, beep at local epoch %u", sunriseBeepEpochLocal);
 }
 
-// Buzzer pattern helper: 0.5s ON, 0.5s OFF while active
-void updateBuzzerPattern(bool active) {
-  static bool     wasActive = false;
-  static bool     state     = false;
-  static uint32_t lastMs    = 0;
+// Alarm stages (real alarm and ramp test):
+//   1st tick: alarm time / ramp at full -> hold full, start buzzer
+//   2nd tick: auto timeout (real) or end of the hold (test) -> stop
+void alarmStageTick() {
+  if (!alarmActive) return;
 
-  if (!active) {
-    wasActive = false;
-    state     = false;
-    digitalWrite(buzzerPin, LOW);
+  if (!beepStarted) {
+    beepStarted = true;
+    if (alarmUseLED && !hpRamp.active) alarmHp(65535);
+    if (alarmUseBuzzer) {
+      setBuzzer(true);
+      LOGI(ALARM, "buzzer ON");
+    }
+    uint32_t holdMs = alarmIsTest ? TEST_HOLD_MS : alarmTimeoutSec * 1000UL;
+    sched.at(alarmStageTimer, sched.due(alarmStageTimer) + holdMs);
     return;
   }
 
-  uint32_t now = millis();
+  if (!alarmIsTest) LOGI(ALARM, "auto timeout reached, stopping alarm");
+  stopAlarm();
+}
 
-  // On rising edge: start with buzzer ON immediately
-  if (!wasActive) {
-    wasActive = true;
-    state     = true;
-    lastMs    = now;
-    digitalWrite(buzzerPin, HIGH);
-    return;
-  }
+// Buzzer pattern: 0.5s ON, 0.5s OFF while active, starting ON
+void setBuzzer(bool active) {
+  if (active == buzzerOn) return;
+  buzzerOn    = active;
+  buzzerLevel = active;
+  digitalWrite(buzzerPin, active ? HIGH : LOW);
+  if (active) sched.after(buzzerTimer, BUZZER_HALF_PERIOD_MS);
+  else        sched.cancel(buzzerTimer);
+}
 
-  if (now - lastMs >= 500) {
-    lastMs = now;
-    state  = !state;
-    digitalWrite(buzzerPin, state ? HIGH : LOW);
-  }
+void buzzerTick() {
+  buzzerLevel = !buzzerLevel;
+  digitalWrite(buzzerPin, buzzerLevel ? HIGH : LOW);
+  sched.at(buzzerTimer, sched.due(buzzerTimer) + BUZZER_HALF_PERIOD_MS);
 }
 
-// Real alarm engine (ramp + buzzer)
-void updateRealAlarm() {
-  uint32_t epochLocal = nowEpochLocal();
-  if (epochLocal == 0) return;
+void stopAlarm() {
+  alarmActive          = false;
+  alarmIsTest          = false;
+  beepStarted          = false;
+  sunriseBeepEpochLocal  = 0;
+  sunriseStartEpochLocal = 0;
+  alarmStartMs         = 0;
+  alarmTestDurationMs  = 0;
+  hpStopRamp();
+  compositor.hide(LAYER_ALARM);
+  setBuzzer(false);
+  sched.cancel(alarmStageTimer);
+  kickAlarmCheck(); // alarm checks pause while an alarm runs
+  partyKick();
+  LOGI(ALARM, "alarm/test stopped");
+}
 
-  // HP LED ramp
-  if (alarmUseLED) {
-    uint8_t duty = 0;
-    if (alarmRampLeadSec == 0) {
-      duty = (epochLocal >= sunriseBeepEpochLocal) ? 255 : 0;
-    } else {
-      if (epochLocal <= sunriseStartEpochLocal) {
-        duty = 0;
-      } else if (epochLocal >= sunriseBeepEpochLocal) {
-        duty = 255;
-      } else {
-        uint32_t elapsed = epochLocal - sunriseStartEpochLocal;
-        if (elapsed > alarmRampLeadSec) elapsed = alarmRampLeadSec;
-        duty = (uint8_t)((elapsed * 255UL) / alarmRampLeadSec);
-      }
+// ---------------- Metrics ----------------
+// Everything here is a counter or histogram bumped where the event happens
+// (an increment, or a short bucket scan); /metrics only reads them.
+void writeMetrics(PromWriter& w) {
+  w.histogramUs("nightlamp_loop_seconds", "loop() iteration time, sleep excluded.", loopHist);
+  w.histogramUs("nightlamp_handler_seconds", "Web handler time with the state lock held.", handlerHist);
+  w.histogramUs("nightlamp_pixel_show_seconds", "CPU time of a pixel show (encode and start).", showHist);
+  w.counter("nightlamp_render_frames_total", "Render task frames.", renderFrames);
+  w.counter("nightlamp_render_overruns_total", "Render frames that started a whole period late.", renderOverruns);
+  w.counter("nightlamp_party_frames_total", "Frames rendered by the party effect engine.", partyFrames);
+  w.counter("nightlamp_frames_dropped_total", "Composed frames replaced before reaching the pixels.", framesDropped);
+  w.counter("nightlamp_pixel_deferred_total", "Pixel shows deferred a frame by a busy line.", pixelOut.deferred);
+  w.counter("nightlamp_sound_onsets_total", "Beats detected by the sound sensor.", soundOnsets);
+  w.counter("nightlamp_sound_dropped_total", "Sound sensor edges lost to a full queue.", soundEdges.dropped);
+  w.counter("nightlamp_party_beats_total", "Party steps taken on a heard or predicted beat.", partyBeats);
+  w.gauge("nightlamp_tempo_period_us", "Tracked beat period, 0 when unknown.", tempo.periodUs());
+  w.counter("nightlamp_inputs_total", "Control inputs recorded for coalescing.", inputsQueued);
+  w.counter("nightlamp_input_applies_total", "Coalesced input batches applied.", inputsApplied);
+  w.counter("nightlamp_log_dropped_total", "Log records dropped by a full ring.", logRing.dropped.load());
+  w.counter("nightlamp_nvs_commits_total", "NVS flushes that wrote anything.", nvsCommits);
+  w.counter("nightlamp_nvs_bytes_total", "Bytes written to NVS.", nvsBytes);
+  w.gauge("nightlamp_heap_free_bytes", "Free heap.", ESP.getFreeHeap());
+  w.gauge("nightlamp_heap_min_free_bytes", "Lowest free heap since boot.", ESP.getMinFreeHeap());
+  w.gauge("nightlamp_heap_largest_block_bytes", "Largest allocatable heap block.", ESP.getMaxAllocHeap());
+  w.gauge("nightlamp_wifi_stations", "Stations connected to the access point.", WiFi.softAPgetStationNum());
+  w.gauge("nightlamp_ws_clients", "WebSocket clients.", ws.count());
+  w.gauge("nightlamp_uptime_seconds", "Seconds since boot.", millis() / 1000);
+}
+
+// ---------------- Log output ----------------
+// Formats queued records, writes them to the UART (blocking only this
+// task) and keeps the text for /log.
+void logTask(void* arg) {
+  uint32_t droppedSeen = 0;
+  char line[128];
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    LogRecord r;
+    while (logRing.pop(r)) logOut(r, line, sizeof(line));
+
+    uint32_t dropped = logRing.dropped.load(std::memory_order_relaxed);
+    if (dropped != droppedSeen) {
+      LogRecord d = { (uint32_t)millis(), "LOG", "%u records dropped", { dropped - droppedSeen }, LOG_LVL_WARN };
+      droppedSeen = dropped;
+      logOut(d, line, sizeof(line));
     }
-    hpWrite(duty);
-  } else {
-    hpWrite(0);
   }
+}
 
-  // Buzzer only at/after alarm time
-  bool buzzerShouldBeActive = alarmUseBuzzer && (epochLocal >= sunriseBeepEpochLocal);
-  if (buzzerShouldBeActive && !beepStarted) {
-    beepStarted = true;
-    Serial.println("Alarm: buzzer ON.");
-  }
-  updateBuzzerPattern(buzzerShouldBeActive);
+void logOut(const LogRecord& r, char* line, size_t size) {
+  size_t len = logFormat(r, line, size);
+  Serial.write((const uint8_t*)line, len);
+  StateLock lock;
+  logHistory.append(line, len);
+}
 
-  // Auto timeout: stop alarm after configured duration past alarm time
-  if (alarmTimeoutSec > 0 && sunriseBeepEpochLocal > 0) {
-    if (epochLocal >= sunriseBeepEpochLocal + alarmTimeoutSec) {
-      Serial.println("Alarm: auto timeout reached, stopping alarm.");
-      stopAlarm();
+// ---------------- Request trace ----------------
+void writeTrace(JsonWriter& w) {
+  w.addUInt("spans", tracer.spans());
+  w.beginArray("requests");
+  for (size_t i = 0; i < tracer.size(); i++) {
+    const TraceSpan& t = tracer.span(i);
+    w.beginObject();
+    w.addUInt("ms",     t.atMs);
+    w.addStr ("uri",    t.uri);
+    w.addUInt("lockUs", t.lockUs);
+    for (uint8_t p = 0; p < TRACE_PHASES; p++) {
+      char key[12];
+      snprintf(key, sizeof(key), "%sUs", TRACE_PHASE_NAMES[p]);
+      w.addUInt(key, t.us[p]);
     }
+    w.endObject();
   }
+  w.endArray();
 }
 
-// Test ramp engine (visual + optional buzzer)
-void updateTestRamp() {
-  uint32_t nowMs = millis();
-  uint32_t elapsed = nowMs - alarmStartMs;
+// ---------------- Benchmarks ----------------
+// /bench runs the hot paths on synthetic input and reports cycles per call
+// (bench.h). The cases run on their own copies, not under the state lock;
+// it is taken only to copy the party params and for the statusJson case
+// (a few ms), so the render task loses a frame at most.
+const uint16_t BENCH_ALARM_COUNTS[] = { 8, 64, 256 };
+const char*    BENCH_CHECK_NAMES[]  = { "checkAlarms/8",  "checkAlarms/64",  "checkAlarms/256" };
+const char*    BENCH_BUILD_NAMES[]  = { "alarmRebuild/8", "alarmRebuild/64", "alarmRebuild/256" };
+
+static void writeBenchResult(JsonWriter& w, const BenchResult& r, uint32_t mhz) {
+  w.beginObject();
+  w.addStr("name",    r.name);
+  w.addUInt("iters",  r.iters);
+  w.addUInt("best",   r.bestCycles);
+  w.addUInt("median", r.medianCycles);
+  w.addUInt("bestNs", (uint32_t)((uint64_t)r.bestCycles * 1000 / mhz));
+  w.endObject();
+}
 
-  if (elapsed >= alarmTestDurationMs + 5000UL) {
-    // ramp done + 5s hold -> stop
-    stopAlarm();
-    return;
+// Deterministic alarm set: n weekly alarms, spread over the week
+static void benchFillCalendar(AlarmCal& cal, uint16_t n) {
+  uint32_t seed = 12345;
+  cal.clear();
+  for (uint16_t i = 0; i < n; i++) {
+    seed = seed * 1103515245 + 12345;
+    cal.addWeekly(i, (seed >> 16) % 24, (seed >> 8) % 60, (uint8_t)((seed >> 24) & 0x7F));
   }
+  cal.build();
+}
 
-  bool atFull = (elapsed >= alarmTestDurationMs);
-
-  // Optional buzzer during test: beep when ramp reaches full brightness
-  bool buzzerShouldBeActive = alarmUseBuzzer && atFull;
-  updateBuzzerPattern(buzzerShouldBeActive);
+// The square-law gamma8() that the curve tables replaced, kept only as
+// the baseline for the "brightCurve8" case
+static uint8_t benchGamma8(uint8_t x) {
+  uint16_t v = (uint16_t)x * (uint16_t)x;
+  v = (v + 254) / 255;
+  if (v > 255) v = 255;
+  return (uint8_t)v;
+}
 
-  if (!alarmUseLED) {
-    hpWrite(0);
-    return;
+void writeBench(JsonWriter& w) {
+  uint32_t mhz = ESP.getCpuFreqMHz();
+  w.addUInt("cpuMhz",  mhz);
+  w.addStr("build",    __DATE__ " " __TIME__);
+  w.addUInt("samples", BENCH_SAMPLES);
+  w.beginArray("results");
+
+  // The alarm index at 8/64/256 alarms: rebuilt as after a list change,
+  // and checkAlarms() looking right after one, its cache stale (its own
+  // calendar query; what it does beyond that is a few compares)
+  AlarmCal* cal = new (std::nothrow) AlarmCal;
+  if (cal) {
+    for (int k = 0; k < 3; k++) {
+      uint16_t n = BENCH_ALARM_COUNTS[k];
+      writeBenchResult(w, benchRun(BENCH_BUILD_NAMES[k], 4, [&](uint32_t) {
+        benchFillCalendar(*cal, n);
+      }), mhz);
+      benchFillCalendar(*cal, n);
+      writeBenchResult(w, benchRun(BENCH_CHECK_NAMES[k], 200, [&](uint32_t i) {
+        NextFire nf;
+        refreshNextFire(*cal, nf, 1700000000UL + i * 613, 600);
+        benchKeep(nf.fire.epoch);
+      }), mhz);
+    }
+    delete cal;
   }
 
-  if (atFull) {
-    hpWrite(255); // hold full brightness for a few seconds
-  } else {
-    uint8_t duty = (uint8_t)((elapsed * 255UL) / alarmTestDurationMs);
-    hpWrite(duty);
+  // One frame of each effect, into a scratch frame
+  static Rgb16       scratch[numPixels];
+  static EffectState scratchState;
+  uint8_t params[PARTY_EFFECT_COUNT][EFFECT_MAX_PARAMS];
+  {
+    StateLock lock;
+    memcpy(params, partyParams, sizeof(params));
+  }
+  for (uint8_t e = 0; e < PARTY_EFFECT_COUNT; e++) {
+    char name[24];
+    snprintf(name, sizeof(name), "effect/%s", PARTY_EFFECTS[e].name);
+    EffectCtx ctx = { 0, linearColor(255, 120, 40), 65535, params[e] };
+    writeBenchResult(w, benchRun(name, 100, [&](uint32_t i) {
+      ctx.beats = (uint16_t)(i / 16);
+      EffectFrame f = { scratch, numPixels, 0, scratchState };
+      PARTY_EFFECTS[e].render(f, i * 10, (uint16_t)(i * 4099), ctx);
+      benchKeep(scratch[0]);
+    }), mhz);
   }
-}
 
-void stopAlarm() {
-  alarmActive          = false;
-  alarmIsTest          = false;
-  beepStarted          = false;
-  sunriseBeepEpochLocal  = 0;
-  sunriseStartEpochLocal = 0;
-  alarmStartMs         = 0;
-  alarmTestDurationMs  = 0;
-  hpWrite(0);
-  updateBuzzerPattern(false);
-  Serial.println("Alarm/Test: stopped.");
+  // Layer stack -> frame, with one layer changing every call
+  static OutputCompositor comp;
+  comp.fill(LAYER_BASE, linearColor(255, 180, 100), 0);
+  writeBenchResult(w, benchRun("compose", 100, [&](uint32_t i) {
+    comp.fill(LAYER_PARTY, { (uint16_t)(i * 7), 0, 0 }, 0, OutputCompositor::PIXELS);
+    benchKeep(comp.compose());
+  }), mhz);
+
+  // Full /status document, not sent anywhere
+  static char statusBuf[1024];
+  BenchResult status;
+  {
+    StateLock lock;
+    status = benchRun("statusJson", 10, [&](uint32_t) {
+      JsonWriter sw(statusBuf, sizeof(statusBuf));
+      sw.beginObject();
+      writeStatus(sw);
+      sw.endObject();
+      benchKeep(sw.length());
+    });
+  }
+  writeBenchResult(w, status, mhz);
+
+  // Old brightness math against its table lookup
+  writeBenchResult(w, benchRun("gamma8", 1000, [&](uint32_t i) {
+    benchKeep(benchGamma8((uint8_t)i));
+  }), mhz);
+  writeBenchResult(w, benchRun("brightCurve8", 1000, [&](uint32_t i) {
+    benchKeep(curve8<BRIGHT_CURVE>((uint8_t)i));
+  }), mhz);
+  writeBenchResult(w, benchRun("colorCurve16", 1000, [&](uint32_t i) {
+    benchKeep(curve16<COLOR_CURVE>((uint8_t)i));
+  }), mhz);
+  writeBenchResult(w, benchRun("hpCurve16Fine", 1000, [&](uint32_t i) {
+    benchKeep(curve16Fine<HP_CURVE>((uint16_t)(i * 65)));
+  }), mhz);
+  writeBenchResult(w, benchRun("colorWheel", 1000, [&](uint32_t i) {
+    benchKeep(colorWheel((uint8_t)i));
+  }), mhz);
+  String days = "MTWTFSS";
+  writeBenchResult(w, benchRun("daysMaskFromString", 100, [&](uint32_t) {
+    benchKeep(daysMaskFromString(days));
+  }), mhz);
+
+  w.endArray();
 }
@@ -0,0 +1,167 @@
+#pragma once
+#include "platform.h"
+#include "compositor.h"  // Rgb16
+
+// Party effects, rendered every frame into a per-pixel framebuffer of
+// linear 16-bit channels (no global brightness, nothing lost to 8 bits
+// before the output stage).
+//
+// Contract: render(frame, timeMs, beatPhase, ctx)
+//   timeMs    - ms since the effect was selected
+//   beatPhase - 0..65535 through the current beat; a beat is a party step
+//               (a music beat, or one speed interval without music sync)
+//   ctx       - beat count, base color / level and the effect's parameters
+// The frame keeps its contents and its state block between calls (both
+// cleared when the effect changes), so an effect may fade what it drew
+// last time; anything else it remembers goes in the state block, never in
+// statics, as the same effect may render elsewhere (/bench). All math is
+// integer; budgetUs is what one frame may cost before it counts as over.
+//
+// PARTY_EFFECTS is the registry: index = effect number used by
+// /party/set, the WebSocket party frame and the UI.
+
+// Kept per rendering target, next to its pixels
+struct EffectState {
+  uint16_t lastBeats;  // twinkle: beat of the last burst
+};
+
+struct EffectFrame {
+  Rgb16*       px;
+  uint16_t     count;
+  uint8_t      hp;     // HP LED duty 0..255, 0 unless the effect sets it
+  EffectState& state;
+};
+
+struct EffectCtx {
+  uint16_t       beats;   // beat counter, +1 per step
+  Rgb16          color;   // base color, linear, brightness applied
+  uint16_t       level;   // brightness, linear 0..65535
+  const uint8_t* params;  // values in the order of the effect's params
+};
+
+typedef void (*EffectRender)(EffectFrame& f, uint32_t timeMs, uint16_t beatPhase, const EffectCtx& c);
+
+struct EffectParam {
+  const char* key;    // /party/set argument
+  const char* label;
+  uint8_t     min, max, def;
+};
+
+struct PartyEffect {
+  const char*        name;
+  EffectRender       render;
+  uint16_t           budgetUs;
+  const EffectParam* params;
+  uint8_t            paramCount;
+};
+
+// sRGB color -> linear channels; provided by the sketch (uses its curves)
+Rgb16 linearColor(uint8_t r, uint8_t g, uint8_t b);
+
+namespace fx {
+
+inline uint16_t scale16(uint16_t v, uint16_t s) { return ((uint32_t)v * s + v) >> 16; }
+
+inline Rgb16 scale(Rgb16 c, uint16_t s) { return { scale16(c.r, s), scale16(c.g, s), scale16(c.b, s) }; }
+
+inline void fill(EffectFrame& f, Rgb16 c) {
+  for (uint16_t i = 0; i < f.count; i++) f.px[i] = c;
+}
+
+// Hue 0..255 -> sRGB, same wheel as the party RGB color mode
+inline void wheel(uint8_t pos, uint8_t& r, uint8_t& g, uint8_t& b) {
+  pos = 255 - pos;
+  if (pos < 85)       { r = 255 - pos * 3; g = 0;             b = pos * 3; }
+  else if (pos < 170) { pos -= 85;  r = 0;             g = pos * 3;       b = 255 - pos * 3; }
+  else                { pos -= 170; r = pos * 3;       g = 255 - pos * 3; b = 0; }
+}
+
+// Position in beats, 16.16
+inline uint32_t beatPos(const EffectCtx& c, uint16_t beatPhase) {
+  return (uint32_t)c.beats << 16 | beatPhase;
+}
+
+// Triangle wave over 64 beats, squared so it looks even
+inline void fade(EffectFrame& f, uint32_t, uint16_t beatPhase, const EffectCtx& c) {
+  uint32_t p = (beatPos(c, beatPhase) >> 5) & 0x1FFFF;
+  uint16_t wave = p < 0x10000 ? p : 0x1FFFF - p;
+  fill(f, scale(c.color, scale16(wave, wave)));
+}
+
+// On for `duty` % of every second beat; the HP LED flashes along
+inline void strobe(EffectFrame& f, uint32_t, uint16_t beatPhase, const EffectCtx& c) {
+  uint16_t cycle = (uint16_t)((beatPos(c, beatPhase) & 0x1FFFF) >> 1);
+  bool on = cycle < (uint32_t)c.params[0] * 65535 / 100;
+  fill(f, on ? c.color : Rgb16{ 0, 0, 0 });
+  f.hp = on ? 60 : 0;
+}
+
+// One bright pixel per beat with dim neighbours
+inline void pulse(EffectFrame& f, uint32_t, uint16_t, const EffectCtx& c) {
+  int head = c.beats % f.count;
+  for (int i = 0; i < f.count; i++) {
+    int dist = abs(i - head);
+    f.px[i] = scale(c.color, dist == 0 ? 65535 : dist == 1 ? 30840 : 7710);
+  }
+}
+
+// Head moves one pixel per beat, smoothly; tail of `tail` pixels behind it
+inline void comet(EffectFrame& f, uint32_t, uint16_t beatPhase, const EffectCtx& c) {
+  uint32_t ring = (uint32_t)f.count << 8;                     // 1/256 pixel units
+  uint32_t head = (beatPos(c, beatPhase) >> 8) % ring;
+  uint32_t len  = ((uint32_t)c.params[0] + 1) << 8;
+  for (uint16_t i = 0; i < f.count; i++) {
+    uint32_t behind = (head + ring - ((uint32_t)i << 8)) % ring;
+    uint16_t s = behind < len ? 65535 - behind * 65535 / len : 0;
+    f.px[i] = scale(c.color, scale16(s, s));
+  }
+}
+
+// Random pixels light up and decay; a burst on every beat
+inline void twinkle(EffectFrame& f, uint32_t, uint16_t, const EffectCtx& c) {
+  uint16_t keep = 65535 - c.params[1] * 24;  // per frame
+  for (uint16_t i = 0; i < f.count; i++) f.px[i] = scale(f.px[i], keep);
+
+  uint8_t sparks = random(0, 1000) < c.params[0] * 2 ? 1 : 0;
+  if (c.beats != f.state.lastBeats) {
+    f.state.lastBeats = c.beats;
+    sparks += 1 + c.params[0] / 25;
+  }
+  while (sparks--) f.px[random(0, f.count)] = c.color;
+}
+
+// Color wheel spread over the ring, a full turn every 16 beats
+inline void rainbow(EffectFrame& f, uint32_t, uint16_t beatPhase, const EffectCtx& c) {
+  uint8_t turn = (uint8_t)(beatPos(c, beatPhase) >> 12);
+  for (uint16_t i = 0; i < f.count; i++) {
+    uint8_t r, g, b;
+    wheel(turn + (uint8_t)((uint32_t)i * c.params[0] / f.count), r, g, b);
+    f.px[i] = scale(linearColor(r, g, b), c.level);
+  }
+}
+
+constexpr EffectParam STROBE_PARAMS[]  = { { "duty",    "Duty %",  10, 90,  50 } };
+constexpr EffectParam COMET_PARAMS[]   = { { "tail",    "Tail",    1,  8,   3 } };
+constexpr EffectParam TWINKLE_PARAMS[] = { { "density", "Density", 1,  100, 30 },
+                                           { "decay",   "Decay",   1,  100, 50 } };
+constexpr EffectParam RAINBOW_PARAMS[] = { { "spread",  "Spread",  0,  255, 255 } };
+
+}  // namespace fx
+
+constexpr PartyEffect PARTY_EFFECTS[] = {
+  { "Fade",    fx::fade,    150, nullptr,             0 },
+  { "Strobe",  fx::strobe,  150, fx::STROBE_PARAMS,   1 },
+  { "Pulse",   fx::pulse,   200, nullptr,             0 },
+  { "Comet",   fx::comet,   300, fx::COMET_PARAMS,    1 },
+  { "Twinkle", fx::twinkle, 300, fx::TWINKLE_PARAMS,  2 },
+  { "Rainbow", fx::rainbow, 400, fx::RAINBOW_PARAMS,  1 },
+};
+
+constexpr uint8_t PARTY_EFFECT_COUNT = sizeof(PARTY_EFFECTS) / sizeof(PARTY_EFFECTS[0]);
+constexpr uint8_t EFFECT_MAX_PARAMS  = 2;
+
+constexpr bool effectParamsFit(uint8_t i = 0) {
+  return i == PARTY_EFFECT_COUNT ||
+         (PARTY_EFFECTS[i].paramCount <= EFFECT_MAX_PARAMS && effectParamsFit(i + 1));
+}
+static_assert(effectParamsFit(), "raise EFFECT_MAX_PARAMS");
@@ -0,0 +1,69 @@
+#pragma once
+#include <Arduino.h>
+
+// WS2812 output through the RMT peripheral without blocking.
+//
+// show() encodes the wire bytes (e.g. Adafruit_NeoPixel::getPixels()) into
+// RMT symbols and starts the transfer; the RMT driver feeds the peripheral
+// from the buffer by itself. The buffer is on the wire until the transfer
+// completes, so while the previous frame is still going out show() returns
+// false without touching it and the caller retries later. (A frame takes
+// far less than a render tick to send, so one buffer is enough.)
+//
+// Timing: 10 MHz RMT clock, 0 = 0.4 us high / 0.8 us low,
+// 1 = 0.8 us high / 0.4 us low; the idle-low gap between frames is the latch.
+template <size_t MaxBytes>
+class RmtPixelOut {
+ public:
+  static const uint32_t RMT_HZ      = 10000000;
+  static const uint32_t BIT_TICKS   = 12;  // 1.2 us per bit
+
+  bool begin(int gpio) {
+    pin = gpio;
+    ready = rmtInit(pin, RMT_TX_MODE, RMT_MEM_NUM_BLOCKS_1, RMT_HZ);
+    if (ready) rmtSetEOT(pin, LOW);
+    return ready;
+  }
+
+  // Previous frame still being transmitted
+  bool busy() { return inFlight && !rmtTransmitCompleted(pin); }
+
+  bool show(const uint8_t* bytes, size_t n) {
+    if (!ready) return false;
+    if (busy()) { deferred++; return false; }
+    uint32_t t0 = micros();
+
+    if (n > MaxBytes) n = MaxBytes;
+    rmt_data_t* out = buf;
+    for (size_t i = 0; i < n; i++) {
+      uint8_t v = bytes[i];
+      for (int bit = 7; bit >= 0; bit--) {
+        *out++ = (v >> bit) & 1 ? one() : zero();
+      }
+    }
+    inFlight = rmtWriteAsync(pin, buf, n * 8);
+
+    lastCpuUs = micros() - t0;
+    if (lastCpuUs > maxCpuUs) maxCpuUs = lastCpuUs;
+    lastTxUs = n * 8 * BIT_TICKS / (RMT_HZ / 1000000);
+    frames++;
+    return inFlight;
+  }
+
+  void resetStats() { maxCpuUs = 0; frames = 0; deferred = 0; }
+
+  uint32_t lastCpuUs = 0;  // encode + start of the last frame
+  uint32_t maxCpuUs  = 0;
+  uint32_t lastTxUs  = 0;  // time on the wire of the last frame
+  uint32_t frames    = 0;
+  uint32_t deferred  = 0;  // show() calls that found the line busy
+
+ private:
+  static rmt_data_t zero() { rmt_data_t d; d.level0 = 1; d.duration0 = 4; d.level1 = 0; d.duration1 = 8; return d; }
+  static rmt_data_t one()  { rmt_data_t d; d.level0 = 1; d.duration0 = 8; d.level1 = 0; d.duration1 = 4; return d; }
+
+  int        pin      = -1;
+  bool       ready    = false;
+  bool       inFlight = false;
+  rmt_data_t buf[MaxBytes * 8];
+};
@@ -0,0 +1,39 @@
+#pragma once
+
+// What the engine headers (scheduler, alarm calendar, tempo tracker,
+// effects, compositor, JSON writer, ...) need from the platform.
+//
+// On the device this is Arduino.h. Anywhere else (a host program that
+// drives the engines with recorded input, a profiler) the few Arduino
+// helpers they use come from the standard library; the program provides
+// millis(), micros(), random(lo, hi) and cpuCycles().
+#ifdef ARDUINO
+#include <Arduino.h>
+
+inline uint32_t cpuCycles() { return ESP.getCycleCount(); }
+#else
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+#ifndef constrain
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#endif
+
+uint32_t millis();
+uint32_t micros();
+long     random(long lo, long hi);
+uint32_t cpuCycles();
+
+// Byte sink, as far as JsonWriter uses Arduino's Print
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(const uint8_t* data, size_t len) = 0;
+};
+#endif
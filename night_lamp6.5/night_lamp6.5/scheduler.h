@@ -0,0 +1,124 @@
+#pragma once
+#include "platform.h"
+
+// Deadline scheduler for the main loop. A fixed set of timers (one per
+// subsystem, registered at setup) is kept in a binary min-heap ordered by
+// due time in ms of a time source (millis() unless one is given).
+// Comparisons are wraparound-safe as long as no deadline is more than
+// ~24 days away. Nothing is allocated.
+//
+// Callbacks run from run() and usually re-arm their own timer; use
+// due(id) + period for drift-free repetition.
+class Scheduler {
+ public:
+  typedef void (*Callback)();
+  typedef uint32_t (*TimeSource)();
+  static const uint8_t  MAX_TIMERS = 8;
+  static const uint32_t IDLE       = UINT32_MAX;
+
+  // onEarlier is called whenever the earliest deadline moves closer, so a
+  // sleeping loop can be woken up
+  explicit Scheduler(Callback onEarlier = nullptr, TimeSource clock = hardwareMs)
+    : count(0), heapSize(0), earlierHook(onEarlier), now(clock) {}
+
+  // Register a timer; returns its id or -1 when full
+  int8_t add(Callback cb) {
+    if (count >= MAX_TIMERS) return -1;
+    timers[count].cb  = cb;
+    timers[count].due = 0;
+    timers[count].pos = -1;
+    return (int8_t)count++;
+  }
+
+  // (Re)arm a timer for an absolute millis() deadline
+  void at(int8_t id, uint32_t dueMs) {
+    Timer& t = timers[id];
+    t.due = dueMs;
+    if (t.pos < 0) {
+      t.pos = heapSize;
+      heap[heapSize++] = id;
+    }
+    siftDown(siftUp(t.pos));
+    if (t.pos == 0 && earlierHook) earlierHook();
+  }
+
+  void after(int8_t id, uint32_t delayMs) { at(id, now() + delayMs); }
+
+  void cancel(int8_t id) {
+    if (timers[id].pos >= 0) removeAt(timers[id].pos);
+  }
+
+  bool     armed(int8_t id) const { return timers[id].pos >= 0; }
+  uint32_t due(int8_t id) const   { return timers[id].due; }
+
+  // Run every due callback. Returns ms until the next deadline, or IDLE.
+  uint32_t run(uint32_t nowMs) {
+    while (heapSize && (int32_t)(nowMs - timers[heap[0]].due) >= 0) {
+      int8_t id = heap[0];
+      removeAt(0);
+      timers[id].cb();
+    }
+    if (!heapSize) return IDLE;
+    int32_t left = (int32_t)(timers[heap[0]].due - nowMs);
+    return left > 0 ? (uint32_t)left : 0;
+  }
+
+ private:
+  struct Timer {
+    Callback cb;
+    uint32_t due;
+    int8_t   pos;  // index in heap, -1 when not armed
+  };
+
+  Timer    timers[MAX_TIMERS];
+  int8_t   heap[MAX_TIMERS];
+  uint8_t  count;
+  int8_t   heapSize;
+  Callback   earlierHook;
+  TimeSource now;
+
+  static uint32_t hardwareMs() { return millis(); }
+
+  bool before(int8_t a, int8_t b) const {
+    return (int32_t)(timers[a].due - timers[b].due) < 0;
+  }
+
+  void place(int8_t pos, int8_t id) {
+    heap[pos] = id;
+    timers[id].pos = pos;
+  }
+
+  int8_t siftUp(int8_t pos) {
+    int8_t id = heap[pos];
+    while (pos > 0) {
+      int8_t parent = (pos - 1) / 2;
+      if (!before(id, heap[parent])) break;
+      place(pos, heap[parent]);
+      pos = parent;
+    }
+    place(pos, id);
+    return pos;
+  }
+
+  void siftDown(int8_t pos) {
+    int8_t id = heap[pos];
+    for (;;) {
+      int8_t child = 2 * pos + 1;
+      if (child >= heapSize) break;
+      if (child + 1 < heapSize && before(heap[child + 1], heap[child])) child++;
+      if (!before(heap[child], id)) break;
+      place(pos, heap[child]);
+      pos = child;
+    }
+    place(pos, id);
+  }
+
+  void removeAt(int8_t pos) {
+    int8_t id = heap[pos];
+    timers[id].pos = -1;
+    heapSize--;
+    if (pos == heapSize) return;
+    place(pos, heap[heapSize]);
+    siftDown(siftUp(pos));
+  }
+};
@@ -1,699 +1,491 @@
-#pragma once 
-const char SCRIPT_JS[] PROGMEM = R"rawliteral(
-// ==== Helpers ====
-function debounce(fn, wait){ let t; return (...a)=>{ clearTimeout(t); t=setTimeout(()=>fn(...a), wait); }; }
-function hexToRgb(hex){ const v=hex.replace('#',''); return { r:parseInt(v.substr(0,2),16), g:parseInt(v.substr(2,2),16), b:parseInt(v.substr(4,2),16) }; }
-function rgbToHex(r,g,b){ const h=n=>n.toString(16).padStart(2,'0'); return `#${h(r)}${h(g)}${h(b)}`.toUpperCase(); }
-function pad2(n){ return n.toString().padStart(2,'0'); }
-
-// ==== Device time (no RTC) ====
-let deviceEpoch = null;   // UTC epoch from /status
-let lastSyncMs  = 0;
-
-function updateTimeBox(){
-  if (deviceEpoch == null) return;
-  const d = new Date(deviceEpoch*1000);  // Date takes UTC and displays local
-  const hh = pad2(d.getHours()), mm = pad2(d.getMinutes()), ss = pad2(d.getSeconds());
-  const timeStr = `${hh}:${mm}:${ss}`;
-  const dateStr = d.toLocaleDateString(undefined, { weekday:'short', year:'numeric', month:'short', day:'numeric' });
-
-  const elTime = document.getElementById('rtcTime');
-  const elDate = document.getElementById('rtcDate');
-  const elStat = document.getElementById('rtcStatus');
-
-  if (elTime) elTime.textContent = timeStr;
-  if (elDate) elDate.textContent = dateStr;
-  if (elStat) elStat.textContent = 'Source: internal';
-}
-
-// ==== DOM ====
-const colorPicker      = document.getElementById('colorPicker');
-const lampCircle       = document.getElementById('lampCircle');
-const lampColorText    = document.getElementById('lampColor');
-const brightnessSlider = document.getElementById('brightness'); // RGB only
-const hpLEDSlider      = document.getElementById('hpLED');      // HP LED only
-const brightnessText   = document.getElementById('lampBrightness');
-const syncBtn          = document.getElementById('syncTimeBtn');
-
-// --- Find the existing "Set as default" button and inject "Set back to default"
-let setDefaultBtn = document.getElementById('setDefaultBtn');
-if (!setDefaultBtn) {
-  // robust fallback: search by visible text
-  const candidates = Array.from(document.querySelectorAll('button'));
-  setDefaultBtn = candidates.find(b => (b.textContent||'').trim().toLowerCase() === 'set as default');
-}
-let applyDefaultBtn = document.getElementById('applyDefaultBtn');
-if (!applyDefaultBtn && setDefaultBtn && setDefaultBtn.parentElement) {
-  applyDefaultBtn = document.createElement('button');
-  applyDefaultBtn.id = 'applyDefaultBtn';
-  applyDefaultBtn.className = setDefaultBtn.className || 'default-btn';
-  applyDefaultBtn.style.marginTop = '8px';
-  applyDefaultBtn.textContent = 'Set back to default';
-  setDefaultBtn.insertAdjacentElement('afterend', applyDefaultBtn);
-}
-
-// ==== Default state actions ====
-async function saveDefault(){
-  try{
-    await fetch('/default/save', { cache:'no-store' });
-    if (setDefaultBtn){ setDefaultBtn.textContent = 'Saved!'; setTimeout(()=> setDefaultBtn.textContent='Set as default', 1200); }
-    await fetchStatus();
-  }catch(_){}
-}
-
-async function applyDefault(){
-  try{
-    const r = await fetch('/default/apply', { cache:'no-store' });
-    if (r.ok){
-      if (applyDefaultBtn){ applyDefaultBtn.textContent = 'Restored!'; setTimeout(()=> applyDefaultBtn.textContent='Set back to default', 1200); }
-      await fetchStatus();
-    }
-  }catch(_){}
-}
-
-if (setDefaultBtn) setDefaultBtn.addEventListener('click', saveDefault);
-if (applyDefaultBtn) applyDefaultBtn.addEventListener('click', applyDefault);
-
-// ==== RGB / HP bindings ====
-async function sendRGB(){
-  if (!colorPicker) return;
-  const {r,g,b}=hexToRgb(colorPicker.value);
-  const bri = brightnessSlider ? Math.round((parseInt(brightnessSlider.value||'100')/100)*255) : 255;
-  try{ await fetch(`/setrgb?r=${r}&g=${g}&b=${b}&bri=${bri}`); }catch(_){}
-}
-async function sendHP(){
-  if (!hpLEDSlider) return;
-  const hp = Math.round((parseInt(hpLEDSlider.value||'0')/100)*255);
-  try{ await fetch(`/sethp?val=${hp}`); }catch(_){}
-}
-const sendRGBdeb = debounce(sendRGB,180);
-const sendHPdeb  = debounce(sendHP,180);
-
-if (colorPicker && lampCircle) {
-  colorPicker.addEventListener('input', ()=>{
-    lampCircle.style.backgroundColor = colorPicker.value;
-    if (lampColorText) lampColorText.textContent = colorPicker.value.toUpperCase();
-    sendRGBdeb();
-  });
-}
-if (brightnessSlider && brightnessText) {
-  brightnessSlider.addEventListener('input', ()=>{
-    const pct = parseInt(brightnessSlider.value||'100');
-    brightnessText.textContent = `${pct}%`;
-    if (lampCircle) lampCircle.style.opacity = 0.3 + (pct/100)*0.7;
-    sendRGBdeb(); // only RGB brightness
-  });
-}
-if (hpLEDSlider) {
-  hpLEDSlider.addEventListener('input', ()=>{ sendHPdeb(); });
-}
-
-// ==== Time/status sync ====
-async function fetchStatus(){
-  try{
-    const resp = await fetch('/status', { cache:'no-store' });
-    const js = await resp.json();
-
-    // device UTC epoch
-    if (typeof js.epoch === 'number') {
-      deviceEpoch = js.epoch;
-      lastSyncMs  = Date.now();
-      updateTimeBox();
-    }
-
-    // enable/disable "Set back to default" based on saved flag
-    if (applyDefaultBtn){
-      applyDefaultBtn.disabled = !js.defaultSaved;
-      applyDefaultBtn.title = js.defaultSaved ? '' : 'No default saved yet';
-    }
-
-    // Color preview
-    const hex = rgbToHex(js.rgb.r, js.rgb.g, js.rgb.b);
-    if (colorPicker)   colorPicker.value = hex;
-    if (lampCircle)    lampCircle.style.backgroundColor = hex;
-    if (lampColorText) lampColorText.textContent = hex;
-
-    // RGB brightness
-    const rgbPct = Math.round(js.rgb.bri/2.55);
-    if (brightnessSlider){
-      brightnessSlider.value = rgbPct;
-      if (brightnessText) brightnessText.textContent = `${rgbPct}%`;
-      if (lampCircle) lampCircle.style.opacity = 0.3 + (rgbPct/100)*0.7;
-    }
-
-    // HP LED
-    const hpPct = Math.round(js.hp/2.55);
-    if (hpLEDSlider) hpLEDSlider.value = hpPct;
-
-  }catch(e){}
-}
-window.addEventListener('load', fetchStatus);
-setInterval(fetchStatus, 5000); // occasional poll
-
-// Tick displayed device time every second
-setInterval(()=>{
-  if (deviceEpoch != null){
-    const now = Date.now();
-    const delta = Math.floor((now - lastSyncMs)/1000);
-    if (delta > 0){
-      deviceEpoch += delta;
-      lastSyncMs  += delta*1000;
-      updateTimeBox();
-    }
-  }
-}, 1000);
-
-// Manual "Sync Time" from browser -> device (/settime)
-if (syncBtn){
-  syncBtn.addEventListener('click', async ()=>{
-    const epoch = Math.floor(Date.now()/1000);
-    const tz    = new Date().getTimezoneOffset(); // minutes; east of UTC => negative
-    try {
-      await fetch(`/settime?epoch=${epoch}&tz=${tz}`);
-      await fetchStatus();
-      syncBtn.textContent = 'Synced!';
-      setTimeout(()=> syncBtn.textContent = 'Sync Time from Browser', 1500);
-    } catch(_) {}
-  });
-}
-
-// ==== PARTY / UI niceties (unchanged) ====
-const partyToggle = document.getElementById('partyMode');
-const partySettings = document.getElementById('partySettings');
-if (partyToggle && partySettings) {
-  partyToggle.addEventListener('change', ()=>{
-    if (partyToggle.checked) {
-      partySettings.style.display='block';
-      setTimeout(()=>{ partySettings.style.opacity='1'; partySettings.style.transform='translateY(0)'; },10);
-    } else {
-      partySettings.style.opacity='0'; partySettings.style.transform='translateY(-10px)';
-      setTimeout(()=>{ partySettings.style.display='none'; },300);
-    }
-  });
-}
-const customizeBtn = document.getElementById('customizeBtn');
-const customPalette = document.getElementById('customPalette');
-const paletteStatus = document.getElementById('paletteStatus');
-const partyColorPicker = document.getElementById('partyColorPicker');
-if (customizeBtn) {
-  customizeBtn.addEventListener('click', ()=>{
-    const isCustom = paletteStatus.textContent==='Custom';
-    if (isCustom){ paletteStatus.textContent='Default'; customPalette.classList.remove('show'); customizeBtn.textContent='Customize';
-      if (lampCircle) lampCircle.style.backgroundColor='#abcdef';
-      if (colorPicker) colorPicker.value='#abcdef';
-      if (lampColorText) lampColorText.textContent='#ABCDEF';
-      sendRGBdeb();
-    } else { paletteStatus.textContent='Custom'; customPalette.classList.add('show'); customizeBtn.textContent='Default'; }
-  });
-  if (partyColorPicker) {
-    partyColorPicker.addEventListener('input', ()=>{
-      if (lampCircle) lampCircle.style.backgroundColor=partyColorPicker.value;
-      if (lampColorText) lampColorText.textContent=partyColorPicker.value.toUpperCase();
-      if (colorPicker) colorPicker.value=partyColorPicker.value;
-      sendRGBdeb();
-    });
-  }
-}
-
-// Only apply the single-selection behaviour to the Party effects,
-// not to the alarm-type buttons in Advanced Settings.
-document.querySelectorAll('#partySettings .effect').forEach(effect=>{
-  effect.addEventListener('click', ()=>{
-    document.querySelectorAll('#partySettings .effect').forEach(e=>e.classList.remove('active'));
-    effect.classList.add('active');
-    effect.style.transform='scale(0.95)';
-    setTimeout(()=>{ effect.style.transform='scale(1)'; },150);
-  });
-});
-
-// ==== Alarms UI (unchanged) ====
-const hourInput      = document.getElementById('hour');
-const minuteInput    = document.getElementById('minute');
-const addAlarmBtn    = document.getElementById('addAlarm');
-const alarmList      = document.getElementById('alarmList');
-const nextTime       = document.getElementById('nextTime');
-const timeRemaining  = document.getElementById('timeRemaining');
-
-function formatTimeInput(input, min, max) {
-  input.addEventListener('input', ()=>{
-    let v = parseInt(input.value)||0; if (v>max) v=max; if (v<min) v=min; input.value=v.toString().padStart(2,'0');
-  });
-  input.addEventListener('wheel', e=>{
-    e.preventDefault(); let v=parseInt(input.value)||0; v = e.deltaY<0 ? v+1 : v-1;
-    if (v>max) v=min; if (v<min) v=max; input.value=v.toString().padStart(2,'0');
-  });
-  input.addEventListener('keydown', e=>{
-    let v=parseInt(input.value)||0;
-    if (e.key==='ArrowUp'){ e.preventDefault(); v=v+1>max?min:v+1; input.value=v.toString().padStart(2,'0'); }
-    if (e.key==='ArrowDown'){ e.preventDefault(); v=v-1<min?max:v-1; input.value=v.toString().padStart(2,'0'); }
-  });
-}
-
-async function fetchAlarms() {
-  try{
-    const resp = await fetch('/alarms/list');
-    const js = await resp.json();
-    return js.alarms || [];
-  }catch(e){ return []; }
-}
-function dayLettersFromRow(){
-  const act = Array.from(document.querySelectorAll('.day.active')).map(d=>d.textContent).join('');
-  return act;
-}
-async function renderAlarms() {
-  const alarms = await fetchAlarms();
-  alarmList.innerHTML = '';
-  if (!alarms.length) { alarmList.innerHTML = '<p class="empty">No alarms have been set yet.</p>'; updateNextAlarm(alarms); return; }
-
-  alarms.sort((a,b)=>a.time.localeCompare(b.time));
-  alarms.forEach(alarm=>{
-    const div = document.createElement('div');
-    div.className = `alarm-item ${alarm.enabled?'':'disabled'}`;
-    div.innerHTML = `
-      <div class="alarm-info">
-        <div class="time">${alarm.time}</div>
-        <div class="desc">Alarm, every ${alarm.days && alarm.days.length ? alarm.days.split('').join(',') : 'day'}</div>
-      </div>
-      <div class="alarm-controls">
-        <label class="switch">
-          <input type="checkbox" ${alarm.enabled?'checked':''} data-id="${alarm.id}">
-          <span class="slider"></span>
-        </label>
-        <button class="delete-btn" data-id="${alarm.id}" title="Delete alarm">
-          <svg width="16" height="16" viewBox="0 0 24 24" fill="none" stroke="currentColor" stroke-width="2">
-            <path d="M3 6h18M19 6v14a2 2 0 0 1-2 2H7a2 2 0 0 1-2-2V6m3 0V4a2 2 0 0 1 2-2h4a2 2 0 0 1 2 2v2"></path>
-          </svg>
-        </button>
-      </div>
-    `;
-    alarmList.appendChild(div);
-  });
-
-  document.querySelectorAll('.alarm-item .switch input').forEach(sw=>{
-    sw.addEventListener('change', async (e)=>{
-      const id = e.target.dataset.id; const en = e.target.checked ? 1 : 0;
-      try{ await fetch(`/alarms/toggle?id=${id}&enabled=${en}`);}catch(_){}
-      e.target.closest('.alarm-item').classList.toggle('disabled', !e.target.checked);
-      updateNextAlarm(await fetchAlarms());
-    });
-  });
-  document.querySelectorAll('.delete-btn').forEach(btn=>{
-    btn.addEventListener('click', async (e)=>{
-      const id = e.currentTarget.dataset.id;
-      try{ await fetch(`/alarms/delete?id=${id}`);}catch(_){}
-      await renderAlarms();
-    });
-  });
-
-  updateNextAlarm(alarms);
-}
-
-function computeNextAlarm(alarms){
-  // preview uses browser time
-  const now = new Date();
-  const currentDay = now.getDay(); // 0..6
-  const dayNames = ['S','M','T','W','T','F','S'];
-  const currentTime = now.getHours()*60 + now.getMinutes();
-  let nextAlarm = null; let minDiff = Infinity;
-
-  alarms.forEach(alarm=>{
-    if (!alarm.enabled) return;
-    const [ah, am] = alarm.time.split(':').map(Number);
-    const alarmTime = ah*60 + am;
-    const days = alarm.days || '';
-    function dayEnabled(d){ if (!days || days.length===0) return true; return days.indexOf(dayNames[d]) !== -1; }
-    if (dayEnabled(currentDay)) {
-      let diff = alarmTime - currentTime;
-      if (diff>0 && diff<minDiff){ minDiff=diff; nextAlarm=alarm; }
-    }
-    for (let i=1;i<=7;i++){
-      const nd = (currentDay + i) % 7;
-      if (dayEnabled(nd)) {
-        let diff = alarmTime + 24*60*i - currentTime;
-        if (diff<minDiff){ minDiff=diff; nextAlarm=alarm; }
-        break;
-      }
-    }
-  });
-  return { nextAlarm, minDiff };
-}
-
-function updateNextAlarm(alarms) {
-  const { nextAlarm, minDiff } = computeNextAlarm(alarms);
-  if (nextAlarm) {
-    nextTime.textContent = nextAlarm.time;
-    const h = Math.floor(minDiff/60), m = minDiff%60;
-    timeRemaining.textContent = h>0 ? `In ${h}h ${m}m` : `In ${m}m`;
-    nextTime.style.color = '#007bff'; nextTime.style.fontWeight='700';
-  } else {
-    nextTime.textContent='--:--'; timeRemaining.textContent='No upcoming alarms';
-    nextTime.style.color='#999'; nextTime.style.fontWeight='400';
-  }
-}
-
-if (hourInput && minuteInput) {
-  formatTimeInput(hourInput,0,23);
-  formatTimeInput(minuteInput,0,59);
-  hourInput.value='00'; minuteInput.value='00';
-
-  document.querySelectorAll('.day').forEach(day=>{
-    day.addEventListener('click', ()=>{
-      day.classList.toggle('active');
-      day.style.transform='scale(0.9)'; setTimeout(()=>{ day.style.transform='scale(1)'; },150);
-    });
-  });
-
-  addAlarmBtn.addEventListener('click', async ()=>{
-    const h = hourInput.value.padStart(2,'0');
-    const m = minuteInput.value.padStart(2,'0');
-    const days = dayLettersFromRow();
-    try{
-      await fetch(`/alarms/add?time=${h}:${m}&days=${encodeURIComponent(days)}&enabled=1`);
-      addAlarmBtn.style.transform='scale(0.95)'; setTimeout(()=>{ addAlarmBtn.style.transform='scale(1)'; },150);
-      await renderAlarms();
-    }catch(_){}
-  });
-
-  setInterval(async ()=>{ updateNextAlarm(await fetchAlarms()); }, 60000);
-  (async ()=>{ await renderAlarms(); })();
-}
-
-// ==== Party Mode + Music Sync (ESP32-side /party/set integration) ====
-document.addEventListener('DOMContentLoaded', ()=>{
-  const partySettings    = document.getElementById('partySettings');
-  if (!partySettings) return;
-
-  // Always show party settings (ignore any old show/hide animation)
-  partySettings.style.display   = 'block';
-  partySettings.style.opacity   = '1';
-  partySettings.style.transform = 'none';
-
-  const partyModeOrig   = document.getElementById('partyMode');
-  const musicModeOrig   = document.getElementById('musicMode');
-  const effectButtons   = Array.from(document.querySelectorAll('#partySettings .effect'));
-  const speedSlider     = document.getElementById('partySpeed');
-  const brightSlider    = document.getElementById('partyBrightness');
-  const colorModeInputs = Array.from(document.querySelectorAll('input[name="partyColorMode"]'));
-  const singleColorBox  = document.getElementById('partySingleColorBox');
-  const singleColorPicker = document.getElementById('partyColorPicker');
-
-  // Clone switches to clear any previous listeners that might hide the settings
-  let partyMode = partyModeOrig;
-  if (partyModeOrig) {
-    const clone = partyModeOrig.cloneNode(true);
-    partyModeOrig.parentNode.replaceChild(clone, partyModeOrig);
-    partyMode = clone;
-  }
-  let musicMode = musicModeOrig;
-  if (musicModeOrig) {
-    const clone = musicModeOrig.cloneNode(true);
-    musicModeOrig.parentNode.replaceChild(clone, musicModeOrig);
-    musicMode = clone;
-  }
-
-  // Local state (kept simple)
-  const partyState = {
-    on:     partyMode ? partyMode.checked : false,
-    music:  musicMode ? musicMode.checked : false,
-    effect: 0,
-    speed:  speedSlider  ? parseInt(speedSlider.value  || '50', 10) : 50,
-    bri:    brightSlider ? parseInt(brightSlider.value || '80', 10) : 80,
-    mode:   'rgb',
-    color:  singleColorPicker ? (singleColorPicker.value || '#ff0000') : '#ff0000'
-  };
-
-  function updateSingleColorVisibility(){
-    if (!singleColorBox) return;
-    singleColorBox.style.display = (partyState.mode === 'single') ? 'block' : 'none';
-  }
-
-  async function sendPartyConfig(){
-    const rgb = typeof hexToRgb === 'function' ? hexToRgb(partyState.color) : {r:255,g:0,b:0};
-    const params = new URLSearchParams({
-      on:     partyState.on    ? '1' : '0',
-      music:  partyState.music ? '1' : '0',
-      effect: String(partyState.effect),
-      speed:  String(partyState.speed),
-      bri:    String(partyState.bri),
-      mode:   partyState.mode,
-      r:      String(rgb.r),
-      g:      String(rgb.g),
-      b:      String(rgb.b)
-    });
-    try {
-      await fetch('/party/set?' + params.toString());
-    } catch(e) {
-      console.warn('Failed to send party config', e);
-    }
-  }
-
-  // Effect buttons
-  effectButtons.forEach((btn, idx)=>{
-    btn.addEventListener('click', ()=>{
-      effectButtons.forEach(b => b.classList.remove('active'));
-      btn.classList.add('active');
-      partyState.effect = idx;
-      sendPartyConfig();
-    });
-  });
-
-  // Speed / brightness
-  if (speedSlider) {
-    speedSlider.addEventListener('input', ()=>{
-      partyState.speed = parseInt(speedSlider.value || '50', 10);
-      sendPartyConfig();
-    });
-  }
-  if (brightSlider) {
-    brightSlider.addEventListener('input', ()=>{
-      partyState.bri = parseInt(brightSlider.value || '80', 10);
-      sendPartyConfig();
-    });
-  }
-
-  // Color mode radios
-  colorModeInputs.forEach(input=>{
-    input.addEventListener('change', ()=>{
-      if (!input.checked) return;
-      partyState.mode = input.value;
-      updateSingleColorVisibility();
-      sendPartyConfig();
-    });
-  });
-
-  // Single-color picker
-  if (singleColorPicker) {
-    singleColorPicker.addEventListener('input', ()=>{
-      partyState.color = singleColorPicker.value || '#ff0000';
-      sendPartyConfig();
-    });
-  }
-
-  // Switches
-  if (partyMode) {
-    partyMode.addEventListener('change', ()=>{
-      partyState.on = partyMode.checked;
-      sendPartyConfig();
-    });
-  }
-  if (musicMode) {
-    musicMode.addEventListener('change', ()=>{
-      partyState.music = musicMode.checked;
-      sendPartyConfig();
-    });
-  }
-
-  // Initialise from /status so the UI matches device state
-  async function initFromStatus(){
-    try {
-      const res = await fetch('/status');
-      const js  = await res.json();
-      if (!js.party) return;
-      const p = js.party;
-
-      partyState.on    = !!p.enabled;
-      partyState.music = !!p.music;
-      partyState.effect= p.effect ?? 0;
-      partyState.speed = p.speed  ?? partyState.speed;
-      partyState.bri   = p.bri    ?? partyState.bri;
-      partyState.mode  = p.modeName || p.mode || partyState.mode;
-      partyState.color = p.color  || partyState.color;
-
-      if (partyMode) partyMode.checked = partyState.on;
-      if (musicMode) musicMode.checked = partyState.music;
-      if (speedSlider)  speedSlider.value  = partyState.speed;
-      if (brightSlider) brightSlider.value = partyState.bri;
-      if (singleColorPicker) singleColorPicker.value = partyState.color;
-
-      effectButtons.forEach((btn, idx)=>{
-        if (idx === partyState.effect) btn.classList.add('active');
-        else                           btn.classList.remove('active');
-      });
-
-      colorModeInputs.forEach(input=>{
-        input.checked = (input.value === partyState.mode);
-      });
-
-      updateSingleColorVisibility();
-    } catch(e) {
-      console.warn('Failed to init party state', e);
-    }
-  }
-
-  updateSingleColorVisibility();
-  initFromStatus();
-});
-
-// ==== Advanced Alarm Settings: ramp + type + timeout + test ====
-document.addEventListener('DOMContentLoaded', ()=>{
-  const rampInput      = document.getElementById('rampSeconds');
-  const timeoutInput   = document.getElementById('alarmTimeoutMinutes');
-  const alarmTypeGroup = document.getElementById('alarmTypeGroup');
-  const ledBtn         = alarmTypeGroup ? alarmTypeGroup.querySelector('[data-type="led"]')    : null;
-  const buzzBtn        = alarmTypeGroup ? alarmTypeGroup.querySelector('[data-type="buzzer"]') : null;
-  const testBtn        = document.getElementById('testRampBtn');
-  const stopBtn        = document.getElementById('stopTestBtn');
-  const progressLine   = document.getElementById('testProgress');
-  const progressFill   = progressLine ? progressLine.querySelector('.progress-fill') : null;
-  const resetAlarmBtn  = document.getElementById('resetAlarmBtn');
-
-  if (!rampInput || !timeoutInput || !alarmTypeGroup || !ledBtn || !buzzBtn || !testBtn || !stopBtn) return;
-
-  let testTimer   = null;
-  let testDurMs   = 0;
-  let testStartMs = 0;
-
-  function setProgressActive(active){
-    if (!progressLine || !progressFill) return;
-    if (active) {
-      progressLine.classList.add('active');
-      progressFill.style.width = '0%';
-    } else {
-      progressLine.classList.remove('active');
-      progressFill.style.width = '0%';
-    }
-  }
-
-  function startProgress(seconds){
-    if (!progressLine || !progressFill) return;
-    clearInterval(testTimer);
-    testDurMs   = seconds * 1000;
-    testStartMs = Date.now();
-    setProgressActive(true);
-
-    testTimer = setInterval(()=>{
-      const elapsed = Date.now() - testStartMs;
-      const frac = Math.min(elapsed / testDurMs, 1);
-      progressFill.style.width = (frac * 100).toFixed(1) + '%';
-      if (frac >= 1) {
-        clearInterval(testTimer);
-        setTimeout(()=>{ stopTest(true); }, 300); // auto-stop after ramp ends
-      }
-    }, 100);
-  }
-
-  async function loadAlarmCfg(){
-    try{
-      const resp = await fetch('/alarmcfg/get', { cache:'no-store' });
-      if (!resp.ok) return;
-      const js = await resp.json();
-      if (typeof js.leadSec === 'number') {
-        rampInput.value = js.leadSec;
-      }
-      if (typeof js.timeoutSec === 'number') {
-        const mins = Math.round(js.timeoutSec / 60);
-        timeoutInput.value = mins;
-      }
-      if (typeof js.useLED === 'boolean') {
-        if (js.useLED) ledBtn.classList.add('active');
-        else           ledBtn.classList.remove('active');
-      }
-      if (typeof js.useBuzzer === 'boolean') {
-        if (js.useBuzzer) buzzBtn.classList.add('active');
-        else              buzzBtn.classList.remove('active');
-      }
-    }catch(e){}
-  }
-
-  async function saveAlarmCfg(){
-    const leadSec = parseInt(rampInput.value || '0', 10) || 0;
-    let timeoutMin = parseInt(timeoutInput.value || '0', 10) || 0;
-    if (timeoutMin < 1) timeoutMin = 1;
-    if (timeoutMin > 120) timeoutMin = 120;
-    const useLED  = ledBtn.classList.contains('active');
-    const useBuzz = buzzBtn.classList.contains('active');
-
-    const params = new URLSearchParams({
-      lead:    String(leadSec),
-      led:     useLED ? '1' : '0',
-      buzz:    useBuzz ? '1' : '0',
-      timeout: String(timeoutMin * 60)
-    });
-    try{
-      await fetch('/alarmcfg/set?' + params.toString());
-    }catch(e){}
-  }
-  const saveAlarmCfgDeb = typeof debounce === 'function'
-    ? debounce(saveAlarmCfg, 300)
-    : saveAlarmCfg;
-
-  rampInput.addEventListener('change', saveAlarmCfgDeb);
-  rampInput.addEventListener('blur', saveAlarmCfgDeb);
-  timeoutInput.addEventListener('change', saveAlarmCfgDeb);
-  timeoutInput.addEventListener('blur', saveAlarmCfgDeb);
-
-  // Alarm type buttons act as independent toggles (LED, Buzzer, or both)
-  ledBtn.addEventListener('click', ()=>{
-    ledBtn.classList.toggle('active');
-    saveAlarmCfgDeb();
-  });
-
-  buzzBtn.addEventListener('click', ()=>{
-    buzzBtn.classList.toggle('active');
-    saveAlarmCfgDeb();
-  });
-
-  async function startTest(){
-    const leadSec = parseInt(rampInput.value || '0', 10) || 0;
-    if (leadSec <= 0) return;
-
-    const params = new URLSearchParams({ duration: String(leadSec) });
-    try{
-      testBtn.disabled = true;
-      stopBtn.disabled = false;
-      await fetch('/alarmtest/start?' + params.toString());
-      startProgress(leadSec);
-    }catch(e){
-      testBtn.disabled = false;
-      stopBtn.disabled = true;
-      setProgressActive(false);
-    }
-  }
-
-  async function stopTest(fromAuto=false){
-    clearInterval(testTimer);
-    try{
-      await fetch('/alarmtest/stop');
-    }catch(e){}
-    if (!fromAuto){
-      setProgressActive(false);
-    }
-    testBtn.disabled = false;
-    stopBtn.disabled = true;
-  }
-
-  testBtn.addEventListener('click', startTest);
-  stopBtn.addEventListener('click', ()=> stopTest(false));
-
-  if (resetAlarmBtn) {
-    resetAlarmBtn.addEventListener('click', async ()=>{
-      try{
-        await fetch('/alarm/reset', { cache:'no-store' });
-      }catch(e){}
-    });
-  }
-
-  loadAlarmCfg();
-});
-
-)rawliteral";
+#pragma once
+// Generated by tools/build_assets.py from web/script.js - do not edit.
+// 27372 bytes minified, 7729 bytes gzip.
+const char SCRIPT_JS_ETAG[] = "\"25bfc94f\"";
+const size_t SCRIPT_JS_GZ_LEN = 7729;
+const uint8_t SCRIPT_JS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x3c, 0x6b, 0x73, 0xdb, 0xb6,
+  0xb2, 0xdf, 0xfd, 0x2b, 0x60, 0x37, 0x0d, 0xc9, 0x46, 0x96, 0x65, 0xe7, 0xd5, 0x4a, 0x96, 0x3d,
+  0x8e, 0x93, 0x9c, 0xf4, 0x4e, 0x9d, 0x78, 0x62, 0xb7, 0x9d, 0x4e, 0x26, 0x53, 0x53, 0x22, 0x24,
+  0x31, 0x91, 0x48, 0x95, 0xa4, 0x64, 0x3b, 0x8a, 0xfe, 0xfb, 0xdd, 0x5d, 0x3c, 0x08, 0x80, 0xd4,
+  0xc3, 0x3d, 0xa7, 0xe7, 0x4c, 0x4c, 0x01, 0x8b, 0xc5, 0x62, 0xb1, 0xd8, 0x17, 0x1e, 0x83, 0x59,
+  0xd2, 0x2f, 0xe2, 0x34, 0x61, 0x11, 0xef, 0xa5, 0xf0, 0xcd, 0xfd, 0x41, 0xd2, 0x60, 0xb7, 0x61,
+  0x5c, 0x04, 0x0b, 0x36, 0xe6, 0x05, 0x2b, 0x3a, 0x2c, 0xe3, 0xc5, 0x2c, 0x4b, 0x98, 0xdf, 0x6c,
+  0x36, 0xc3, 0xa0, 0x7b, 0xb2, 0x60, 0xfd, 0x31, 0x0f, 0xb3, 0xeb, 0x78, 0xc2, 0xd3, 0x59, 0xe1,
+  0x17, 0x41, 0x87, 0x15, 0xdd, 0x9c, 0x17, 0xaa, 0xc0, 0x07, 0x98, 0x41, 0x22, 0xa0, 0x25, 0xaa,
+  0x0e, 0x5b, 0xc2, 0xff, 0x77, 0x06, 0xaa, 0xb3, 0x11, 0xbf, 0xbb, 0x4e, 0x3f, 0x0e, 0x7b, 0x3e,
+  0x7c, 0x40, 0x3f, 0xfd, 0x34, 0xc9, 0x0b, 0x36, 0xef, 0xc2, 0xaf, 0x66, 0xc6, 0xa7, 0xe3, 0x10,
+  0xc8, 0xf0, 0x7e, 0xf0, 0x1a, 0x9e, 0x17, 0xe8, 0xde, 0x17, 0x2c, 0x6b, 0x4f, 0xc3, 0x2c, 0xe7,
+  0xbf, 0x26, 0x85, 0x3f, 0x6f, 0xe6, 0xb3, 0x5e, 0x5e, 0x64, 0x7e, 0xab, 0x71, 0x14, 0x34, 0x0e,
+  0x5f, 0x40, 0x3f, 0xc3, 0x9a, 0xda, 0x23, 0x5d, 0xdb, 0xab, 0xa9, 0x7d, 0x26, 0x6b, 0x1d, 0xda,
+  0xb2, 0x61, 0xef, 0x3a, 0x7d, 0xc7, 0xef, 0xfc, 0xac, 0x31, 0x6c, 0xf4, 0x34, 0x75, 0xa3, 0x6e,
+  0xd2, 0x3d, 0x49, 0x9a, 0x45, 0x7a, 0x55, 0x64, 0x71, 0x32, 0xf4, 0xa1, 0x61, 0x73, 0x1a, 0x46,
+  0x57, 0x45, 0x98, 0x15, 0xd0, 0x91, 0xd7, 0x32, 0x68, 0xbd, 0xf9, 0xe1, 0xd1, 0x62, 0xe4, 0x67,
+  0xc1, 0x12, 0xff, 0x0c, 0xc5, 0x9f, 0x5e, 0xb0, 0xbc, 0x81, 0xd6, 0xbf, 0x4f, 0xa7, 0x3c, 0x3b,
+  0x0f, 0x73, 0xee, 0x07, 0x56, 0xaf, 0x80, 0xea, 0xc8, 0x4f, 0xa0, 0x37, 0x89, 0xc2, 0xe8, 0xa9,
+  0xa6, 0x9f, 0xe5, 0x0e, 0x4e, 0x4d, 0xc4, 0xe7, 0x71, 0x9f, 0xbf, 0x99, 0xa6, 0xfd, 0x11, 0xeb,
+  0xb2, 0x64, 0x36, 0x1e, 0x77, 0x18, 0x63, 0x07, 0x07, 0xec, 0xf7, 0xeb, 0x73, 0xc6, 0xa9, 0x78,
+  0x90, 0xa5, 0x13, 0x76, 0x90, 0x17, 0x61, 0x31, 0xcb, 0xa9, 0xcd, 0x38, 0xcc, 0x8b, 0xab, 0xfb,
+  0xa4, 0x7f, 0x91, 0x33, 0x68, 0xd3, 0xea, 0x94, 0x14, 0xcc, 0xa6, 0x51, 0x58, 0x70, 0x9c, 0xc4,
+  0x57, 0xe9, 0x9d, 0x1f, 0x2c, 0x76, 0xe2, 0x01, 0xf3, 0xad, 0x2e, 0x44, 0x1f, 0x81, 0x24, 0xb1,
+  0xb3, 0x23, 0x18, 0x13, 0x61, 0xdf, 0xfc, 0x96, 0xbd, 0x86, 0xd6, 0x26, 0xfc, 0x4f, 0x87, 0xad,
+  0x56, 0x0b, 0x68, 0x45, 0x82, 0xb0, 0x8e, 0x15, 0xe1, 0x57, 0x9e, 0x13, 0x6d, 0x61, 0x12, 0xb1,
+  0x28, 0xce, 0x61, 0xa2, 0xef, 0x73, 0x36, 0x4e, 0xfb, 0xe1, 0x58, 0xe2, 0x1a, 0xe1, 0x40, 0x88,
+  0x15, 0x51, 0x73, 0xc8, 0x8b, 0x77, 0xe9, 0x2c, 0xcb, 0xfd, 0x00, 0xe6, 0x6f, 0x32, 0xb1, 0x2a,
+  0x2e, 0xe2, 0x64, 0x56, 0x70, 0x51, 0x95, 0xe7, 0x56, 0xd5, 0x15, 0x07, 0x54, 0x11, 0x56, 0x29,
+  0x02, 0x0b, 0x18, 0x12, 0xb0, 0x12, 0xa0, 0x6e, 0x60, 0x22, 0x46, 0xcb, 0xf6, 0xa3, 0xc5, 0x64,
+  0x82, 0xff, 0xe6, 0xf9, 0xf2, 0x46, 0x8f, 0x02, 0x28, 0x14, 0x40, 0x11, 0x70, 0xfe, 0x37, 0xa4,
+  0x89, 0xbf, 0x16, 0x65, 0x38, 0x07, 0xb3, 0x24, 0xe2, 0x83, 0x38, 0xe1, 0x51, 0x03, 0x04, 0xf1,
+  0x96, 0xf3, 0xaf, 0x51, 0x78, 0xdf, 0xf6, 0xf2, 0x51, 0x9a, 0x15, 0x5e, 0x83, 0xdd, 0xc3, 0x72,
+  0x68, 0x7b, 0xc9, 0x6c, 0xc2, 0xb3, 0xb8, 0x0f, 0xbf, 0x27, 0x69, 0x52, 0x8c, 0xca, 0x6a, 0x82,
+  0x55, 0xb5, 0x6c, 0xa9, 0x09, 0xe3, 0x63, 0xe4, 0x36, 0x76, 0x99, 0xf6, 0xa1, 0x36, 0x29, 0x90,
+  0xfe, 0x37, 0x63, 0x8e, 0x9f, 0xaf, 0xee, 0x7f, 0x8d, 0x7c, 0x2f, 0x2b, 0xfa, 0x08, 0xe2, 0x19,
+  0x4d, 0x88, 0x95, 0xeb, 0x9b, 0x20, 0x88, 0xd9, 0x04, 0x64, 0xa7, 0xd8, 0xd0, 0xe4, 0x8a, 0x24,
+  0x04, 0x1b, 0xe1, 0xac, 0x0b, 0xc2, 0x02, 0x49, 0x60, 0xb3, 0xe0, 0x77, 0xc5, 0x39, 0x0c, 0x09,
+  0x1a, 0x00, 0x1a, 0xc9, 0x4e, 0x05, 0x89, 0x9d, 0x05, 0x92, 0x2e, 0x07, 0x52, 0xf2, 0x54, 0x41,
+  0x62, 0x1f, 0x81, 0x24, 0xc7, 0x81, 0xf4, 0xae, 0x60, 0xa6, 0xfb, 0xbc, 0xcd, 0x62, 0x28, 0xc9,
+  0x92, 0x70, 0xec, 0x75, 0x76, 0x96, 0x92, 0xfe, 0x7e, 0x3a, 0x4e, 0xb3, 0xcb, 0xb8, 0xff, 0x95,
+  0x67, 0x8c, 0xfe, 0x5b, 0x33, 0x12, 0x03, 0xb6, 0x64, 0xc0, 0x38, 0x9c, 0x4c, 0xcf, 0xe3, 0x0c,
+  0x94, 0x16, 0xdb, 0x88, 0xa0, 0x84, 0x75, 0xda, 0x23, 0xe2, 0x6b, 0xa0, 0x79, 0x9b, 0xf6, 0x08,
+  0x5b, 0x36, 0xef, 0x65, 0xf1, 0x70, 0x54, 0x24, 0x3c, 0xcf, 0xaf, 0xc6, 0x71, 0xc4, 0xb3, 0x75,
+  0xcd, 0x4b, 0x58, 0x5c, 0xe5, 0xb0, 0x70, 0x3e, 0xfe, 0xe7, 0x15, 0x4b, 0x93, 0xf1, 0xbd, 0x5a,
+  0x1f, 0xd3, 0xdf, 0xde, 0xbc, 0x96, 0x68, 0x36, 0x0d, 0x85, 0x60, 0x11, 0x0d, 0xfd, 0x07, 0xb8,
+  0xde, 0x5d, 0x32, 0x28, 0x31, 0xd1, 0x95, 0xdd, 0xc9, 0xa1, 0x6d, 0x18, 0xd9, 0x2b, 0x93, 0x3c,
+  0x89, 0x23, 0x07, 0x65, 0xf2, 0xaa, 0x48, 0x98, 0xfe, 0x6f, 0x0d, 0x0e, 0x84, 0x25, 0x05, 0x53,
+  0x24, 0x88, 0x00, 0xf5, 0x11, 0xd8, 0x8d, 0xd7, 0x7c, 0x10, 0xce, 0xc6, 0x05, 0x22, 0x59, 0xd7,
+  0xd6, 0x04, 0x54, 0x82, 0xba, 0x6b, 0x95, 0x06, 0x6c, 0xa1, 0x64, 0x06, 0x34, 0x4c, 0x8c, 0xe2,
+  0x87, 0xba, 0xe1, 0x2c, 0xcb, 0xc2, 0xfb, 0x26, 0x6a, 0x42, 0x5f, 0x63, 0xff, 0x67, 0xc6, 0xb3,
+  0xfb, 0x2b, 0x3e, 0xe6, 0xfd, 0x22, 0xcd, 0xce, 0xc6, 0x63, 0x60, 0xfd, 0xac, 0x28, 0x52, 0x40,
+  0x0c, 0x98, 0x5d, 0x9a, 0x4a, 0x6c, 0x4d, 0xd0, 0x01, 0x91, 0xdf, 0x63, 0xdd, 0x13, 0xe6, 0xf7,
+  0x4c, 0x19, 0xfe, 0xfe, 0x1d, 0x6c, 0x55, 0x13, 0x74, 0xc5, 0x04, 0xd4, 0x35, 0xea, 0x8f, 0x5b,
+  0xa5, 0xe5, 0x41, 0x6d, 0x82, 0x7c, 0x03, 0x4a, 0x16, 0xe6, 0xa0, 0xb1, 0x09, 0x2d, 0x92, 0x2f,
+  0x54, 0x78, 0x38, 0x9d, 0x8e, 0xef, 0xb7, 0x63, 0x80, 0x03, 0xaa, 0x59, 0xe0, 0xa2, 0x78, 0xfc,
+  0xd8, 0x61, 0xaa, 0x5b, 0x00, 0xe6, 0x24, 0x03, 0xac, 0x12, 0x39, 0x32, 0x6d, 0x0d, 0x15, 0xfd,
+  0x8c, 0xc3, 0xc0, 0x25, 0x6c, 0xc9, 0xa5, 0x8e, 0xdb, 0xa6, 0x19, 0xa3, 0x1d, 0xa8, 0x10, 0x59,
+  0x85, 0xeb, 0x83, 0x05, 0xca, 0xdf, 0x87, 0xa4, 0xf7, 0x6c, 0xb2, 0xca, 0x9a, 0xef, 0xdf, 0x99,
+  0x27, 0x59, 0xb5, 0xdf, 0xab, 0xc5, 0x92, 0x17, 0xf7, 0x63, 0xde, 0x9c, 0x84, 0xd9, 0x30, 0x4e,
+  0xae, 0xd3, 0x29, 0x76, 0xfd, 0xf3, 0xf4, 0xae, 0x06, 0xd0, 0xd5, 0x33, 0xc0, 0xf3, 0x5e, 0xd8,
+  0xff, 0xca, 0x8a, 0x54, 0x4f, 0x86, 0x33, 0xe1, 0xcd, 0x38, 0xc9, 0x79, 0x56, 0x9c, 0x45, 0x5f,
+  0xc0, 0x0d, 0xd1, 0x6c, 0x02, 0xfe, 0x0f, 0x40, 0x35, 0xf1, 0x24, 0x02, 0x85, 0xee, 0x74, 0x42,
+  0xb3, 0x19, 0xa2, 0x70, 0x33, 0x6d, 0x4d, 0xf3, 0x70, 0xce, 0x25, 0x04, 0xda, 0xd2, 0x22, 0xbb,
+  0x07, 0x36, 0xa3, 0x2f, 0xc4, 0x06, 0xbc, 0xe8, 0x8f, 0x7c, 0xef, 0x40, 0x76, 0x7f, 0x80, 0x90,
+  0x1e, 0x9a, 0x95, 0x7e, 0xd8, 0x1f, 0x71, 0x30, 0x14, 0xe9, 0x7e, 0x0e, 0x42, 0xc9, 0x85, 0xa5,
+  0xc0, 0x29, 0xb6, 0x85, 0x7c, 0xe1, 0xb0, 0xcd, 0x1d, 0x21, 0xa0, 0x8b, 0x76, 0xbd, 0x0e, 0x73,
+  0x3c, 0xb2, 0xd5, 0xad, 0xba, 0xc4, 0x15, 0x43, 0x3a, 0x1b, 0xec, 0xf0, 0x88, 0x4c, 0xf7, 0xd2,
+  0x24, 0x59, 0x98, 0x08, 0x1f, 0x07, 0xdb, 0x0f, 0x71, 0x08, 0x7f, 0x07, 0x8b, 0x65, 0x75, 0xe0,
+  0x26, 0x6f, 0xf4, 0xc8, 0xc5, 0xaa, 0x44, 0xd5, 0x57, 0xcf, 0x03, 0x6a, 0xb4, 0x9e, 0x09, 0x59,
+  0x33, 0xfd, 0x2a, 0x9d, 0x12, 0x97, 0xfd, 0x0b, 0xb6, 0x61, 0xd6, 0x3f, 0x72, 0x42, 0x56, 0xcb,
+  0x96, 0x35, 0x4d, 0xbb, 0xb5, 0xe2, 0xb2, 0x91, 0x3b, 0x0e, 0x7f, 0xaa, 0x33, 0xe8, 0x4c, 0x45,
+  0x18, 0x45, 0x6f, 0xe6, 0xd0, 0xdd, 0x6f, 0x71, 0x0e, 0xbd, 0xf2, 0x0c, 0xcc, 0xd8, 0x18, 0x4c,
+  0x18, 0x74, 0x64, 0x08, 0x91, 0xe4, 0x82, 0x3b, 0xf4, 0x0a, 0xf9, 0xab, 0x91, 0x99, 0x90, 0x5a,
+  0x7b, 0xff, 0x79, 0xf5, 0xf7, 0x87, 0xcb, 0xbf, 0xd1, 0xca, 0x74, 0xd9, 0x61, 0x43, 0xfe, 0x04,
+  0x43, 0xd1, 0x65, 0x47, 0xea, 0xd7, 0xe5, 0xd9, 0xc7, 0xeb, 0xbf, 0xa0, 0xe0, 0xa9, 0x51, 0x70,
+  0x76, 0x01, 0x05, 0xcf, 0x84, 0x06, 0xbf, 0xcd, 0x95, 0xf3, 0x49, 0x3f, 0xa7, 0xe9, 0x78, 0x0c,
+  0x1e, 0x13, 0x94, 0x0d, 0xc2, 0x71, 0xce, 0x3b, 0xa5, 0xd7, 0x49, 0x1c, 0xd2, 0xb0, 0xe5, 0x4a,
+  0x19, 0xa5, 0xb7, 0x92, 0x7b, 0x5f, 0xf2, 0x40, 0xc9, 0x4a, 0x38, 0x0e, 0xb3, 0x49, 0x7e, 0x3e,
+  0x0a, 0x93, 0x21, 0x47, 0xcd, 0xb2, 0x7b, 0x9b, 0x7f, 0x98, 0xf2, 0x04, 0xf4, 0x29, 0xa8, 0x33,
+  0x03, 0x1d, 0xfc, 0xfa, 0x92, 0x37, 0x09, 0xfa, 0x23, 0x9f, 0xb3, 0x5d, 0x50, 0xb6, 0xda, 0x57,
+  0xab, 0xab, 0x2c, 0x9b, 0xea, 0x72, 0x20, 0xd1, 0x24, 0xef, 0x43, 0xef, 0x0b, 0x58, 0x85, 0x26,
+  0xe8, 0xa2, 0x78, 0x98, 0xf8, 0x46, 0x15, 0x68, 0xa5, 0xc5, 0xb2, 0x01, 0x18, 0x81, 0x7b, 0x5a,
+  0x3f, 0xa2, 0x1b, 0x8b, 0xb3, 0x4d, 0x4c, 0xf7, 0xd1, 0x0f, 0x3e, 0x9f, 0x81, 0xb0, 0x4d, 0xc4,
+  0x6f, 0x6f, 0x3c, 0x9b, 0xc4, 0x49, 0xd8, 0x16, 0x0e, 0x38, 0x09, 0x78, 0xc4, 0x8b, 0x30, 0x1e,
+  0xb7, 0xcd, 0x31, 0x2c, 0x03, 0x35, 0xbb, 0xe6, 0xa0, 0x03, 0xf6, 0xc0, 0x4e, 0x44, 0xeb, 0xb5,
+  0x9d, 0x44, 0x60, 0xf1, 0xc0, 0x7d, 0x34, 0x98, 0x40, 0x61, 0x42, 0x9d, 0xfe, 0xc2, 0x78, 0xe3,
+  0x52, 0xcc, 0xa5, 0x0a, 0x06, 0xe4, 0xd4, 0x96, 0x01, 0x40, 0x39, 0xd7, 0x45, 0x36, 0x83, 0xa9,
+  0xbe, 0x1d, 0xc5, 0xe0, 0x64, 0x69, 0x38, 0x6b, 0xf1, 0xcf, 0xb2, 0x31, 0x33, 0xd9, 0xcf, 0x4e,
+  0xd9, 0x8d, 0x0c, 0x4c, 0x4e, 0xf3, 0x18, 0x02, 0xcf, 0xee, 0xa3, 0x85, 0x41, 0xd7, 0x9c, 0x67,
+  0x39, 0xd0, 0xb1, 0xbc, 0x61, 0x6d, 0xe6, 0x49, 0x38, 0x4f, 0x49, 0x6d, 0xc6, 0xf3, 0xa9, 0xa3,
+  0x4b, 0x00, 0xfd, 0x7a, 0xf5, 0x01, 0x4d, 0x9a, 0xb9, 0x9c, 0x63, 0x90, 0x03, 0x5c, 0xc2, 0xa6,
+  0xe8, 0x09, 0x5c, 0x04, 0xf5, 0x25, 0x4f, 0x13, 0x0a, 0x1f, 0x38, 0xc8, 0x2f, 0x73, 0x1b, 0xa3,
+  0x10, 0x3d, 0x6d, 0x3d, 0x0b, 0x58, 0x31, 0xca, 0xd2, 0x5b, 0x66, 0x54, 0x99, 0x8a, 0x51, 0xaa,
+  0x06, 0x9c, 0xaa, 0x4b, 0x70, 0x3c, 0x62, 0xf0, 0x04, 0x32, 0x26, 0x94, 0xb0, 0xd2, 0x3e, 0x59,
+  0x83, 0x3d, 0xc7, 0x08, 0x49, 0xa8, 0x8c, 0x1d, 0x23, 0x16, 0x04, 0xd2, 0xa7, 0x25, 0xeb, 0x2b,
+  0x2b, 0xca, 0x0c, 0x1b, 0xd5, 0xaa, 0xd0, 0x71, 0xe3, 0x2d, 0x2d, 0x89, 0xdb, 0x1c, 0xe2, 0xe8,
+  0x30, 0xba, 0xc7, 0xc1, 0x71, 0x1a, 0xef, 0xa1, 0xd3, 0xec, 0x8a, 0xa3, 0x23, 0x73, 0x0f, 0x3e,
+  0x8d, 0x9c, 0x5c, 0xbd, 0xc0, 0xd4, 0xf4, 0xaa, 0xf5, 0x0b, 0xb8, 0x72, 0x04, 0xc6, 0xb1, 0xfc,
+  0x0e, 0xfe, 0xf9, 0xcf, 0xe4, 0x4f, 0xc9, 0xb6, 0x40, 0xbc, 0x84, 0x16, 0x12, 0x50, 0x91, 0xa3,
+  0x69, 0x2a, 0xa6, 0x94, 0xa3, 0xef, 0xd5, 0x20, 0x8e, 0x3b, 0x46, 0xa1, 0x3a, 0x97, 0x62, 0xbe,
+  0x85, 0x51, 0x9c, 0xf0, 0x62, 0x94, 0x46, 0x6d, 0xef, 0xf2, 0xc3, 0xd5, 0x35, 0x14, 0x8c, 0x60,
+  0x54, 0x20, 0x19, 0xed, 0x05, 0xf3, 0xa4, 0x92, 0xde, 0xbf, 0xbe, 0x9f, 0x72, 0xaf, 0x4d, 0x9e,
+  0x47, 0x0c, 0xfc, 0x87, 0x4e, 0x0f, 0x70, 0x06, 0x61, 0xea, 0x21, 0xec, 0x4f, 0xa3, 0xfb, 0x36,
+  0xfb, 0xbf, 0xab, 0x0f, 0xef, 0x61, 0x8e, 0x30, 0x90, 0x8b, 0x07, 0xf7, 0x48, 0x48, 0x50, 0xda,
+  0x56, 0x20, 0x08, 0x39, 0x46, 0xf3, 0x08, 0x16, 0x66, 0x93, 0x4c, 0xd8, 0xba, 0x5d, 0x0f, 0x13,
+  0xc6, 0x92, 0x80, 0xd6, 0xf8, 0xf3, 0x4a, 0x9a, 0x3c, 0x8c, 0x12, 0x73, 0x19, 0x18, 0xff, 0xc9,
+  0x7b, 0x57, 0x29, 0x84, 0x24, 0x85, 0x7f, 0x73, 0x9b, 0xb7, 0x0f, 0x0e, 0x40, 0xce, 0x53, 0x41,
+  0x68, 0x73, 0x04, 0xdc, 0x59, 0x1e, 0xdc, 0xe6, 0x37, 0x64, 0x4e, 0x14, 0x6a, 0x68, 0x6c, 0x2f,
+  0x3f, 0x95, 0x58, 0x40, 0x20, 0x98, 0x8e, 0x1e, 0xac, 0xf6, 0xec, 0x1e, 0xc7, 0x4d, 0x2e, 0x17,
+  0x4e, 0x47, 0x6f, 0x36, 0x18, 0x40, 0xcc, 0x43, 0xb3, 0x95, 0x26, 0x29, 0x4c, 0x24, 0x3a, 0xe2,
+  0xc2, 0xee, 0x9b, 0xd2, 0x24, 0x01, 0xfa, 0xe3, 0x34, 0xe7, 0x12, 0x60, 0x61, 0x68, 0xf0, 0x4a,
+  0xbf, 0x86, 0xbc, 0xea, 0x21, 0x36, 0x40, 0xfe, 0x85, 0x01, 0x94, 0xd8, 0x26, 0x10, 0x10, 0x84,
+  0x43, 0xc2, 0xc7, 0xe7, 0x88, 0x91, 0x38, 0x5b, 0x00, 0x7d, 0xe9, 0x80, 0xf1, 0x79, 0x13, 0x5c,
+  0xe7, 0x90, 0xd6, 0x8d, 0x27, 0x26, 0xc1, 0x2b, 0x35, 0x08, 0x1a, 0x87, 0x2f, 0x79, 0x87, 0x09,
+  0x96, 0x7d, 0x41, 0x42, 0x68, 0xb6, 0x28, 0x5b, 0xe3, 0xcb, 0xb6, 0xd8, 0x15, 0x33, 0x98, 0x53,
+  0x32, 0x03, 0xfb, 0x01, 0x0d, 0x5f, 0x48, 0x27, 0x9b, 0xa4, 0x26, 0x60, 0x8e, 0x49, 0xe9, 0x38,
+  0x60, 0x52, 0x4f, 0xfe, 0x2f, 0xf4, 0xeb, 0x17, 0xa9, 0x57, 0x97, 0x1d, 0x53, 0x18, 0xc6, 0xf1,
+  0x9c, 0xe3, 0xfa, 0x02, 0xeb, 0x5b, 0x26, 0xd3, 0x54, 0x9e, 0x81, 0xf7, 0xd0, 0xbd, 0xae, 0x24,
+  0xdb, 0x04, 0x2b, 0x20, 0x2c, 0x99, 0x91, 0xb9, 0x93, 0x6b, 0x4f, 0x65, 0xde, 0x34, 0x53, 0x8d,
+  0x55, 0x8a, 0x54, 0xf4, 0x6c, 0xd9, 0x40, 0x08, 0x81, 0xa2, 0xe4, 0xb0, 0x46, 0x29, 0x16, 0x68,
+  0xc6, 0xa1, 0x20, 0x2f, 0xce, 0x92, 0x78, 0x42, 0x22, 0xf8, 0x36, 0x03, 0x87, 0xdb, 0x17, 0x72,
+  0xe0, 0xf4, 0xce, 0x06, 0x09, 0x25, 0xa9, 0xd4, 0xf8, 0x5c, 0x0b, 0x01, 0x23, 0x04, 0xc7, 0x41,
+  0x19, 0x87, 0x5d, 0x23, 0xf6, 0x76, 0x53, 0x44, 0x0b, 0x4a, 0xa5, 0x2d, 0xbb, 0x3a, 0xed, 0x67,
+  0xc0, 0x36, 0xe7, 0xe1, 0x78, 0xc6, 0xcd, 0x68, 0x19, 0x08, 0xa8, 0xc4, 0xcc, 0xa7, 0xec, 0x22,
+  0x2c, 0x46, 0xcd, 0x0c, 0xb8, 0x16, 0xf9, 0xbe, 0xce, 0xe5, 0xb9, 0x70, 0x02, 0x19, 0x04, 0x63,
+  0x87, 0xad, 0x96, 0x17, 0x1c, 0xc0, 0xbf, 0xc1, 0x4f, 0x47, 0xcf, 0x9f, 0x07, 0x60, 0x44, 0xe0,
+  0x8f, 0x10, 0x04, 0xa9, 0xfb, 0x3e, 0x69, 0xd7, 0xa7, 0xc1, 0x40, 0x15, 0x0f, 0x41, 0x59, 0x34,
+  0xb0, 0xdf, 0xcf, 0x41, 0x49, 0xbd, 0x50, 0x00, 0xa5, 0x0a, 0x5b, 0x60, 0x72, 0x10, 0x74, 0x8f,
+  0x09, 0x0f, 0xa2, 0xb9, 0x0c, 0x56, 0xb0, 0xe7, 0xdd, 0xa5, 0xe6, 0x8e, 0x11, 0xb9, 0xbb, 0xdc,
+  0x19, 0xa1, 0xfe, 0xab, 0x1d, 0x9e, 0xd1, 0x48, 0x8f, 0xcc, 0x1a, 0x57, 0xdd, 0x88, 0xde, 0x5d,
+  0x82, 0x9a, 0x9c, 0xae, 0x1f, 0x06, 0x74, 0x29, 0x88, 0x96, 0x31, 0xbc, 0x98, 0x4a, 0x21, 0x9b,
+  0x86, 0xf4, 0xca, 0xf2, 0xc6, 0xe1, 0xcf, 0xad, 0x32, 0xde, 0xa7, 0x71, 0x21, 0x68, 0x15, 0x16,
+  0xba, 0x16, 0xa0, 0x48, 0x95, 0x99, 0xb7, 0x21, 0x9f, 0x4d, 0x65, 0x56, 0x44, 0x98, 0x5e, 0x0a,
+  0x40, 0xd5, 0x65, 0x8d, 0x93, 0xe9, 0x0c, 0x1d, 0x6d, 0x21, 0xf7, 0x65, 0x4b, 0x19, 0xf6, 0xa1,
+  0x47, 0x3e, 0x24, 0x5e, 0x51, 0xaa, 0x05, 0x23, 0x74, 0x57, 0x9e, 0x04, 0x09, 0x56, 0xe6, 0x26,
+  0xb0, 0x13, 0x39, 0x4e, 0x8c, 0x50, 0xc1, 0xe0, 0xe4, 0x6a, 0x77, 0x4a, 0x1e, 0x91, 0x93, 0x4f,
+  0xdc, 0xc3, 0x3e, 0x2a, 0xa2, 0x0a, 0x63, 0xb5, 0xf3, 0x2a, 0x38, 0xde, 0x8a, 0xa0, 0x6e, 0x1a,
+  0xb4, 0x60, 0xf6, 0xb4, 0x5f, 0x50, 0x72, 0x73, 0x2b, 0x71, 0xef, 0xec, 0xd8, 0xfd, 0x3a, 0x23,
+  0xbc, 0x79, 0xb4, 0x00, 0x74, 0xcb, 0x1f, 0x6f, 0x0c, 0xde, 0xc8, 0xf9, 0xa8, 0x70, 0x38, 0x9d,
+  0x86, 0xfd, 0xb8, 0xb8, 0xc7, 0x0c, 0x71, 0xf3, 0x29, 0x7b, 0x02, 0x2e, 0x5d, 0xbf, 0x10, 0x52,
+  0xd7, 0x6a, 0xbe, 0x74, 0x78, 0x81, 0xa9, 0x25, 0xcc, 0x29, 0x51, 0xae, 0xaa, 0xa4, 0xc0, 0x60,
+  0x91, 0x25, 0xfb, 0x8b, 0x1d, 0x53, 0xaa, 0x37, 0xb0, 0xa1, 0x94, 0x36, 0xad, 0x89, 0xdc, 0x75,
+  0x66, 0x45, 0x5f, 0xdb, 0x79, 0x16, 0xd2, 0x13, 0xaf, 0xf5, 0x15, 0xb7, 0x33, 0xff, 0xdc, 0x31,
+  0xff, 0x14, 0x5b, 0x99, 0x41, 0x0c, 0x91, 0x81, 0x63, 0xf7, 0xc8, 0xc1, 0xf6, 0x58, 0x9c, 0xa0,
+  0xb1, 0x00, 0xd9, 0x90, 0x66, 0xf1, 0x8b, 0x74, 0xbd, 0x85, 0x49, 0x4a, 0x66, 0x93, 0x1e, 0xa6,
+  0x2c, 0x81, 0x3b, 0x76, 0x52, 0xff, 0x8b, 0xf6, 0xd0, 0xed, 0xc4, 0x3d, 0x65, 0x5b, 0x93, 0xf4,
+  0x16, 0x65, 0xd1, 0x49, 0xdc, 0x2b, 0xae, 0x57, 0xa2, 0xe4, 0x4a, 0x6e, 0x04, 0xcc, 0x5e, 0xd8,
+  0x1b, 0x8b, 0xf0, 0x0a, 0x3a, 0x92, 0x01, 0x2e, 0x25, 0x10, 0x6a, 0x12, 0x29, 0x71, 0x31, 0xe6,
+  0x82, 0x22, 0x13, 0x10, 0x34, 0xb3, 0xe7, 0xa1, 0x8f, 0xfe, 0x5e, 0x47, 0xc8, 0x14, 0xb6, 0x46,
+  0xec, 0x9e, 0x17, 0x46, 0x16, 0x17, 0x54, 0x3f, 0x34, 0xd6, 0x7b, 0x2b, 0x80, 0x05, 0xbe, 0x9b,
+  0x19, 0x86, 0x53, 0xf4, 0x35, 0xd4, 0x5f, 0xbd, 0xaa, 0xfe, 0x00, 0x93, 0x5e, 0x5d, 0xa0, 0x80,
+  0x0e, 0x90, 0x56, 0x85, 0x19, 0xfe, 0xdb, 0x42, 0x63, 0xd8, 0x4d, 0xb7, 0xd3, 0x11, 0xd4, 0x46,
+  0xca, 0xd6, 0xb0, 0x77, 0x49, 0x6b, 0xd3, 0xd0, 0xdb, 0x8a, 0xfe, 0x2c, 0x3e, 0x38, 0x6a, 0x6a,
+  0xe5, 0xec, 0xae, 0xd9, 0xa0, 0x46, 0x19, 0xa8, 0xf1, 0x08, 0xac, 0x6e, 0x3b, 0x41, 0xd8, 0xa6,
+  0xb5, 0x2d, 0xda, 0xfe, 0xcb, 0xe5, 0x2d, 0x1a, 0x1b, 0x2b, 0x5c, 0x4f, 0xdb, 0xb4, 0x6e, 0x98,
+  0xa3, 0xa9, 0x39, 0x42, 0x6b, 0x79, 0x57, 0x4c, 0x16, 0xf2, 0x6d, 0x4a, 0xa3, 0xb2, 0xd7, 0x8e,
+  0x76, 0xbe, 0xaa, 0x2a, 0xc0, 0x0d, 0x9a, 0x85, 0x57, 0x69, 0x2d, 0x32, 0xf4, 0x0c, 0xc9, 0x07,
+  0xc3, 0x45, 0x79, 0x1b, 0x27, 0x51, 0x7a, 0x5b, 0x87, 0x28, 0x0d, 0x23, 0xad, 0x4a, 0xec, 0x34,
+  0x8d, 0xe9, 0xb1, 0x0b, 0xcd, 0x02, 0xae, 0xee, 0xaf, 0xb8, 0xfb, 0x00, 0x54, 0xfb, 0xa5, 0xc3,
+  0x65, 0x2e, 0xc7, 0x5d, 0xb9, 0x01, 0xa6, 0x14, 0x0c, 0xac, 0x3f, 0x67, 0x29, 0x2a, 0x1f, 0x6f,
+  0x0c, 0x0e, 0xaf, 0x64, 0xda, 0x60, 0x9c, 0xa6, 0x99, 0xef, 0x23, 0xec, 0xbe, 0xb1, 0xfb, 0x46,
+  0x46, 0x5c, 0x99, 0x4a, 0xd1, 0xe0, 0x84, 0xb5, 0x02, 0x7b, 0xfd, 0x3f, 0xe9, 0x0a, 0x5c, 0xf6,
+  0xea, 0x57, 0xa5, 0xb4, 0xc1, 0x56, 0xbb, 0xfc, 0xe1, 0x7f, 0x0d, 0x66, 0xe0, 0x97, 0x39, 0x7a,
+  0xc0, 0x2e, 0xbf, 0xd6, 0xa5, 0x89, 0x48, 0xbd, 0x9a, 0x46, 0x48, 0xea, 0x29, 0x73, 0x38, 0xe5,
+  0x98, 0xd5, 0x30, 0xe4, 0x56, 0xdb, 0x37, 0xb1, 0x03, 0xa0, 0xf7, 0x03, 0x03, 0x4c, 0x63, 0x23,
+  0x6d, 0xdf, 0xd2, 0x84, 0x7f, 0x18, 0x0c, 0x80, 0xc9, 0xd2, 0x64, 0x4c, 0xc4, 0x16, 0x5e, 0x87,
+  0x71, 0x18, 0x1a, 0x03, 0x8d, 0x88, 0x1b, 0x83, 0x30, 0xcb, 0x09, 0x1f, 0x82, 0x63, 0x3a, 0xe7,
+  0x22, 0x8a, 0xb2, 0x72, 0xa6, 0x37, 0x07, 0xd0, 0x1c, 0xb7, 0x9f, 0x4e, 0x89, 0xa4, 0xee, 0xa3,
+  0x05, 0xfd, 0x5d, 0x3e, 0x2e, 0xbe, 0xc1, 0x77, 0xf1, 0x6d, 0x79, 0x13, 0x74, 0xea, 0x73, 0x72,
+  0x6a, 0xd8, 0x6e, 0xae, 0x14, 0x8a, 0x29, 0x2b, 0xb8, 0x53, 0x49, 0x96, 0xae, 0x6e, 0xc0, 0x68,
+  0xd3, 0x8e, 0x36, 0x56, 0x5f, 0x65, 0xe9, 0x6d, 0x0e, 0x7a, 0x1b, 0x98, 0xfd, 0x9c, 0xb8, 0x60,
+  0x86, 0x29, 0xcb, 0x1d, 0xd3, 0xc5, 0x02, 0x1b, 0x5e, 0xdc, 0x5f, 0xa7, 0xc3, 0xe1, 0x78, 0xed,
+  0xee, 0x1d, 0x81, 0x5d, 0xa4, 0x91, 0xb1, 0xfd, 0x44, 0x45, 0x57, 0x38, 0xf0, 0x64, 0x98, 0x6f,
+  0x6c, 0xab, 0x00, 0xd5, 0xf6, 0x80, 0xd9, 0x2f, 0x58, 0x1f, 0x0b, 0x06, 0xcd, 0x8d, 0x51, 0x5f,
+  0x27, 0x14, 0x94, 0x8a, 0xd2, 0x4e, 0x89, 0x83, 0xb0, 0x09, 0xf6, 0x13, 0xf4, 0x71, 0xa4, 0xf1,
+  0x28, 0xc4, 0x52, 0xcd, 0xc8, 0x2d, 0xde, 0xae, 0xd7, 0x83, 0x80, 0xf7, 0x6b, 0x95, 0xcb, 0x0b,
+  0x56, 0xd7, 0x4a, 0x2a, 0xa7, 0xae, 0x77, 0xe8, 0x75, 0x6a, 0x01, 0x8a, 0x2c, 0x4c, 0xf2, 0x41,
+  0x9a, 0x4d, 0xba, 0x1e, 0x7d, 0x8e, 0x41, 0xd0, 0xfe, 0xf2, 0x5b, 0x01, 0x80, 0x2f, 0x1b, 0x87,
+  0x62, 0x1a, 0x28, 0x75, 0x53, 0x4f, 0x95, 0xc6, 0xdf, 0x7a, 0x10, 0xfe, 0xfd, 0xc3, 0xd6, 0xf4,
+  0x2e, 0xd8, 0x76, 0x10, 0x7a, 0xe8, 0x09, 0xc8, 0x3d, 0x11, 0xf6, 0x54, 0x08, 0x88, 0x25, 0x14,
+  0x7d, 0x8a, 0x32, 0xe3, 0x6f, 0x7c, 0xc3, 0xd6, 0x8f, 0x09, 0x57, 0x0a, 0x86, 0x28, 0xbd, 0x0c,
+  0x21, 0x70, 0x5c, 0xbf, 0x25, 0x6c, 0x01, 0x9a, 0x82, 0x45, 0x05, 0x3a, 0xf1, 0xb9, 0x46, 0xb0,
+  0x0c, 0x40, 0x47, 0x30, 0xcf, 0x0d, 0x2f, 0x7f, 0x93, 0x6c, 0x9e, 0xdb, 0xbb, 0xb3, 0x64, 0xe4,
+  0x8d, 0x91, 0x51, 0x5c, 0x60, 0xfc, 0x5e, 0xa3, 0xa4, 0x4c, 0xf5, 0x14, 0xe7, 0x22, 0x58, 0x27,
+  0x47, 0xd9, 0x20, 0xd4, 0xca, 0xe4, 0x77, 0xbb, 0x9e, 0x80, 0xf2, 0x44, 0xbf, 0xaa, 0x11, 0xa6,
+  0xd7, 0x56, 0x36, 0xf2, 0x5e, 0xab, 0x1d, 0x22, 0x9b, 0xd7, 0x62, 0xa7, 0x0a, 0xa9, 0x6a, 0x66,
+  0x7c, 0x92, 0xce, 0xb9, 0x8f, 0x5b, 0xfd, 0xb7, 0xb8, 0xd7, 0x6a, 0xd1, 0x6f, 0xe1, 0x3a, 0x57,
+  0x35, 0xde, 0x16, 0x06, 0xda, 0xf1, 0x57, 0xba, 0xde, 0x0f, 0x61, 0xaf, 0x0f, 0xee, 0x95, 0x57,
+  0xe3, 0x1a, 0x55, 0x1c, 0x23, 0x17, 0x7a, 0x5b, 0x0f, 0x07, 0xda, 0x9d, 0xbd, 0x3a, 0x7f, 0xfd,
+  0xe6, 0xad, 0x57, 0x89, 0x76, 0xe4, 0x7a, 0x5a, 0xc7, 0x2b, 0xc5, 0xde, 0x95, 0xac, 0x82, 0xd9,
+  0xdc, 0x86, 0x4f, 0x25, 0xcf, 0xc5, 0x5a, 0xd1, 0x3a, 0xe7, 0xdc, 0x1c, 0xb4, 0x5c, 0xda, 0xe7,
+  0x0f, 0x08, 0x23, 0x1f, 0xcc, 0xf4, 0x4a, 0x0f, 0xff, 0x22, 0xb2, 0x5c, 0x81, 0xc4, 0x0d, 0x2e,
+  0xb7, 0x98, 0xd4, 0x55, 0xd4, 0xd4, 0xc5, 0xa5, 0xda, 0x7b, 0x4b, 0x67, 0xd9, 0xaf, 0xc8, 0x84,
+  0xcd, 0x87, 0x05, 0x00, 0xb2, 0x5c, 0xd9, 0xc2, 0x36, 0xeb, 0x96, 0x6b, 0xda, 0x09, 0xc8, 0xb2,
+  0x25, 0x4c, 0xc2, 0x19, 0xa6, 0xc9, 0xe4, 0x89, 0x80, 0x75, 0xdb, 0xd9, 0x12, 0xd2, 0x68, 0x8b,
+  0x3f, 0x71, 0xf6, 0x36, 0x52, 0xab, 0x21, 0xcb, 0xc6, 0x09, 0xf0, 0x9c, 0x0c, 0xf3, 0xc6, 0xc6,
+  0x0a, 0xd2, 0xb3, 0x0e, 0x08, 0x7d, 0xe4, 0x93, 0x30, 0x4e, 0x30, 0xcd, 0xbe, 0xae, 0xad, 0x05,
+  0xe9, 0x50, 0x4e, 0x07, 0x73, 0xb6, 0xa2, 0x5c, 0x9d, 0xcf, 0x29, 0x63, 0x58, 0x30, 0x36, 0x21,
+  0x11, 0x45, 0x3c, 0xf7, 0x49, 0x70, 0x1b, 0x38, 0x0d, 0xf0, 0x4f, 0x78, 0x87, 0xe2, 0x4e, 0x45,
+  0x9b, 0x53, 0x25, 0xbc, 0x60, 0x73, 0x33, 0x63, 0x20, 0x9a, 0x89, 0x14, 0xdb, 0xf7, 0xef, 0xad,
+  0x0e, 0x6d, 0x67, 0xcc, 0x4f, 0x08, 0xe9, 0xbc, 0x0b, 0x7f, 0x64, 0xc9, 0x31, 0xf4, 0x45, 0x25,
+  0x71, 0x02, 0x25, 0x65, 0xa3, 0xee, 0x7c, 0xdd, 0x39, 0x34, 0xb1, 0x40, 0x57, 0x50, 0x76, 0x3b,
+  0xe2, 0x7c, 0x0c, 0x94, 0x71, 0x24, 0x8c, 0x37, 0xa7, 0x19, 0xc7, 0x7a, 0xbd, 0x33, 0xdc, 0xa1,
+  0xd3, 0x85, 0xf3, 0xee, 0x6a, 0x52, 0x71, 0x20, 0x60, 0x49, 0xd1, 0xd5, 0xfd, 0xeb, 0xb8, 0x05,
+  0x81, 0xe6, 0xfc, 0xc9, 0x21, 0x44, 0x9a, 0xf3, 0xfd, 0x43, 0xb1, 0x60, 0xca, 0x61, 0x10, 0xd1,
+  0xd6, 0x30, 0x68, 0x60, 0xff, 0x93, 0x61, 0x7c, 0xe5, 0xf7, 0x10, 0x5c, 0x24, 0x6a, 0x20, 0x1b,
+  0x88, 0x16, 0x47, 0x9d, 0x9a, 0xd0, 0x08, 0x4d, 0xce, 0x59, 0x06, 0x0e, 0xe2, 0xef, 0x53, 0x0f,
+  0xac, 0x4c, 0x1d, 0x03, 0xe6, 0x5d, 0x18, 0x11, 0x0e, 0xe2, 0x14, 0xc8, 0x6e, 0xc3, 0xf7, 0x03,
+  0x68, 0x96, 0xd9, 0x5e, 0xbb, 0xab, 0xd7, 0x48, 0xe8, 0xea, 0xce, 0xf6, 0x0f, 0x91, 0x3f, 0xa7,
+  0xd0, 0x61, 0x1b, 0x99, 0xf8, 0xa0, 0xce, 0x4c, 0xb7, 0xe5, 0xf5, 0xd9, 0x5f, 0x7f, 0xbf, 0x3f,
+  0xbb, 0x78, 0x73, 0x05, 0x13, 0xf4, 0xc9, 0xbb, 0x9a, 0x01, 0x73, 0xbc, 0x8b, 0x14, 0xff, 0xbd,
+  0x9e, 0x81, 0xb3, 0xe8, 0xfd, 0xc9, 0x23, 0xfc, 0x1e, 0xcd, 0xe0, 0xdf, 0xb7, 0x59, 0x0c, 0xff,
+  0x5e, 0x85, 0x85, 0xf7, 0x59, 0xa4, 0xb8, 0x69, 0x05, 0x9c, 0x63, 0xea, 0x05, 0x5b, 0x9b, 0x85,
+  0xef, 0xe9, 0x0c, 0x52, 0x17, 0xcc, 0x0c, 0xb9, 0xf5, 0x6d, 0xd6, 0x6a, 0xb0, 0x38, 0x82, 0x3f,
+  0x78, 0x40, 0x13, 0x22, 0x06, 0x72, 0xb9, 0x8b, 0x11, 0x27, 0x6d, 0xeb, 0xe5, 0x0c, 0x8f, 0xe8,
+  0x25, 0x51, 0x98, 0x31, 0x1f, 0x43, 0x87, 0x5c, 0x9c, 0xfb, 0x0b, 0x6a, 0xf3, 0x43, 0xa4, 0x69,
+  0x20, 0x12, 0x60, 0x9b, 0x13, 0x44, 0x22, 0xcb, 0x7f, 0x30, 0xb6, 0xb4, 0x0b, 0x6d, 0x4c, 0x54,
+  0xf2, 0x41, 0x10, 0x6c, 0x98, 0x83, 0x51, 0x5b, 0xcd, 0xb4, 0x53, 0x8c, 0x23, 0xab, 0x1f, 0x15,
+  0x80, 0xa1, 0x0a, 0x42, 0x20, 0x39, 0x40, 0x59, 0xf2, 0x6b, 0x44, 0x65, 0xb8, 0xad, 0x22, 0xf3,
+  0xfe, 0x25, 0x7a, 0x33, 0x7a, 0x56, 0xfb, 0x73, 0xd0, 0x05, 0xb3, 0xb2, 0x50, 0x51, 0x78, 0x7f,
+  0x11, 0xe6, 0x5f, 0xdf, 0x02, 0x9f, 0x3e, 0x62, 0x6c, 0x26, 0xa4, 0x75, 0x02, 0x45, 0xe2, 0xa8,
+  0xe7, 0x9a, 0xd3, 0x4f, 0x4d, 0x68, 0xeb, 0x05, 0x4d, 0x50, 0x44, 0x6f, 0xa0, 0x3b, 0xdf, 0x8f,
+  0x1a, 0x31, 0xf9, 0xb6, 0x14, 0x9d, 0x1a, 0x46, 0x1c, 0xd8, 0x01, 0x51, 0x77, 0x92, 0x83, 0x26,
+  0xeb, 0x63, 0x94, 0xe6, 0x05, 0x81, 0xe8, 0xe0, 0x7b, 0x97, 0x1d, 0x1e, 0x1f, 0xc7, 0x22, 0x94,
+  0x96, 0x04, 0x62, 0x85, 0xb5, 0x31, 0x12, 0xe7, 0xa9, 0x38, 0x25, 0x0a, 0xa4, 0xa9, 0xa3, 0xb2,
+  0x8f, 0x16, 0x74, 0x6c, 0xf3, 0x2d, 0x04, 0xd6, 0x7f, 0xf1, 0x30, 0xf3, 0x83, 0xe5, 0xfe, 0xa3,
+  0x85, 0x94, 0x44, 0x71, 0xd6, 0x13, 0x0f, 0x53, 0xfa, 0xc1, 0x93, 0xc3, 0x8a, 0x5c, 0xba, 0x90,
+  0x22, 0xe2, 0xac, 0x82, 0xdd, 0x58, 0x44, 0x44, 0x3c, 0xef, 0x67, 0x71, 0x8f, 0x93, 0x4c, 0x88,
+  0x2d, 0x77, 0x75, 0xae, 0x04, 0xbf, 0x71, 0xc7, 0x89, 0xeb, 0x3d, 0xd0, 0x9b, 0x0f, 0x10, 0x21,
+  0x36, 0xd8, 0xa3, 0x45, 0x59, 0x57, 0x9e, 0x19, 0x95, 0x9c, 0x55, 0x55, 0xf7, 0xf9, 0x05, 0x71,
+  0xe2, 0x3b, 0x93, 0x7a, 0x60, 0x77, 0x22, 0x7f, 0x0b, 0xc0, 0x2e, 0x4c, 0xc2, 0xdd, 0xcb, 0xb7,
+  0x1a, 0xb7, 0x47, 0x14, 0x80, 0x5e, 0x99, 0xc3, 0x6c, 0xe0, 0xe4, 0x79, 0x9a, 0x73, 0x76, 0x95,
+  0xc7, 0x9e, 0x94, 0x6b, 0xae, 0x39, 0x88, 0xc7, 0x05, 0x28, 0x26, 0xff, 0x6f, 0x9a, 0x22, 0x42,
+  0xfd, 0x98, 0xf9, 0xc8, 0x7c, 0x18, 0xfa, 0x97, 0x34, 0x4e, 0x7c, 0x58, 0x70, 0x81, 0x35, 0x64,
+  0x94, 0xae, 0x0f, 0xfd, 0xfe, 0x2c, 0xcb, 0x38, 0x0c, 0x87, 0xd8, 0xa4, 0xc6, 0x2d, 0x46, 0xf2,
+  0x29, 0x1c, 0x41, 0xe4, 0x3f, 0xf9, 0xac, 0x47, 0x83, 0x86, 0xae, 0x09, 0x21, 0x4c, 0x5c, 0xf8,
+  0x5e, 0x1b, 0x04, 0x63, 0x12, 0x4e, 0xfd, 0xf7, 0x94, 0xa4, 0x0c, 0x36, 0x8f, 0x1e, 0x06, 0xa9,
+  0x77, 0x0b, 0xbe, 0xc6, 0x53, 0x0d, 0x44, 0x3f, 0xe4, 0xda, 0x30, 0x33, 0x28, 0x65, 0xb6, 0x00,
+  0x6c, 0x62, 0x0a, 0xeb, 0x19, 0xc5, 0x36, 0xee, 0xb6, 0x3a, 0xf1, 0x71, 0xf7, 0xe5, 0x13, 0x6c,
+  0xd5, 0x84, 0x95, 0x3e, 0x2c, 0x46, 0x3f, 0xbd, 0xec, 0xc4, 0x4f, 0x9e, 0x68, 0xaa, 0xfb, 0x66,
+  0x5b, 0x40, 0x65, 0xcb, 0x51, 0x83, 0xc9, 0x22, 0x29, 0x40, 0xfa, 0xb7, 0xe8, 0xea, 0x49, 0x0c,
+  0x23, 0xa6, 0x51, 0x2b, 0xff, 0x8b, 0x9d, 0x10, 0x3d, 0x10, 0x25, 0xfb, 0x06, 0x57, 0xfb, 0xa2,
+  0xc9, 0x3d, 0x08, 0x16, 0x9d, 0x3d, 0xd9, 0x25, 0x7a, 0xe2, 0xa4, 0x3f, 0x9e, 0x81, 0x24, 0xf9,
+  0x4a, 0xa4, 0xfb, 0x41, 0xb9, 0x71, 0x5e, 0x96, 0xe1, 0x2c, 0xa8, 0x03, 0xdd, 0x74, 0xea, 0xa5,
+  0x92, 0xbe, 0xce, 0x68, 0xf7, 0xc4, 0xd0, 0x4f, 0xe6, 0xf1, 0x17, 0x5b, 0x39, 0x29, 0x20, 0xa9,
+  0x58, 0x68, 0x3d, 0xc6, 0x09, 0x18, 0xa9, 0x77, 0xd7, 0x17, 0xbf, 0x61, 0x76, 0xc2, 0x53, 0x27,
+  0x02, 0x09, 0x50, 0xf2, 0x0c, 0x37, 0x0a, 0x57, 0xc0, 0x1f, 0x4f, 0x19, 0xad, 0xec, 0xee, 0x1e,
+  0x9f, 0x4c, 0x8b, 0xfb, 0xbd, 0x93, 0xf7, 0xa9, 0xea, 0x78, 0x14, 0xce, 0x39, 0xeb, 0x71, 0x8e,
+  0xfb, 0x58, 0x05, 0xa6, 0x72, 0x9b, 0xc7, 0x07, 0xd3, 0x13, 0x70, 0xca, 0x45, 0xb6, 0x09, 0x95,
+  0x9a, 0x58, 0x3f, 0xd6, 0xfe, 0xa3, 0xec, 0x38, 0x4f, 0x61, 0xed, 0xf9, 0x61, 0xa3, 0x07, 0xf2,
+  0x19, 0x0a, 0x51, 0xa2, 0x43, 0xde, 0xfc, 0x3c, 0x9d, 0xe0, 0xd9, 0x43, 0x3c, 0x3a, 0x89, 0xe7,
+  0x8b, 0xd5, 0x48, 0x72, 0xad, 0x77, 0xe8, 0x67, 0x19, 0xda, 0x6d, 0x90, 0x1e, 0x2c, 0x11, 0x91,
+  0x73, 0xb9, 0x3a, 0x55, 0x3e, 0xda, 0x37, 0xc4, 0x66, 0xe7, 0x94, 0xdd, 0x1c, 0x8b, 0x93, 0x8b,
+  0x6a, 0xc0, 0x58, 0x8b, 0x47, 0x0b, 0x99, 0x50, 0x63, 0x7b, 0x78, 0x56, 0x39, 0xdc, 0x8f, 0xa3,
+  0xee, 0x9e, 0x5a, 0xea, 0x71, 0xb4, 0x94, 0xa5, 0x88, 0x16, 0xcb, 0xb1, 0xcd, 0xa7, 0xd6, 0x67,
+  0x55, 0x9c, 0x26, 0xdd, 0xbd, 0xd6, 0x1e, 0xa3, 0xbc, 0x78, 0x77, 0xef, 0x23, 0xba, 0x8e, 0xe1,
+  0x10, 0x74, 0xe3, 0xde, 0xc9, 0x15, 0x00, 0x4e, 0xf1, 0x77, 0xd9, 0xe6, 0xf8, 0x40, 0xf4, 0x7f,
+  0x72, 0xb3, 0xd3, 0x5e, 0x49, 0xcc, 0x5a, 0x2a, 0xb0, 0xbb, 0x43, 0xdd, 0x1d, 0x76, 0x41, 0xb6,
+  0x90, 0x4c, 0x49, 0x9a, 0x70, 0xd1, 0x2b, 0xfd, 0x2c, 0xfb, 0x2a, 0x33, 0x92, 0xf1, 0x7c, 0xcd,
+  0xa1, 0x4e, 0xa8, 0x45, 0x85, 0x01, 0x7f, 0xac, 0xd3, 0x99, 0x37, 0x44, 0xc2, 0x7e, 0x5c, 0xf0,
+  0x89, 0x56, 0x80, 0x3c, 0xa1, 0x1d, 0x83, 0x53, 0x0f, 0xb4, 0x82, 0xda, 0x3e, 0xf0, 0x50, 0x23,
+  0x62, 0x63, 0x53, 0xb8, 0x6e, 0x76, 0x8e, 0xb1, 0x53, 0x39, 0x42, 0x89, 0x29, 0x19, 0xa4, 0x7b,
+  0x27, 0x56, 0x05, 0xca, 0xc1, 0xde, 0x89, 0xc2, 0x8e, 0xbf, 0x80, 0x55, 0x50, 0x6f, 0x43, 0xa1,
+  0xca, 0x46, 0xa8, 0x3a, 0xd5, 0xad, 0xe1, 0xab, 0xcd, 0x44, 0xaf, 0x68, 0xb2, 0xb2, 0x74, 0x9c,
+  0x43, 0xcf, 0x62, 0x3e, 0x40, 0x64, 0x96, 0x3b, 0xc7, 0xe3, 0xb0, 0xc7, 0xc7, 0x7a, 0x06, 0x6e,
+  0x63, 0x58, 0x60, 0x48, 0x1b, 0xf9, 0x44, 0xb4, 0x49, 0xd3, 0xdd, 0xa3, 0xf4, 0x56, 0x2f, 0xbd,
+  0xdb, 0xab, 0x0e, 0x5f, 0x66, 0xbe, 0x80, 0x0b, 0xde, 0xb2, 0x7e, 0xd6, 0x00, 0x57, 0x3e, 0x0d,
+  0xcb, 0x39, 0xa6, 0x94, 0xf8, 0xde, 0xc9, 0xf1, 0x01, 0x96, 0x22, 0xb9, 0x44, 0x00, 0x7c, 0xd8,
+  0xb2, 0x20, 0x4e, 0x68, 0xad, 0x93, 0x06, 0x29, 0x01, 0xaf, 0xc5, 0x51, 0x2e, 0xaa, 0xa0, 0xce,
+  0xe6, 0x43, 0x76, 0x1b, 0x47, 0xc5, 0x08, 0xc4, 0xe4, 0xc5, 0x1e, 0x1b, 0x71, 0xdc, 0x2e, 0x10,
+  0xdf, 0xf3, 0x98, 0xdf, 0xbe, 0x4a, 0xef, 0x40, 0x5c, 0xc1, 0xbb, 0x38, 0x7a, 0x06, 0xff, 0xdf,
+  0x63, 0x60, 0x45, 0xc6, 0xdd, 0x3d, 0xcc, 0x4e, 0xed, 0xb1, 0x1c, 0xf8, 0xf3, 0x15, 0xc7, 0x4b,
+  0x06, 0xa2, 0xa0, 0x20, 0x53, 0x95, 0xee, 0x4b, 0x9c, 0x47, 0xd8, 0xc7, 0x34, 0x2c, 0x46, 0x0c,
+  0xe8, 0xb9, 0x78, 0xca, 0x5e, 0x8c, 0x0e, 0x7f, 0xbe, 0x38, 0xfc, 0x85, 0xbd, 0x98, 0x1f, 0x3e,
+  0x0b, 0x8f, 0xd8, 0x11, 0x43, 0xdc, 0x87, 0xfb, 0xf0, 0xf5, 0xee, 0xa5, 0xf9, 0x7b, 0xff, 0xe8,
+  0x8f, 0x17, 0x93, 0xa7, 0xac, 0xf5, 0x87, 0x01, 0xc5, 0xa0, 0x74, 0x64, 0xfd, 0x66, 0x47, 0xf3,
+  0x23, 0xe4, 0x0d, 0x76, 0x80, 0xbc, 0x81, 0xc1, 0xe0, 0x1f, 0x29, 0xc7, 0x6a, 0x6e, 0x6f, 0x4c,
+  0xcd, 0x17, 0x42, 0xfc, 0x0c, 0x91, 0xfa, 0x28, 0x1e, 0x47, 0x3e, 0xd4, 0x4a, 0x2f, 0x7e, 0x9d,
+  0x8b, 0x63, 0x88, 0x73, 0x53, 0x4c, 0xb8, 0xf0, 0x80, 0x0d, 0xbf, 0x27, 0xbf, 0x45, 0xe5, 0x93,
+  0xdf, 0xae, 0x4b, 0x85, 0xca, 0x04, 0x39, 0x37, 0x53, 0x50, 0x11, 0x85, 0x2a, 0xe0, 0x73, 0x80,
+  0xad, 0xa0, 0x23, 0x2b, 0xa0, 0x35, 0x61, 0xb6, 0x3a, 0xf2, 0xee, 0x10, 0x4f, 0xcc, 0x7a, 0x29,
+  0x3b, 0xa0, 0xa9, 0x30, 0x9c, 0x01, 0x5f, 0x01, 0x5d, 0x52, 0x66, 0x27, 0xba, 0xa5, 0x17, 0x5a,
+  0x50, 0x9e, 0xf5, 0x14, 0x64, 0xe0, 0xd1, 0x02, 0x26, 0xff, 0xb1, 0x94, 0x3f, 0xcc, 0x7c, 0x27,
+  0x98, 0xed, 0x36, 0x4f, 0x23, 0x95, 0xf8, 0xf1, 0x70, 0x4f, 0x5e, 0x58, 0x23, 0x86, 0x31, 0x96,
+  0x4e, 0x9c, 0xc0, 0xea, 0x97, 0x0b, 0xb8, 0xc1, 0x76, 0x5d, 0xea, 0xec, 0x4c, 0x7a, 0x69, 0x7a,
+  0xaa, 0xfa, 0x5f, 0x84, 0x06, 0x1b, 0x78, 0xaf, 0x54, 0x9c, 0xc1, 0x6b, 0xf8, 0x85, 0x1c, 0xec,
+  0x6d, 0xb3, 0x1b, 0x61, 0x32, 0x1b, 0x9c, 0xd2, 0xa8, 0x01, 0x2a, 0x8f, 0x2d, 0x89, 0xa9, 0x52,
+  0x68, 0xaf, 0x2d, 0xde, 0x5b, 0x81, 0xb9, 0xb2, 0x0f, 0xe4, 0x48, 0x8b, 0x13, 0xfc, 0x61, 0xf7,
+  0x44, 0x3a, 0x8e, 0x21, 0x4c, 0x53, 0x00, 0xae, 0x59, 0x1c, 0x05, 0xe6, 0x55, 0x20, 0x68, 0x03,
+  0x3d, 0xd0, 0xde, 0xec, 0xa1, 0x07, 0x33, 0x25, 0x94, 0x0d, 0xda, 0xff, 0x95, 0xbe, 0x14, 0x1e,
+  0x32, 0x59, 0x41, 0x0e, 0x59, 0x26, 0x69, 0x9c, 0x4d, 0xf7, 0x72, 0xdd, 0xd4, 0x23, 0xc7, 0xca,
+  0x89, 0x27, 0x1b, 0x04, 0x0a, 0x10, 0xfd, 0xcf, 0xc7, 0x60, 0x0a, 0x1e, 0x2d, 0xd2, 0x8a, 0x00,
+  0xa8, 0xf8, 0xc4, 0x74, 0x28, 0xb6, 0x9b, 0x9d, 0x52, 0xe9, 0xfc, 0x0f, 0xe6, 0x47, 0x2e, 0x86,
+  0x7a, 0x46, 0xc0, 0x9a, 0x58, 0x33, 0x66, 0x41, 0x87, 0x1e, 0xf5, 0x83, 0xc6, 0x57, 0x27, 0x98,
+  0xee, 0xe5, 0x36, 0xa3, 0x56, 0x7b, 0x5a, 0xc2, 0xcb, 0x52, 0x91, 0x9a, 0xdc, 0x94, 0xff, 0x89,
+  0x76, 0xcf, 0xd8, 0xbe, 0xb5, 0xb9, 0xa7, 0x43, 0x04, 0x03, 0x10, 0x04, 0x02, 0x10, 0xe0, 0xce,
+  0x5d, 0xe9, 0xba, 0x15, 0xa6, 0x5b, 0x5a, 0x8f, 0x19, 0xb0, 0xa9, 0x34, 0x54, 0x75, 0x27, 0x57,
+  0x49, 0x66, 0x61, 0x5e, 0x81, 0xab, 0x04, 0x35, 0x6d, 0x07, 0xb0, 0xbc, 0x12, 0x57, 0x17, 0xff,
+  0xe8, 0xbc, 0x5e, 0xae, 0x36, 0xf2, 0xfa, 0x3c, 0x1e, 0xfb, 0xc0, 0xf3, 0x17, 0x2d, 0x73, 0x03,
+  0x2f, 0xb2, 0xf7, 0xf9, 0xb0, 0xc1, 0xc1, 0xe1, 0xb3, 0x67, 0x2d, 0xf0, 0x9e, 0x47, 0xd5, 0xaa,
+  0x1f, 0xb1, 0x0a, 0x30, 0xe0, 0x05, 0x3d, 0xa8, 0xa5, 0xa2, 0x17, 0xa8, 0xd0, 0xcc, 0x34, 0x99,
+  0x7b, 0x29, 0xec, 0x04, 0x53, 0x39, 0x37, 0xbf, 0x26, 0x60, 0x54, 0xa3, 0x65, 0x04, 0xff, 0x8e,
+  0x96, 0x23, 0x3c, 0xe5, 0xeb, 0x8f, 0x8c, 0x1a, 0x28, 0x83, 0x7f, 0x27, 0xcb, 0x09, 0xd6, 0x88,
+  0x22, 0xfc, 0x61, 0xf2, 0x4d, 0x24, 0x6d, 0xfb, 0x72, 0x3f, 0xdf, 0xfb, 0xa1, 0xd5, 0x7a, 0xd9,
+  0x1b, 0x0c, 0xc0, 0x45, 0x75, 0x20, 0x06, 0xd0, 0xf5, 0x9f, 0xc2, 0x1a, 0x7a, 0x2f, 0x5b, 0x2d,
+  0xcf, 0xd8, 0x1e, 0xaa, 0x9b, 0x83, 0xae, 0xb7, 0xbf, 0xdf, 0xde, 0xdf, 0x07, 0x3c, 0x2b, 0x47,
+  0xd1, 0xc5, 0xc3, 0x0e, 0xb3, 0x69, 0x3f, 0x9d, 0x90, 0xd3, 0x27, 0x8e, 0x05, 0xd6, 0x53, 0xd6,
+  0xf5, 0x7e, 0xf8, 0xe5, 0x97, 0x5f, 0xd6, 0x13, 0xf5, 0x4c, 0x10, 0xa5, 0x0e, 0xcb, 0xe8, 0x9c,
+  0x2d, 0xca, 0x56, 0x99, 0x88, 0x45, 0x01, 0x73, 0xf3, 0x84, 0x1a, 0xb6, 0xd1, 0x6a, 0x1c, 0x3d,
+  0x15, 0xd1, 0x93, 0x05, 0x60, 0xb4, 0x07, 0x90, 0xe7, 0xbf, 0x00, 0x88, 0x6e, 0xa3, 0x36, 0x0b,
+  0xb0, 0x77, 0xb3, 0x23, 0xb3, 0xfc, 0x01, 0x29, 0x03, 0xf8, 0x85, 0x3a, 0x00, 0xfe, 0x6c, 0xdc,
+  0xb7, 0x41, 0x98, 0xaa, 0x35, 0x52, 0x09, 0x85, 0x0e, 0xd5, 0x57, 0xb6, 0xe2, 0x72, 0x0c, 0x20,
+  0xfc, 0x56, 0xf3, 0x97, 0xa0, 0x7a, 0x89, 0x63, 0xc1, 0xd6, 0x34, 0x39, 0x94, 0x1b, 0x83, 0xcf,
+  0x5b, 0x86, 0xb6, 0x30, 0xf2, 0xd4, 0x0f, 0xda, 0x0b, 0xc7, 0x45, 0xe0, 0x70, 0xb0, 0x9a, 0x4e,
+  0x94, 0x8b, 0x4d, 0xac, 0x08, 0x9b, 0xad, 0xab, 0x80, 0xa5, 0xcd, 0x29, 0x13, 0xc9, 0x30, 0xf9,
+  0xfa, 0x87, 0x3c, 0x48, 0x01, 0x6b, 0x43, 0xd9, 0x01, 0xa7, 0x4a, 0x9c, 0x92, 0xf7, 0x3a, 0xd5,
+  0x6b, 0x46, 0x5a, 0xb5, 0xc2, 0x20, 0x4f, 0x51, 0xa0, 0xbb, 0xb8, 0xb6, 0xf0, 0x06, 0xec, 0xf2,
+  0x31, 0x06, 0xb9, 0x64, 0x53, 0xec, 0xac, 0xd1, 0x52, 0x99, 0x19, 0xe5, 0x6c, 0x1c, 0xde, 0x98,
+  0xca, 0x4f, 0xdc, 0xf7, 0x74, 0x69, 0x13, 0xd1, 0xa7, 0xc9, 0xd5, 0xd5, 0x13, 0xf8, 0xbc, 0x76,
+  0x06, 0xb7, 0x68, 0x6b, 0xcd, 0xe4, 0x0a, 0x6b, 0x60, 0x1e, 0xcf, 0x5e, 0x79, 0xa8, 0xa3, 0x46,
+  0x8b, 0xaf, 0xb0, 0x00, 0xc7, 0xe6, 0xf9, 0x8e, 0xa0, 0xd2, 0x1d, 0xe9, 0x91, 0x3a, 0xcb, 0xd3,
+  0x60, 0x4a, 0xaf, 0x6e, 0x3e, 0xe7, 0xa2, 0xcf, 0x15, 0x0b, 0x46, 0x38, 0x7d, 0x50, 0x42, 0xcd,
+  0x37, 0x24, 0x91, 0xd5, 0x8e, 0x1c, 0xc0, 0x84, 0xc9, 0x5b, 0xd3, 0xdf, 0xeb, 0x0f, 0x17, 0x52,
+  0x83, 0xfd, 0x96, 0x86, 0x11, 0x8f, 0xdc, 0xc3, 0x86, 0xd6, 0x41, 0x83, 0xf5, 0xfb, 0x18, 0xb5,
+  0x67, 0x0d, 0x76, 0x9d, 0xd3, 0x05, 0xfa, 0x9a, 0xc8, 0xea, 0x0d, 0x72, 0xea, 0x45, 0x9f, 0x0f,
+  0x58, 0xb3, 0x5d, 0x2f, 0x00, 0x0f, 0x57, 0x00, 0x69, 0x51, 0x41, 0x20, 0xb1, 0xe5, 0x6e, 0x0e,
+  0x0a, 0x0f, 0x54, 0x7c, 0xc8, 0xe2, 0xe1, 0x16, 0x63, 0xb2, 0xcf, 0x5e, 0x4c, 0x66, 0x79, 0xdc,
+  0xdf, 0xae, 0xb5, 0x06, 0x35, 0x6e, 0x5e, 0x0f, 0x06, 0xa0, 0x2e, 0xb7, 0xda, 0xd1, 0x2a, 0x41,
+  0xdd, 0xe6, 0x97, 0x61, 0x16, 0x4e, 0x72, 0x08, 0xdf, 0x36, 0x37, 0x17, 0xa0, 0xc6, 0xd5, 0xdc,
+  0x29, 0xe7, 0x91, 0x71, 0x5b, 0x78, 0xe3, 0x7c, 0x22, 0xbc, 0x7b, 0x71, 0xb9, 0x6c, 0xbf, 0xa9,
+  0x79, 0xdd, 0xed, 0x60, 0x32, 0x82, 0xc8, 0x15, 0xd2, 0x81, 0xdb, 0xdf, 0xc6, 0xa5, 0xc0, 0xec,
+  0x53, 0x12, 0x82, 0xc2, 0xda, 0x2b, 0x77, 0x3e, 0x11, 0xd1, 0xde, 0x67, 0xaf, 0xbc, 0xda, 0x9f,
+  0x83, 0x0c, 0x60, 0x5a, 0x09, 0xea, 0x90, 0x43, 0x9b, 0x47, 0x68, 0xc1, 0x7b, 0x75, 0x78, 0xfe,
+  0xdd, 0x59, 0x06, 0xba, 0xf9, 0xa6, 0xe4, 0x47, 0x6c, 0xc0, 0x95, 0x62, 0x67, 0x6c, 0x62, 0xab,
+  0x22, 0xe3, 0xaa, 0xf2, 0x18, 0xc4, 0xd5, 0x6d, 0xd1, 0xa4, 0xd2, 0xf7, 0xf0, 0xcb, 0xc7, 0x63,
+  0xfb, 0x81, 0x94, 0x7a, 0x5d, 0x2d, 0x6e, 0xf0, 0x62, 0xbd, 0x7a, 0x2f, 0x43, 0x04, 0xc2, 0xd4,
+  0xac, 0x61, 0xe3, 0x32, 0x1b, 0xe3, 0x41, 0x67, 0x04, 0x51, 0xd7, 0x8f, 0xb5, 0xd0, 0xa2, 0xad,
+  0x32, 0x65, 0x5d, 0x90, 0x6c, 0x15, 0x55, 0x49, 0xb6, 0xaa, 0xab, 0x24, 0xdb, 0xd5, 0x1b, 0x48,
+  0xb6, 0xbb, 0x32, 0x1a, 0x9b, 0x24, 0x9b, 0x7a, 0x4a, 0xdc, 0x6c, 0x02, 0x9a, 0xd2, 0xa4, 0x4d,
+  0xd2, 0x5d, 0x0e, 0xf2, 0xb4, 0xfc, 0xd6, 0xc1, 0x76, 0x5b, 0x5c, 0x6a, 0x68, 0x08, 0xc4, 0xd0,
+  0xa2, 0xec, 0xe0, 0xb4, 0xfc, 0xae, 0x82, 0x8b, 0x95, 0x85, 0x7b, 0x51, 0xc8, 0x45, 0x58, 0x5e,
+  0x6d, 0xbc, 0x04, 0xb8, 0x43, 0x4b, 0x0b, 0xb0, 0x58, 0x4b, 0xec, 0xb4, 0xdc, 0x77, 0x35, 0xca,
+  0xa5, 0x85, 0xa4, 0x4b, 0xcd, 0xcf, 0x5b, 0x78, 0x56, 0xac, 0x85, 0xa1, 0xe2, 0x73, 0xc0, 0x08,
+  0x2b, 0x8c, 0x68, 0xb7, 0x56, 0xda, 0xa9, 0x7b, 0xde, 0xdb, 0x42, 0x83, 0x58, 0x7e, 0x2e, 0xb1,
+  0xfc, 0x0c, 0x58, 0x26, 0x40, 0x38, 0xa2, 0xf1, 0xb2, 0x61, 0xcf, 0x6b, 0x88, 0xa3, 0xf5, 0x48,
+  0x5a, 0x45, 0xa6, 0x21, 0x8c, 0xad, 0x14, 0x1a, 0x68, 0x7f, 0x18, 0x0c, 0xd0, 0x66, 0x79, 0x88,
+  0x57, 0xff, 0xc0, 0xab, 0x1f, 0x4e, 0x14, 0x65, 0x2c, 0xa2, 0x3f, 0xe2, 0x3c, 0xee, 0xc5, 0x63,
+  0xd0, 0xcf, 0xfa, 0xa2, 0x83, 0xbd, 0x24, 0x4b, 0x23, 0x60, 0x97, 0x3b, 0x56, 0xa0, 0x2b, 0x97,
+  0x07, 0xcd, 0x6a, 0x73, 0x42, 0xd3, 0x4e, 0x37, 0x7a, 0xa8, 0x11, 0x50, 0x74, 0xaa, 0x8c, 0x04,
+  0xd2, 0x26, 0x15, 0xbc, 0x92, 0x07, 0xba, 0xa0, 0xfa, 0xf7, 0xc5, 0x87, 0xd7, 0x72, 0x43, 0x92,
+  0xd8, 0x00, 0xdc, 0x08, 0x93, 0x28, 0x9d, 0xe0, 0x97, 0xc4, 0x82, 0x3b, 0x72, 0xd5, 0x3b, 0x1a,
+  0x97, 0x62, 0x35, 0x27, 0x83, 0x98, 0xee, 0x39, 0xea, 0xe3, 0xbd, 0x78, 0x63, 0x46, 0x1c, 0xd5,
+  0x56, 0xb7, 0x56, 0x04, 0x49, 0xaa, 0x31, 0x66, 0x05, 0xf4, 0x7d, 0x16, 0x83, 0x78, 0x62, 0x3f,
+  0xb2, 0x70, 0x91, 0xb5, 0x8f, 0x9e, 0x3f, 0x6f, 0x0c, 0xdb, 0xad, 0x46, 0xaf, 0xdd, 0x5a, 0x2a,
+  0x55, 0x33, 0x18, 0x87, 0x74, 0x8c, 0xcf, 0x6c, 0x03, 0xa4, 0xc8, 0x64, 0x50, 0xc0, 0xbe, 0xdb,
+  0xac, 0x40, 0xc9, 0x84, 0xca, 0x23, 0xaa, 0xd4, 0x66, 0x09, 0x19, 0xa4, 0xc2, 0xb1, 0x49, 0x78,
+  0xe7, 0xb7, 0x1a, 0x26, 0x17, 0x9a, 0x31, 0xb8, 0x06, 0x77, 0x1f, 0x06, 0x2e, 0x4f, 0x83, 0xda,
+  0xfb, 0x22, 0xd4, 0xb0, 0x21, 0xe8, 0x6a, 0x18, 0x8b, 0xab, 0x29, 0x44, 0xdf, 0x2a, 0x22, 0xb1,
+  0xb6, 0x4a, 0x40, 0x44, 0x85, 0x04, 0x36, 0x98, 0x3c, 0xd0, 0x2d, 0x4f, 0x73, 0xd3, 0x51, 0xe8,
+  0xf5, 0xb7, 0x50, 0x08, 0x4d, 0x7b, 0xb1, 0x23, 0x1d, 0xcd, 0x36, 0xb3, 0x58, 0x52, 0x2e, 0x55,
+  0xe6, 0x32, 0xa4, 0x5c, 0x96, 0x35, 0xf4, 0xea, 0xb5, 0x59, 0x25, 0x5c, 0x2f, 0xb8, 0xfa, 0x11,
+  0xe8, 0xa5, 0x63, 0xbc, 0x01, 0x54, 0x1d, 0x53, 0x00, 0xf1, 0x23, 0xf8, 0x77, 0x52, 0xc9, 0x09,
+  0x3d, 0x2a, 0xba, 0xb6, 0x2f, 0x42, 0xe3, 0x51, 0xa7, 0x44, 0x98, 0xe4, 0xb7, 0x14, 0xa2, 0x3a,
+  0xf7, 0x9e, 0x27, 0x61, 0xf6, 0xf5, 0x8c, 0x62, 0x9e, 0x37, 0xd4, 0x5a, 0xaf, 0xa0, 0xd2, 0x17,
+  0x28, 0x99, 0x57, 0x96, 0xd5, 0x45, 0x62, 0xa2, 0xb6, 0x3e, 0x77, 0xb3, 0x32, 0xd0, 0x6a, 0x18,
+  0x7a, 0x06, 0x2f, 0x03, 0xc8, 0x0c, 0x8d, 0x9a, 0x75, 0xd4, 0x2f, 0x28, 0xf0, 0x15, 0x06, 0xeb,
+  0x53, 0x46, 0x7a, 0x24, 0xbd, 0x19, 0x28, 0x72, 0x31, 0x88, 0x57, 0x94, 0xb1, 0xcd, 0x7d, 0xdc,
+  0x3e, 0x2f, 0xcf, 0x49, 0x83, 0x19, 0xcf, 0xe9, 0xb6, 0x10, 0x50, 0x81, 0x3b, 0x89, 0x1c, 0x0f,
+  0xfa, 0x82, 0x53, 0x0d, 0xe5, 0x6a, 0xcb, 0xf2, 0xbb, 0x76, 0x22, 0x0d, 0xaf, 0x09, 0xb4, 0x92,
+  0xaf, 0x58, 0x0b, 0x3e, 0xba, 0xfc, 0x5c, 0x83, 0x82, 0x28, 0xa6, 0xee, 0xe8, 0x82, 0x5c, 0x39,
+  0x2d, 0xd8, 0xb5, 0xb9, 0x53, 0xe5, 0xd4, 0x98, 0xfc, 0x75, 0xb7, 0xd4, 0x88, 0x6a, 0xbd, 0x31,
+  0xce, 0x71, 0xcb, 0xfe, 0xce, 0xf0, 0x9a, 0x7b, 0x5b, 0xbe, 0x97, 0xd1, 0x73, 0xde, 0xbe, 0x90,
+  0x3e, 0x9b, 0x27, 0x6a, 0x6c, 0xee, 0x43, 0xb5, 0xcc, 0xed, 0x60, 0x5f, 0x02, 0xc2, 0xce, 0xa2,
+  0x88, 0x91, 0x5b, 0x74, 0x9b, 0x09, 0xf1, 0x9e, 0x78, 0x94, 0x42, 0xde, 0x67, 0xa9, 0x91, 0xc2,
+  0xaa, 0xf0, 0x59, 0x33, 0x2a, 0x15, 0x63, 0x38, 0x41, 0x02, 0x1a, 0xec, 0x2b, 0xbf, 0x6f, 0x30,
+  0x71, 0xc8, 0x65, 0x51, 0xaf, 0x41, 0xce, 0x2e, 0x6a, 0x55, 0x07, 0xb5, 0xa6, 0x86, 0xa6, 0x26,
+  0xa8, 0xd1, 0x01, 0x4c, 0x2d, 0xe8, 0x7a, 0xfd, 0x83, 0x76, 0x77, 0xc1, 0x3e, 0x01, 0x1d, 0x9f,
+  0xdb, 0x02, 0x1f, 0x5e, 0xbb, 0x63, 0x8e, 0x1c, 0x8a, 0x90, 0xe8, 0x8d, 0xe1, 0x0b, 0x3b, 0x6b,
+  0xaa, 0xf4, 0xa5, 0x41, 0xb2, 0x64, 0x59, 0xee, 0x5e, 0xc7, 0xd3, 0x53, 0x20, 0xeb, 0x3f, 0x55,
+  0x48, 0xfa, 0x6c, 0x04, 0x17, 0x21, 0xe5, 0x0f, 0x65, 0x9b, 0x53, 0xf9, 0xd1, 0x94, 0x15, 0x6d,
+  0xda, 0xac, 0x54, 0xd7, 0x8c, 0x8d, 0x69, 0xd8, 0xad, 0x5d, 0x58, 0xe0, 0xcc, 0x54, 0xa6, 0xab,
+  0x02, 0xa5, 0xe6, 0x5c, 0x8f, 0xa5, 0x22, 0xb0, 0xa2, 0xf3, 0x52, 0x64, 0xa7, 0xae, 0xc8, 0x8a,
+  0xad, 0xaf, 0xd5, 0x42, 0x4b, 0xf5, 0xe4, 0xd5, 0xe2, 0x87, 0x23, 0x79, 0xd3, 0x26, 0x95, 0x2a,
+  0x16, 0x88, 0xfd, 0xb2, 0xd5, 0xb8, 0xe4, 0x0e, 0x8b, 0x3a, 0x5f, 0x55, 0xc8, 0x4b, 0xcb, 0x19,
+  0x6d, 0xa6, 0xa8, 0x52, 0x08, 0x83, 0x09, 0xb3, 0x71, 0xfa, 0x0c, 0xac, 0x9a, 0x28, 0x0a, 0xef,
+  0x14, 0x94, 0x5a, 0x23, 0x20, 0x05, 0x54, 0x05, 0x7f, 0xcd, 0x4b, 0x89, 0xf6, 0x75, 0x44, 0xf9,
+  0xe4, 0x89, 0x25, 0xc6, 0xd4, 0xa4, 0x51, 0x7b, 0x38, 0x8e, 0xf4, 0x5d, 0x40, 0x4f, 0x7b, 0xac,
+  0x39, 0x0b, 0x66, 0x1f, 0xb6, 0x33, 0xa6, 0x46, 0xb0, 0xfc, 0x13, 0x75, 0xf0, 0x79, 0xc5, 0xf9,
+  0x3b, 0xea, 0x42, 0x9c, 0xd7, 0x54, 0x79, 0x6b, 0x77, 0x26, 0xcd, 0x25, 0x4c, 0x5c, 0xde, 0x00,
+  0x43, 0xd8, 0xb5, 0x3e, 0x76, 0x21, 0x57, 0x44, 0x55, 0x86, 0x99, 0xa0, 0xdf, 0x2a, 0x29, 0x22,
+  0x67, 0xb2, 0x6b, 0xcc, 0xa5, 0xb0, 0x14, 0xfa, 0xa1, 0x20, 0xa5, 0x3e, 0x0f, 0x0e, 0x00, 0x24,
+  0xf1, 0xc0, 0x97, 0x41, 0xf7, 0x94, 0x85, 0x2c, 0xca, 0xc2, 0xa1, 0x5a, 0x12, 0x62, 0xf4, 0x24,
+  0x80, 0xb8, 0xd3, 0xf2, 0x0f, 0xea, 0xe9, 0x7f, 0xc4, 0x9c, 0x01, 0xea, 0xca, 0x4c, 0x6a, 0x9f,
+  0x66, 0x6e, 0x0b, 0xbb, 0xe4, 0x68, 0x05, 0xfe, 0xb3, 0x9a, 0x1d, 0x95, 0x77, 0x9a, 0xb3, 0x53,
+  0xf0, 0x6b, 0xa7, 0xe8, 0x36, 0xe3, 0xc5, 0x34, 0xd6, 0x36, 0x8f, 0xb5, 0x59, 0x37, 0x35, 0x4d,
+  0xbb, 0xba, 0xb0, 0x34, 0xe7, 0xea, 0x7c, 0xa5, 0xbc, 0xcf, 0x6e, 0xaa, 0x7a, 0x3e, 0xaf, 0x6e,
+  0xb4, 0x29, 0x03, 0x2c, 0x4d, 0x18, 0xaa, 0x5f, 0x27, 0xfb, 0x61, 0xac, 0x60, 0xeb, 0x46, 0x67,
+  0xbd, 0xe5, 0xed, 0x54, 0x85, 0x0b, 0x63, 0x9d, 0x65, 0xbd, 0xe2, 0xae, 0xd3, 0x7b, 0xc2, 0x68,
+  0xac, 0x4f, 0xc2, 0x55, 0xaf, 0x32, 0xf4, 0xb6, 0x4c, 0xbe, 0x55, 0x1c, 0x67, 0x93, 0xcf, 0x46,
+  0xec, 0x43, 0x2a, 0xcd, 0x08, 0x85, 0x1e, 0xb0, 0xa4, 0xa8, 0x99, 0xc9, 0xaa, 0x6a, 0x48, 0x65,
+  0x46, 0x54, 0x1b, 0x68, 0x32, 0x23, 0xa9, 0xf2, 0x3e, 0xee, 0xc3, 0xa9, 0x12, 0xd7, 0xd3, 0xb7,
+  0x0d, 0xd0, 0xd6, 0x10, 0xe5, 0x24, 0x46, 0x6a, 0x96, 0xe4, 0x0a, 0x1d, 0x54, 0x73, 0x25, 0x67,
+  0x57, 0xc0, 0xea, 0xdb, 0x38, 0x35, 0x92, 0x27, 0x42, 0x2a, 0x73, 0x69, 0xa8, 0x1d, 0xb3, 0x15,
+  0xd1, 0xdc, 0x6a, 0xd2, 0xd5, 0x9d, 0x32, 0x37, 0x92, 0xa4, 0xb9, 0xae, 0x84, 0x97, 0x0f, 0xe0,
+  0xad, 0xda, 0xca, 0xd9, 0x26, 0x46, 0xdd, 0x30, 0xdd, 0x3a, 0xfe, 0xd7, 0x37, 0x05, 0x28, 0xba,
+  0xdf, 0xc8, 0x4d, 0x3b, 0x26, 0xeb, 0x56, 0xf3, 0x08, 0x1b, 0xfa, 0xd5, 0x89, 0x04, 0xec, 0xb7,
+  0xcc, 0x2a, 0x3c, 0xa4, 0x5f, 0x11, 0xf1, 0x75, 0xab, 0x39, 0x89, 0x35, 0x5d, 0xdb, 0xf7, 0x90,
+  0x2f, 0x15, 0x32, 0x75, 0x19, 0x99, 0x64, 0xe4, 0x0b, 0x1d, 0x4b, 0xc5, 0x7b, 0xbe, 0xd4, 0x99,
+  0xeb, 0xf5, 0x4c, 0xc5, 0x01, 0x56, 0xaa, 0xeb, 0x38, 0x7c, 0xa0, 0xdc, 0xdf, 0xee, 0xee, 0x54,
+  0x1d, 0x7f, 0xe9, 0xd4, 0xd1, 0x8b, 0xf5, 0xf4, 0x5d, 0xa3, 0xf1, 0xd0, 0x5a, 0x2b, 0x17, 0xe9,
+  0x14, 0x4f, 0x3c, 0x54, 0xb4, 0x1b, 0x42, 0x48, 0x3d, 0x47, 0xcf, 0x2c, 0x75, 0x6a, 0x55, 0x81,
+  0xfc, 0x42, 0x24, 0x6e, 0x75, 0xc7, 0x5d, 0xa5, 0x8c, 0x1a, 0x88, 0x2f, 0xa7, 0x01, 0x14, 0x56,
+  0x17, 0x87, 0xf0, 0x36, 0xe0, 0x4b, 0xbd, 0x40, 0xa7, 0x1e, 0x30, 0x99, 0x1a, 0xf9, 0x08, 0x79,
+  0x4f, 0x1b, 0x8c, 0x8d, 0x11, 0x6e, 0x7f, 0x12, 0x10, 0x9f, 0xc1, 0xf4, 0x88, 0xaf, 0x00, 0x9b,
+  0x3b, 0xf8, 0x3b, 0x75, 0x92, 0x3e, 0x95, 0x5f, 0x0e, 0x3c, 0x15, 0x76, 0x5c, 0x41, 0xae, 0xe6,
+  0xb4, 0xba, 0x76, 0xc0, 0xdc, 0x71, 0x45, 0xb0, 0x9a, 0xd6, 0xea, 0x56, 0x42, 0xe9, 0x4e, 0x55,
+  0x65, 0xb3, 0x9a, 0xe4, 0x55, 0xb7, 0x86, 0xe1, 0x55, 0xbd, 0x5a, 0xa3, 0x0e, 0xbb, 0x15, 0xc6,
+  0xaf, 0x50, 0x1e, 0xab, 0x56, 0x7d, 0x77, 0x05, 0x67, 0x44, 0x1e, 0x39, 0xce, 0xc5, 0x6b, 0x44,
+  0x78, 0x4f, 0x5e, 0xba, 0xf3, 0x41, 0x5d, 0x3c, 0x6a, 0xd4, 0x3f, 0xc4, 0x86, 0x6e, 0xa9, 0xa5,
+  0x4b, 0xf6, 0xfa, 0x96, 0x73, 0x62, 0x7b, 0xf9, 0x24, 0x1a, 0xe6, 0x61, 0x85, 0x95, 0xaa, 0xf7,
+  0x5f, 0xdf, 0x8e, 0x36, 0x97, 0xbe, 0x75, 0x45, 0x7a, 0x53, 0x87, 0xeb, 0x37, 0xaa, 0x36, 0x6c,
+  0x1c, 0x01, 0xb7, 0xa6, 0xdb, 0x5d, 0x33, 0x42, 0x48, 0xf9, 0x40, 0xaf, 0x7d, 0xfd, 0x06, 0x5c,
+  0x10, 0x85, 0x61, 0xd3, 0xed, 0x19, 0xe9, 0xb1, 0xc8, 0xf3, 0x0e, 0xce, 0x25, 0x1c, 0x7c, 0x14,
+  0xe9, 0x3f, 0x59, 0x3a, 0x9b, 0x6e, 0x46, 0xa3, 0x20, 0x8d, 0x87, 0x5e, 0x79, 0x64, 0xbe, 0x64,
+  0xda, 0x75, 0x51, 0x9e, 0x3a, 0x05, 0xb6, 0x87, 0xed, 0x7b, 0x9f, 0xe8, 0xc0, 0x9e, 0x38, 0x3b,
+  0x08, 0xb8, 0x70, 0xa7, 0x02, 0xf1, 0xb4, 0x65, 0xcc, 0x2d, 0x9d, 0xc8, 0xd9, 0xb7, 0x6f, 0x46,
+  0x2f, 0xff, 0x55, 0x27, 0x88, 0x8b, 0x67, 0xd4, 0x8f, 0xdd, 0x09, 0x30, 0xa6, 0xb0, 0x3a, 0x59,
+  0x7d, 0xa3, 0x09, 0x20, 0x3f, 0xe2, 0xd3, 0xae, 0xe6, 0xcd, 0x52, 0x7c, 0x32, 0x6a, 0xbb, 0xe6,
+  0x08, 0x79, 0x2d, 0x3a, 0x33, 0x2e, 0x86, 0x66, 0xe9, 0x30, 0xe3, 0x98, 0x75, 0x4a, 0xf8, 0xe6,
+  0xde, 0x2f, 0x25, 0x74, 0xb5, 0xfd, 0xdb, 0x78, 0x3c, 0x16, 0x7a, 0xdc, 0x44, 0x78, 0x6a, 0xfd,
+  0x74, 0xd9, 0xd3, 0x54, 0x95, 0xfb, 0x78, 0xc2, 0xb1, 0xc2, 0x18, 0xa8, 0xe1, 0x45, 0x79, 0x43,
+  0x6d, 0x9d, 0xa8, 0x9a, 0x90, 0xda, 0xb3, 0x2f, 0x45, 0x1d, 0x8d, 0xa9, 0x25, 0xb9, 0x58, 0xe0,
+  0xcc, 0x25, 0x16, 0x49, 0xa1, 0xc2, 0x4f, 0x35, 0xf5, 0xd4, 0x54, 0xce, 0x10, 0x7e, 0x4b, 0x76,
+  0xdb, 0xaf, 0x62, 0x21, 0x00, 0x8a, 0x7a, 0x26, 0x2e, 0xd4, 0xeb, 0xb4, 0x22, 0x96, 0xbf, 0x9e,
+  0x65, 0xf8, 0x10, 0x80, 0xb8, 0xd5, 0xa1, 0x0a, 0xe9, 0x58, 0xc1, 0x45, 0xee, 0xbc, 0xea, 0x0d,
+  0x83, 0x50, 0x0c, 0x16, 0x2a, 0xcf, 0x17, 0x41, 0x9d, 0x72, 0x0b, 0x2c, 0xd6, 0x22, 0x31, 0x26,
+  0xf3, 0x4b, 0x8a, 0x68, 0xd7, 0x5c, 0x34, 0x44, 0x8f, 0xca, 0x9c, 0x00, 0xe7, 0x86, 0x67, 0x79,
+  0x8c, 0xc3, 0xc4, 0x24, 0xa3, 0x0a, 0x3a, 0x4c, 0x8a, 0xf1, 0x7f, 0xeb, 0x47, 0xf3, 0x1c, 0xce,
+  0x0a, 0x7c, 0xea, 0x72, 0xed, 0x43, 0x50, 0xda, 0xef, 0xe8, 0xe1, 0x63, 0x66, 0xb2, 0x89, 0xaf,
+  0x2e, 0x08, 0x3d, 0x6c, 0xe0, 0xf4, 0xd4, 0xbd, 0x3e, 0x42, 0xa0, 0x27, 0x05, 0x68, 0xb1, 0x27,
+  0x42, 0x62, 0x97, 0xe7, 0x06, 0x44, 0x6d, 0x39, 0x23, 0xe6, 0x31, 0xb2, 0xea, 0x8c, 0xc8, 0x54,
+  0x72, 0x39, 0xe3, 0xf4, 0x32, 0xae, 0x73, 0x6e, 0x41, 0x3d, 0xe6, 0x1d, 0x4e, 0x73, 0xb2, 0x34,
+  0x25, 0x4a, 0xb6, 0x6f, 0xce, 0xbf, 0xde, 0x67, 0xc8, 0xc2, 0xbe, 0xde, 0x22, 0x88, 0x13, 0x5f,
+  0xb5, 0x3c, 0x28, 0x25, 0x08, 0x62, 0x94, 0xf5, 0x3c, 0xf5, 0x09, 0x09, 0x0d, 0x09, 0x5f, 0x35,
+  0x7e, 0x1b, 0xdf, 0xf1, 0x08, 0x02, 0x41, 0xf6, 0x84, 0x79, 0x3f, 0xca, 0xcb, 0x06, 0x04, 0x71,
+  0xd2, 0x05, 0x4c, 0xb8, 0x3d, 0xb8, 0x92, 0x59, 0x95, 0x48, 0x53, 0x29, 0x0e, 0x39, 0x78, 0xcc,
+  0xa8, 0xd3, 0x0d, 0x79, 0x4c, 0x2e, 0x84, 0xb3, 0x82, 0xde, 0xe4, 0x99, 0x32, 0x7a, 0x73, 0x97,
+  0xec, 0x0b, 0x03, 0xfb, 0x9c, 0xeb, 0x87, 0x2d, 0xea, 0x1e, 0x02, 0xc2, 0xc7, 0x3e, 0x68, 0xbd,
+  0x9e, 0x0f, 0x86, 0xdb, 0xbc, 0x04, 0x44, 0x6b, 0xb5, 0x3f, 0x18, 0x1e, 0xc0, 0xca, 0x5f, 0xff,
+  0xf4, 0xec, 0xae, 0x7e, 0x1c, 0xd0, 0xf6, 0x99, 0x57, 0xdd, 0x0a, 0x33, 0x5e, 0xbf, 0xfb, 0x82,
+  0xd7, 0x30, 0xc2, 0x08, 0x6c, 0x5e, 0xe5, 0xa1, 0x1f, 0xad, 0x4a, 0xb4, 0xa3, 0x53, 0x02, 0xab,
+  0x78, 0xa2, 0xc4, 0x22, 0x55, 0x4d, 0x1d, 0xa2, 0xea, 0xd9, 0x3e, 0xfd, 0x50, 0x8b, 0xd1, 0xea,
+  0x80, 0xbd, 0x40, 0xb6, 0x99, 0x2a, 0x4b, 0x77, 0x8c, 0x6d, 0xab, 0x5d, 0xce, 0x72, 0x8e, 0xef,
+  0x85, 0x53, 0x77, 0xbd, 0x34, 0x05, 0xd2, 0x12, 0xea, 0x4f, 0xbe, 0xa6, 0x27, 0xaa, 0x03, 0x69,
+  0x35, 0x57, 0xab, 0x01, 0x5a, 0xe3, 0xe5, 0x7f, 0x15, 0xf0, 0xea, 0x2a, 0xaf, 0x21, 0xe4, 0x15,
+  0x59, 0xba, 0x75, 0xb4, 0x08, 0x88, 0x40, 0xd9, 0xd7, 0xad, 0xe9, 0xc1, 0xed, 0xd7, 0x4a, 0x93,
+  0x3a, 0x9a, 0xec, 0xe7, 0x6b, 0x6a, 0x9e, 0x7b, 0x36, 0x85, 0x4f, 0x39, 0x14, 0x72, 0xea, 0xcb,
+  0x8c, 0x81, 0x3b, 0xeb, 0x18, 0xd4, 0xaa, 0xed, 0x5c, 0x71, 0x73, 0x8c, 0xf4, 0xb9, 0xf6, 0x71,
+  0xcc, 0xb6, 0x35, 0x73, 0x57, 0x6d, 0x4e, 0xac, 0x2b, 0x9b, 0x1f, 0xe3, 0xca, 0xb4, 0xd0, 0x1d,
+  0x56, 0x60, 0x4e, 0x28, 0xed, 0xe9, 0x40, 0x1d, 0xb5, 0x94, 0x98, 0x4b, 0x39, 0xc0, 0xfc, 0xaa,
+  0x3b, 0x77, 0xd5, 0xeb, 0x80, 0x46, 0x23, 0x9c, 0x11, 0x7c, 0xcb, 0xaf, 0xc2, 0xdd, 0xd5, 0xad,
+  0x74, 0xaa, 0x8b, 0x1e, 0x1b, 0xfd, 0xf8, 0xdb, 0x15, 0xe8, 0x93, 0xfe, 0x48, 0xfa, 0xe3, 0x78,
+  0x9d, 0x31, 0xa4, 0x8d, 0x3d, 0xb5, 0x3b, 0x22, 0xf9, 0x1b, 0x34, 0x76, 0xc6, 0x62, 0xc7, 0x8f,
+  0x29, 0x62, 0x4f, 0xe9, 0xdc, 0x76, 0x9b, 0x98, 0xb3, 0x83, 0x14, 0xb4, 0x65, 0x25, 0x11, 0x65,
+  0xd5, 0xca, 0x61, 0xb7, 0x15, 0x52, 0x83, 0x0d, 0x3f, 0xe1, 0x9a, 0x21, 0xe7, 0xb8, 0xe6, 0xfd,
+  0x6e, 0xad, 0x3f, 0x40, 0xb7, 0x9d, 0xe2, 0x15, 0x3d, 0x99, 0xf6, 0x2c, 0xef, 0xd1, 0x56, 0xde,
+  0x0b, 0x93, 0xde, 0x95, 0x21, 0x2b, 0xaf, 0xb9, 0xb1, 0xd1, 0xac, 0x5e, 0x85, 0x74, 0x36, 0x9a,
+  0x77, 0x4e, 0xcb, 0xf7, 0x22, 0xcd, 0xb6, 0x42, 0x63, 0xee, 0xb4, 0x2d, 0x84, 0x1d, 0x43, 0xaf,
+  0xac, 0x49, 0x3b, 0x38, 0x34, 0x04, 0xeb, 0x9b, 0xf5, 0xc6, 0xb3, 0xac, 0xb6, 0x91, 0x25, 0x91,
+  0x0f, 0xea, 0x6e, 0x43, 0xcb, 0x95, 0x3d, 0x4a, 0x11, 0xdc, 0x74, 0xc4, 0xb4, 0x22, 0xa9, 0xd5,
+  0x53, 0xa6, 0x0e, 0x6e, 0x15, 0x06, 0x29, 0x71, 0xdd, 0xd4, 0x43, 0x55, 0xac, 0xb7, 0xee, 0xa2,
+  0xee, 0xa9, 0x65, 0xb2, 0x85, 0xff, 0x9d, 0xe2, 0xa0, 0x77, 0x29, 0x64, 0xc3, 0xe3, 0x2e, 0x9e,
+  0x25, 0x70, 0x52, 0x3c, 0x6b, 0x17, 0x17, 0x8b, 0x66, 0x19, 0xbd, 0x08, 0xda, 0x76, 0x57, 0x17,
+  0xd3, 0x0b, 0x40, 0x3a, 0xad, 0xe6, 0xc3, 0x71, 0xe2, 0x55, 0x51, 0xe9, 0xc1, 0x9a, 0x15, 0xf2,
+  0x05, 0xd3, 0x9a, 0x35, 0x83, 0x58, 0x0e, 0x68, 0xd0, 0x2b, 0x97, 0x8d, 0xed, 0xb9, 0x29, 0x42,
+  0xcc, 0xe5, 0x54, 0x47, 0x8b, 0xec, 0xb2, 0x86, 0x18, 0x49, 0x65, 0xc5, 0xf3, 0xa2, 0x16, 0xf2,
+  0xc9, 0x8c, 0xca, 0xac, 0x48, 0x07, 0x05, 0x8f, 0xaa, 0x9d, 0x81, 0x47, 0xd2, 0x15, 0xc0, 0xeb,
+  0xbc, 0x9c, 0x55, 0x5a, 0x42, 0x8e, 0x38, 0xa5, 0x58, 0xd3, 0x54, 0x09, 0xe4, 0x5d, 0xa8, 0x0e,
+  0xf0, 0x79, 0xae, 0x35, 0x14, 0xfe, 0x8b, 0x01, 0x97, 0x8d, 0xd6, 0xbc, 0x31, 0xaf, 0xa4, 0x2f,
+  0x28, 0x11, 0xad, 0x97, 0x7d, 0x83, 0x35, 0x44, 0x5c, 0xf9, 0xc2, 0x76, 0x19, 0x30, 0x91, 0x83,
+  0x63, 0x16, 0x6c, 0x79, 0xca, 0x7a, 0x15, 0x07, 0x0f, 0x08, 0xd9, 0x6a, 0x37, 0xcd, 0xd2, 0xb3,
+  0xe2, 0x58, 0x86, 0xe5, 0x0e, 0xd2, 0xc2, 0xfb, 0x7f, 0xa6, 0x64, 0xe0, 0xf0, 0xec, 0x6a, 0x00,
+  0x00,
+};
@@ -0,0 +1,47 @@
+#pragma once
+#include "platform.h"
+#include <atomic>
+
+// Single-producer / single-consumer ring without locks, e.g. an ISR
+// pushing timestamps and a task popping them. N must be a power of two.
+// Each index is written by one side only; acquire/release ordering makes
+// the slot contents visible before the index that publishes them.
+template <typename T, uint16_t N>
+class SpscRing {
+  static_assert((N & (N - 1)) == 0, "N must be a power of two");
+
+ public:
+  // Producer side (ISR safe). Returns false and counts a drop when full.
+  inline __attribute__((always_inline)) bool push(T v) {
+    uint16_t h = head.load(std::memory_order_relaxed);
+    if ((uint16_t)(h - tail.load(std::memory_order_acquire)) >= N) {
+      dropped++;
+      return false;
+    }
+    slots[h & (N - 1)] = v;
+    head.store(h + 1, std::memory_order_release);
+    pushed++;
+    return true;
+  }
+
+  // Consumer side
+  bool pop(T& v) {
+    uint16_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) return false;
+    v = slots[t & (N - 1)];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  uint16_t size() const {
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+  }
+
+  volatile uint32_t pushed  = 0;  // producer-owned counters
+  volatile uint32_t dropped = 0;
+
+ private:
+  T slots[N];
+  std::atomic<uint16_t> head{0};
+  std::atomic<uint16_t> tail{0};
+};
@@ -1,710 +1,159 @@
-#pragma once
-const char STYLE_CSS[] PROGMEM = R"rawliteral(
-/* ===== General Layout ===== */
-body {
-  display: flex;
-  justify-content: center;
-  align-items: flex-start;
-  background-color: #e9ebef;
-  min-height: 100vh;
-  margin: 0;
-  font-family: 'Poppins', sans-serif;
-  color: #222;
-  line-height: 1.5;
-}
-
-.app {
-  width: 390px;
-  max-width: 390px;
-  background: #f6f7f8;
-  border-radius: 25px;
-  overflow-y: auto;
-  box-shadow: 0 0 20px rgba(0, 0, 0, 0.1);
-  margin: 20px 0;
-}
-
-/* ===== Header ===== */
-header {
-  display: flex;
-  justify-content: space-between;
-  align-items: center;
-  padding: 18px 25px;
-  background: white;
-  border-radius: 25px 25px 0 0;
-  box-shadow: 0 2px 8px rgba(0, 0, 0, 0.05);
-}
-
-.logo {
-  font-weight: 700;
-  font-size: 1.4rem;
-  color: #222;
-}
-
-nav a {
-  text-decoration: none;
-  color: #666;
-  margin-left: 18px;
-  font-weight: 500;
-  font-size: 0.95rem;
-  padding: 6px 0;
-  position: relative;
-  transition: color 0.2s ease;
-}
-
-nav a.active {
-  font-weight: 600;
-  color: #007bff;
-}
-
-nav a.active::after {
-  content: '';
-  position: absolute;
-  bottom: 0;
-  left: 0;
-  width: 100%;
-  height: 2px;
-  background-color: #007bff;
-  border-radius: 1px;
-}
-
-/* ===== Cards ===== */
-main {
-  padding: 25px;
-}
-
-.card {
-  background: white;
-  border-radius: 16px;
-  padding: 22px;
-  margin-bottom: 20px;
-  box-shadow: 0 2px 8px rgba(0, 0, 0, 0.05);
-  transition: all 0.3s ease;
-}
-
-.card:hover {
-  box-shadow: 0 4px 12px rgba(0, 0, 0, 0.08);
-}
-
-h2 {
-  font-size: 1.3rem;
-  margin-top: 0;
-  margin-bottom: 0;
-  font-weight: 600;
-}
-
-h3 {
-  font-size: 1.1rem;
-  margin-top: 0;
-  margin-bottom: 16px;
-  font-weight: 600;
-}
-
-label {
-  display: block;
-  font-weight: 500;
-  margin-bottom: 8px;
-  font-size: 0.95rem;
-  color: #444;
-}
-
-/* ===== Lamp State ===== */
-.lamp-state {
-  display: flex;
-  align-items: center;
-  gap: 18px;
-  min-height: 70px;
-}
-
-.lamp-circle {
-  width: 70px;
-  height: 70px;
-  border-radius: 50%;
-  background-color: #abcdef;
-  box-shadow: 0 4px 12px rgba(0, 0, 0, 0.1);
-  border: 3px solid white;
-  transition: all 0.3s ease;
-  flex-shrink: 0;
-  aspect-ratio: 1;
-}
-
-.lamp-circle:hover {
-  transform: scale(1.05);
-}
-
-.lamp-info {
-  flex: 1;
-  min-width: 0;
-}
-
-.lamp-info h2 {
-  white-space: nowrap;
-  overflow: hidden;
-  text-overflow: ellipsis;
-  font-size: 1.2rem;
-}
-
-/* ===== Inputs ===== */
-input[type="range"] {
-  width: 100%;
-  margin-bottom: 18px;
-  height: 6px;
-  border-radius: 3px;
-  background: #e0e0e0;
-  outline: none;
-  -webkit-appearance: none;
-}
-
-input[type="range"]::-webkit-slider-thumb {
-  -webkit-appearance: none;
-  width: 20px;
-  height: 20px;
-  border-radius: 50%;
-  background: #007bff;
-  cursor: pointer;
-  box-shadow: 0 2px 4px rgba(0, 0, 0, 0.2);
-}
-
-input[type="color"] {
-  width: 100%;
-  height: 45px;
-  border: none;
-  border-radius: 10px;
-  margin-bottom: 12px;
-  cursor: pointer;
-  box-shadow: 0 2px 6px rgba(0, 0, 0, 0.1);
-}
-
-/* ===== Switch Toggle ===== */
-.mode {
-  display: flex;
-  justify-content: space-between;
-  align-items: center;
-  margin-top: 16px;
-  padding: 12px 0;
-  border-bottom: 1px solid #f0f0f0;
-}
-
-.mode:last-of-type {
-  border-bottom: none;
-}
-
-.mode div p {
-  margin: 0;
-}
-
-.mode div p span {
-  font-size: 0.85rem;
-  color: #666;
-}
-
-.switch {
-  position: relative;
-  display: inline-block;
-  width: 48px;
-  height: 26px;
-}
-
-.switch input { display: none; }
-
-.slider {
-  position: absolute;
-  cursor: pointer;
-  top: 0; left: 0; right: 0; bottom: 0;
-  background-color: #ccc;
-  border-radius: 26px;
-  transition: 0.4s;
-  box-shadow: inset 0 1px 3px rgba(0, 0, 0, 0.2);
-}
-
-.slider:before {
-  position: absolute;
-  content: "";
-  height: 20px; width: 20px;
-  left: 3px; bottom: 3px;
-  background-color: white;
-  border-radius: 50%;
-  transition: 0.4s;
-  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.2);
-}
-
-input:checked + .slider { 
-  background-color: #007bff; 
-}
-
-input:checked + .slider:before { 
-  transform: translateX(22px); 
-}
-
-/* ===== Buttons ===== */
-.default-btn, .custom-btn {
-  border: none;
-  border-radius: 10px;
-  padding: 10px 16px;
-  cursor: pointer;
-  font-weight: 500;
-  transition: all 0.2s ease;
-  font-size: 0.95rem;
-}
-
-.default-btn {
-  background: #f0f0f0;
-  width: 100%;
-  margin-top: 12px;
-  color: #444;
-}
-
-.default-btn:hover {
-  background: #e5e5e5;
-}
-
-.custom-btn {
-  background: #f0f0f0;
-  color: #444;
-}
-
-.custom-btn:hover {
-  background: #e5e5e5;
-}
-
-/* ===== Party & Music Settings ===== */
-.party-settings, .music-settings { 
-  display: none; 
-}
-
-.palette-row, .effects {
-  display: flex;
-  justify-content: space-between;
-  align-items: center;
-  margin: 12px 0;
-}
-
-.effect {
-  border: none;
-  background: #f0f0f0;
-  border-radius: 10px;
-  padding: 8px 14px;
-  cursor: pointer;
-  font-size: 0.9rem;
-  transition: all 0.2s ease;
-  color: #444;
-}
-
-.effect:hover {
-  background: #e5e5e5;
-}
-
-.effect.active {
-  background: #007bff;
-  color: white;
-}
-
-/* ===== Color Palette Animation ===== */
-.custom-palette {
-  display: none;
-  margin-top: 12px;
-  padding: 14px;
-  background: #f9f9f9;
-  border-radius: 12px;
-  opacity: 0;
-  transform: translateY(-5px);
-  transition: opacity 0.3s ease, transform 0.3s ease;
-}
-
-.custom-palette.show {
-  display: block;
-  opacity: 1;
-  transform: translateY(0);
-}
-
-.color-pickers {
-  display: flex;
-  flex-direction: column;
-  gap: 12px;
-  margin-bottom: 15px;
-}
-
-.color-picker-item {
-  display: flex;
-  align-items: center;
-  gap: 12px;
-}
-
-.color-picker-item label {
-  width: 70px;
-  margin: 0;
-  font-size: 0.9rem;
-  color: #666;
-}
-
-.color-picker-item input[type="color"] {
-  flex: 1;
-  margin: 0;
-  height: 40px;
-}
-
-.add-color-btn {
-  width: 100%;
-  background: #f0f0f0;
-  border: none;
-  border-radius: 8px;
-  padding: 10px;
-  cursor: pointer;
-  font-weight: 500;
-  color: #666;
-  transition: all 0.2s ease;
-}
-
-.add-color-btn:hover {
-  background: #e5e5e5;
-}
-
-.remove-color-btn {
-  background: none;
-  border: none;
-  cursor: pointer;
-  padding: 6px;
-  border-radius: 6px;
-  color: #999;
-  transition: all 0.2s ease;
-  display: flex;
-  align-items: center;
-  justify-content: center;
-}
-
-.remove-color-btn:hover {
-  background: #ffebee;
-  color: #f44336;
-}
-
-/* ===== Alarm Page ===== */
-.next-alarm {
-  text-align: center;
-  padding: 25px;
-}
-
-.next-alarm h3 {
-  margin-bottom: 10px;
-}
-
-#nextTime {
-  font-size: 2.8rem;
-  font-weight: 700;
-  margin: 10px 0;
-  color: #007bff;
-}
-
-.subtext {
-  color: #666;
-  font-size: 0.9rem;
-  margin: 0;
-}
-
-.wheel-container {
-  display: flex;
-  justify-content: center;
-  align-items: center;
-  background: #eaf0ff;
-  border-radius: 14px;
-  padding: 15px;
-  font-size: 2.2rem;
-  font-weight: 600;
-  margin-bottom: 20px;
-  box-shadow: inset 0 2px 4px rgba(0, 0, 0, 0.05);
-}
-
-.wheel-container input {
-  width: 75px;
-  font-size: 2.2rem;
-  text-align: center;
-  border: none;
-  background: transparent;
-  outline: none;
-  -moz-appearance: textfield;
-  font-weight: 600;
-  color: #222;
-}
-
-.wheel-container input::-webkit-outer-spin-button,
-.wheel-container input::-webkit-inner-spin-button {
-  -webkit-appearance: none;
-  margin: 0;
-}
-
-.days {
-  display: flex;
-  justify-content: space-between;
-  margin-bottom: 20px;
-}
-
-.day {
-  width: 42px;
-  height: 42px;
-  border-radius: 50%;
-  border: none;
-  background: #f0f0f0;
-  cursor: pointer;
-  font-weight: 500;
-  transition: all 0.2s ease;
-  color: #444;
-}
-
-.day:hover {
-  background: #e5e5e5;
-}
-
-.day.active {
-  background: #007bff;
-  color: white;
-  transform: scale(1.05);
-}
-
-.add-btn {
-  display: block;
-  width: 100%;
-  background: #007bff;
-  color: white;
-  border: none;
-  border-radius: 12px;
-  padding: 14px;
-  font-weight: 600;
-  cursor: pointer;
-  font-size: 1rem;
-  transition: all 0.2s ease;
-  box-shadow: 0 2px 6px rgba(0, 123, 255, 0.3);
-}
-
-.add-btn:hover {
-  background: #0069d9;
-  transform: translateY(-2px);
-  box-shadow: 0 4px 8px rgba(0, 123, 255, 0.4);
-}
-
-.add-btn:active {
-  transform: translateY(0);
-}
-
-/* ===== Alarm List ===== */
-.alarm-item {
-  display: flex;
-  justify-content: space-between;
-  align-items: center;
-  margin: 12px 0;
-  padding: 14px 16px;
-  background: #f7f8fa;
-  border-radius: 14px;
-  transition: all 0.2s ease;
-  box-shadow: 0 1px 3px rgba(0, 0, 0, 0.05);
-}
-
-.alarm-item:hover {
-  background: #f0f2f5;
-  transform: translateY(-2px);
-  box-shadow: 0 3px 6px rgba(0, 0, 0, 0.08);
-}
-
-.alarm-item .time {
-  font-size: 1.6rem;
-  font-weight: 600;
-  margin-bottom: 4px;
-}
-
-.alarm-item .desc {
-  font-size: 0.85rem;
-  color: #666;
-}
-
-.empty {
-  text-align: center;
-  color: #999;
-  font-style: italic;
-  margin: 20px 0;
-}
-
-/* ===== Alarm Controls ===== */
-.alarm-controls {
-  display: flex;
-  align-items: center;
-  gap: 12px;
-}
-
-.delete-btn {
-  background: none;
-  border: none;
-  cursor: pointer;
-  padding: 6px;
-  border-radius: 6px;
-  color: #999;
-  transition: all 0.2s ease;
-  display: flex;
-  align-items: center;
-  justify-content: center;
-}
-
-.delete-btn:hover {
-  background: #ffebee;
-  color: #f44336;
-  transform: scale(1.1);
-}
-
-.alarm-info {
-  flex: 1;
-}
-
-/* ===== Disabled Alarm State ===== */
-.alarm-item.disabled .time {
-  color: #999;
-  text-decoration: line-through;
-}
-
-.alarm-item.disabled .desc {
-  color: #bbb;
-}
-
-/* ===== RTC card ===== */
-.rtc-card { }
-.rtc-row { display:flex; gap:12px; align-items:baseline; flex-wrap:wrap; }
-.rtc-time { font-size:2rem; font-weight:700; letter-spacing:0.02em; }
-.rtc-date { opacity:.75; }
-.rtc-state { margin-left:auto; font-weight:600; }
-
-/* ===== Responsive Design ===== */
-@media (max-width: 420px) {
-  .app {
-    width: 95%;
-    margin: 10px auto;
-    border-radius: 20px;
-  }
-  
-  main {
-    padding: 20px 15px;
-  }
-  
-  .card {
-    padding: 18px;
-    border-radius: 14px;
-  }
-  
-  .lamp-state {
-    gap: 15px;
-  }
-  
-  .lamp-circle {
-    width: 60px;
-    height: 60px;
-  }
-  
-  .lamp-info h2 {
-    font-size: 1.1rem;
-  }
-  
-  .wheel-container {
-    font-size: 1.8rem;
-    padding: 12px;
-  }
-  
-  .wheel-container input {
-    font-size: 1.8rem;
-    width: 60px;
-  }
-  
-  .day {
-    width: 38px;
-    height: 38px;
-  }
-  
-  #nextTime {
-    font-size: 2.4rem;
-  }
-}
-
-/* ===== Animation Keyframes ===== */
-@keyframes fadeIn {
-  from {
-    opacity: 0;
-    transform: translateY(10px);
-  }
-  to {
-    opacity: 1;
-    transform: translateY(0);
-  }
-}
-
-.alarm-item {
-  animation: fadeIn 0.3s ease;
-}
-
-/* ===== Scrollbar Styling ===== */
-.app::-webkit-scrollbar {
-  width: 6px;
-}
-
-.app::-webkit-scrollbar-track {
-  background: #f1f1f1;
-  border-radius: 3px;
-}
-
-.app::-webkit-scrollbar-thumb {
-  background: #c1c1c1;
-  border-radius: 3px;
-}
-
-.app::-webkit-scrollbar-thumb:hover {
-  background: #a8a8a8;
-}
-
-/* ===== Alarm ramp & test ===== */
-.field-row {
-  display: flex;
-  flex-direction: column;
-  gap: 6px;
-  margin-top: 10px;
-}
-
-.field-row input[type="number"] {
-  width: 100%;
-  padding: 6px 10px;
-  border-radius: 10px;
-  border: 1px solid #d5d7dd;
-  font-family: inherit;
-  font-size: 0.95rem;
-  box-sizing: border-box;
-}
-
-.test-row {
-  display: flex;
-  gap: 8px;
-  margin-top: 12px;
-}
-
-.test-btn {
-  flex: 1;
-}
-
-.progress-line {
-  position: relative;
-  width: 100%;
-  height: 6px;
-  border-radius: 999px;
-  background: #e3e5ea;
-  margin-top: 8px;
-  overflow: hidden;
-  opacity: 0;
-  transform: translateY(4px);
-  transition: opacity 0.2s ease, transform 0.2s ease;
-}
-
-.progress-line.active {
-  opacity: 1;
-  transform: translateY(0);
-}
-
-.progress-fill {
-  position: absolute;
-  inset: 0;
-  width: 0%;
-  height: 100%;
-  background: linear-gradient(90deg, #4facfe, #00f2fe);
-  transition: width 0.15s linear;
-}
-
-)rawliteral";
+#pragma once
+// Generated by tools/build_assets.py from web/style.css - do not edit.
+// 9086 bytes minified, 2431 bytes gzip.
+const char STYLE_CSS_ETAG[] = "\"6429d04d\"";
+const size_t STYLE_CSS_GZ_LEN = 2431;
+const uint8_t STYLE_CSS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x5a, 0x4b, 0x8f, 0xe3, 0xb8,
+  0x11, 0xfe, 0x2b, 0xc6, 0x34, 0x16, 0xd3, 0x8d, 0xb4, 0x04, 0x49, 0x96, 0xdd, 0xb6, 0x84, 0x00,
+  0x7b, 0xcd, 0x2d, 0x87, 0x1c, 0x12, 0x04, 0x7b, 0xa0, 0x24, 0xca, 0xe2, 0xb6, 0x5e, 0x10, 0xe9,
+  0x76, 0x7b, 0x04, 0xff, 0xf7, 0x14, 0x49, 0x3d, 0x48, 0x8a, 0xb2, 0x7b, 0x76, 0x73, 0x59, 0x18,
+  0x18, 0xb8, 0x65, 0xaa, 0x58, 0xac, 0xfa, 0xea, 0xab, 0x07, 0x27, 0x69, 0xb2, 0x6b, 0x9f, 0x11,
+  0xda, 0x96, 0xe8, 0x1a, 0xe5, 0x25, 0xfe, 0x8c, 0x7f, 0x3f, 0x53, 0x46, 0xf2, 0xab, 0x93, 0x36,
+  0x35, 0xc3, 0x35, 0x8b, 0x52, 0xf8, 0x07, 0x77, 0x31, 0x2a, 0xc9, 0xa9, 0x76, 0x08, 0xc3, 0x15,
+  0x15, 0xeb, 0x1c, 0xca, 0x50, 0xc7, 0xe2, 0x04, 0xa5, 0xef, 0xa7, 0xae, 0x39, 0xd7, 0x19, 0xbc,
+  0x50, 0x36, 0x5d, 0xf4, 0x84, 0x8f, 0x38, 0xc1, 0x79, 0x5c, 0x91, 0xda, 0x29, 0x30, 0x39, 0x15,
+  0x2c, 0xf2, 0x3d, 0xef, 0xa3, 0x88, 0x2b, 0xd4, 0x9d, 0x48, 0x1d, 0x79, 0x71, 0x0e, 0x82, 0x9d,
+  0x1c, 0x55, 0xa4, 0xbc, 0x46, 0xdf, 0xff, 0xd9, 0xb4, 0x2d, 0xa9, 0xe9, 0xf7, 0x57, 0x8a, 0x6a,
+  0xea, 0x50, 0xdc, 0x91, 0x3c, 0x1e, 0x04, 0x05, 0x41, 0x10, 0x97, 0xa4, 0xc6, 0x93, 0x18, 0x77,
+  0x77, 0x73, 0x51, 0xdb, 0xf6, 0x17, 0x92, 0xb1, 0x22, 0xda, 0x1e, 0xbd, 0xf6, 0x13, 0xa4, 0x7e,
+  0x3a, 0xea, 0xdf, 0xb3, 0x3e, 0xd1, 0x53, 0xbe, 0xcf, 0xdf, 0xf2, 0x43, 0x9c, 0x34, 0x5d, 0x86,
+  0x3b, 0xa7, 0x43, 0x19, 0x39, 0xd3, 0x28, 0xd8, 0xc1, 0xaa, 0xe6, 0x03, 0x77, 0x79, 0xd9, 0x5c,
+  0x9c, 0x6b, 0x84, 0xce, 0xac, 0x81, 0x25, 0x70, 0x9e, 0x02, 0x65, 0xcd, 0x25, 0xf2, 0x36, 0xde,
+  0x26, 0x00, 0x49, 0x9b, 0xee, 0x94, 0xa0, 0x67, 0xef, 0x55, 0x7c, 0x5c, 0xff, 0x65, 0xd4, 0x5f,
+  0xfc, 0xe6, 0xdd, 0x0a, 0x8c, 0x40, 0xe8, 0x7d, 0xcb, 0xd1, 0x16, 0xa5, 0xd8, 0x49, 0x30, 0xbb,
+  0x60, 0x5c, 0x6b, 0x06, 0x1c, 0x6c, 0xda, 0xa2, 0x2c, 0x23, 0xf5, 0x29, 0xf2, 0x0f, 0x20, 0x53,
+  0x28, 0xa6, 0xa8, 0x7f, 0x29, 0x60, 0xad, 0x45, 0x79, 0xb1, 0x10, 0x94, 0xf4, 0x74, 0xad, 0x03,
+  0x78, 0x78, 0x30, 0xd5, 0xf6, 0x76, 0x2f, 0x37, 0xb7, 0x6c, 0x4e, 0x4d, 0x2f, 0x8c, 0x7e, 0x91,
+  0x86, 0x7c, 0xf3, 0x06, 0x27, 0x50, 0xf2, 0x03, 0x83, 0x59, 0xc3, 0x0e, 0x57, 0x8a, 0xd1, 0x6f,
+  0x35, 0xfa, 0xd8, 0xa0, 0x9e, 0xe1, 0x4f, 0xe6, 0x64, 0x38, 0x6d, 0x3a, 0xc4, 0x48, 0x53, 0x47,
+  0x75, 0x53, 0xe3, 0x71, 0xd5, 0x7e, 0xbf, 0x1f, 0xec, 0xe1, 0x94, 0x38, 0x67, 0xe2, 0x00, 0xb1,
+  0xba, 0xc5, 0x4e, 0xdb, 0xc2, 0x73, 0x8f, 0x3b, 0xbe, 0xc7, 0x78, 0xde, 0x3d, 0x3f, 0x40, 0xdc,
+  0x36, 0x94, 0x08, 0xc9, 0x1d, 0x2e, 0x61, 0x8b, 0x0f, 0x1c, 0xb3, 0x0e, 0x40, 0x20, 0x9f, 0x89,
+  0x8d, 0x36, 0x9e, 0x1b, 0xd0, 0x0d, 0x46, 0x14, 0x4b, 0x9d, 0x5c, 0x94, 0xf2, 0x75, 0xda, 0x61,
+  0xf6, 0xb0, 0xd3, 0xa0, 0x95, 0xe7, 0xbd, 0x25, 0x79, 0xae, 0x2d, 0x8d, 0x22, 0x94, 0x83, 0xa5,
+  0xfb, 0xd1, 0x25, 0xdf, 0xbf, 0xcf, 0xdb, 0xa2, 0x84, 0x36, 0xe5, 0x59, 0xd8, 0x98, 0xb1, 0xa6,
+  0x02, 0x64, 0x8a, 0xb3, 0x78, 0xb1, 0xc4, 0x13, 0xa0, 0xf6, 0x97, 0x78, 0x80, 0x5e, 0xa0, 0xb9,
+  0xc6, 0xd1, 0xf6, 0x33, 0x5c, 0xe4, 0xb7, 0x9f, 0xb7, 0x0a, 0x91, 0xba, 0x1f, 0x0f, 0xcb, 0xdd,
+  0x75, 0x73, 0x53, 0xd4, 0x65, 0xfd, 0x03, 0xef, 0xfa, 0x60, 0x97, 0xc9, 0x46, 0x41, 0x20, 0xd0,
+  0x2d, 0x6c, 0x3c, 0x28, 0x18, 0x08, 0x80, 0x7f, 0xc5, 0xe9, 0xaa, 0x25, 0x51, 0x59, 0x82, 0x1d,
+  0xb7, 0x83, 0x1d, 0x85, 0x22, 0x51, 0xc1, 0x03, 0xa0, 0xd7, 0x44, 0x85, 0x20, 0xc6, 0x0f, 0x16,
+  0xb2, 0x0e, 0x2f, 0xb7, 0x22, 0xe8, 0x55, 0xb4, 0x6c, 0xb9, 0x27, 0x07, 0xc5, 0x58, 0xd3, 0x82,
+  0xbd, 0x74, 0x2d, 0xbd, 0xd8, 0x70, 0xcf, 0xad, 0xd8, 0x6a, 0x02, 0xfc, 0x07, 0x02, 0x84, 0x19,
+  0x4c, 0x19, 0x25, 0x4a, 0x70, 0x39, 0x85, 0x5b, 0x52, 0x36, 0xe9, 0xfb, 0x02, 0x70, 0xba, 0x98,
+  0x09, 0x92, 0x1a, 0x04, 0x07, 0xd7, 0x85, 0x61, 0x08, 0x81, 0x81, 0xaa, 0x96, 0xd3, 0x18, 0xc3,
+  0x7a, 0x1c, 0x5b, 0x22, 0xf5, 0x84, 0x5a, 0x09, 0x72, 0x85, 0xd6, 0xde, 0x3c, 0xee, 0x58, 0x21,
+  0x24, 0x25, 0x5d, 0x5a, 0xe2, 0x81, 0x98, 0xf8, 0xf3, 0x58, 0x59, 0x63, 0x78, 0x79, 0x07, 0xb0,
+  0x5a, 0x62, 0x09, 0x25, 0x69, 0x86, 0xf3, 0xf8, 0x0b, 0x2e, 0x01, 0x2a, 0x92, 0x02, 0xa3, 0x2d,
+  0xfc, 0x04, 0x10, 0x26, 0xd9, 0x46, 0xa2, 0x69, 0xcd, 0xe9, 0xb1, 0xe4, 0xeb, 0xa2, 0x23, 0xf5,
+  0x3b, 0x58, 0x1b, 0xd1, 0x16, 0xa7, 0xcc, 0x11, 0x61, 0x1d, 0xf9, 0xda, 0x09, 0x06, 0x60, 0x08,
+  0x41, 0x79, 0xd3, 0x55, 0x11, 0x4d, 0x51, 0x89, 0x9f, 0xfd, 0x81, 0x48, 0xf8, 0x42, 0x52, 0xe7,
+  0xc0, 0x26, 0x20, 0x30, 0xf2, 0x85, 0x31, 0xe4, 0x99, 0x3d, 0xe5, 0xd7, 0x0d, 0x00, 0x46, 0x28,
+  0xe4, 0x08, 0x02, 0x04, 0xe2, 0xb8, 0x74, 0xa8, 0x9d, 0x38, 0x37, 0x2a, 0x48, 0x96, 0x01, 0x1f,
+  0x0a, 0x7e, 0x99, 0x1e, 0xe2, 0xb2, 0x24, 0x2d, 0x25, 0x54, 0x23, 0xa6, 0x00, 0x3c, 0x76, 0x23,
+  0x75, 0x7b, 0x66, 0xff, 0x65, 0xd7, 0x16, 0xff, 0xfd, 0x1b, 0xe8, 0x75, 0xc2, 0xdf, 0x7e, 0xeb,
+  0x95, 0x08, 0x35, 0xb0, 0x73, 0x98, 0x6d, 0xbf, 0x5f, 0x98, 0x7e, 0x6b, 0x24, 0x08, 0xec, 0xf1,
+  0x4f, 0xdc, 0x9c, 0x19, 0xcf, 0x33, 0x92, 0xe1, 0x00, 0x50, 0xc9, 0x3b, 0x61, 0x0e, 0x24, 0x1a,
+  0x8c, 0x60, 0xbf, 0x54, 0x3e, 0xb7, 0xa9, 0x11, 0x45, 0xe3, 0x62, 0x0a, 0x4e, 0x80, 0x6d, 0x58,
+  0x71, 0xae, 0x92, 0x7e, 0x45, 0xc2, 0x40, 0x2b, 0x81, 0x82, 0x8e, 0xe0, 0x11, 0x3a, 0x26, 0x8e,
+  0x49, 0xcf, 0x1d, 0x05, 0x98, 0xb4, 0x0d, 0x11, 0x70, 0x5c, 0x90, 0x40, 0x68, 0xa2, 0x24, 0x78,
+  0xd1, 0x34, 0x16, 0x28, 0xd3, 0x0d, 0x37, 0xe8, 0x10, 0xee, 0x26, 0x1d, 0xa4, 0x9a, 0x06, 0x27,
+  0x79, 0x0b, 0x1a, 0xe2, 0x90, 0x7c, 0xa8, 0xd0, 0x7e, 0x09, 0xdb, 0x9b, 0x5b, 0x35, 0x19, 0xfe,
+  0x93, 0x29, 0x53, 0xe1, 0x0d, 0x8d, 0x2e, 0x45, 0x9c, 0x78, 0xa3, 0xf2, 0xa3, 0xa6, 0x53, 0x80,
+  0x3c, 0xe5, 0x1e, 0xff, 0x48, 0x15, 0xa2, 0x12, 0x51, 0x80, 0x5e, 0xee, 0x70, 0xdb, 0xf4, 0xfa,
+  0x2b, 0xc2, 0xd7, 0x62, 0xd5, 0x26, 0x23, 0x1f, 0x9b, 0xb6, 0x1f, 0xcb, 0x16, 0xf5, 0xe1, 0x06,
+  0xd4, 0xac, 0x7b, 0x95, 0x5c, 0x0e, 0x2a, 0xb9, 0x40, 0x76, 0xbc, 0xb9, 0xf4, 0x42, 0x58, 0x5a,
+  0xf4, 0xcb, 0x24, 0x37, 0x9e, 0x9f, 0xd4, 0xa2, 0xb8, 0x91, 0x54, 0x26, 0xfd, 0x12, 0x2a, 0xe8,
+  0x0d, 0xf6, 0x9c, 0x5d, 0xa4, 0x94, 0x8d, 0x70, 0xe5, 0x64, 0x39, 0xa9, 0xa3, 0xc4, 0x5c, 0xbf,
+  0x4c, 0x67, 0x86, 0x6b, 0x24, 0xc5, 0x0e, 0xa9, 0xad, 0x13, 0xb2, 0xbd, 0x39, 0xe5, 0x2d, 0x99,
+  0x28, 0x4d, 0x53, 0xb3, 0xea, 0xe0, 0x86, 0x56, 0xc8, 0xc5, 0x73, 0x43, 0xaa, 0x7a, 0x1c, 0xea,
+  0x37, 0xcc, 0xa0, 0x22, 0xe1, 0xe6, 0xde, 0x5a, 0x80, 0x38, 0xa8, 0x1a, 0x41, 0x59, 0xd8, 0x74,
+  0xd8, 0xa6, 0xf1, 0xe0, 0xfd, 0x6f, 0xdf, 0xb4, 0xc8, 0x50, 0x02, 0x46, 0xa8, 0x2f, 0xc2, 0x57,
+  0x2a, 0xbe, 0xb5, 0x25, 0x64, 0x5b, 0x4e, 0xe5, 0xf1, 0x74, 0x47, 0xf5, 0x75, 0xa5, 0x85, 0xc9,
+  0xa3, 0xb4, 0xc0, 0xe9, 0x3b, 0xce, 0x36, 0x7f, 0xdb, 0x8c, 0xf6, 0x5e, 0x2b, 0x03, 0xd6, 0x5e,
+  0x18, 0x4f, 0x3d, 0x73, 0xaa, 0xf8, 0x06, 0x60, 0xc0, 0xff, 0x7e, 0xe6, 0x49, 0x1e, 0xec, 0x03,
+  0xcc, 0x8f, 0xce, 0x25, 0x73, 0x12, 0x56, 0xbf, 0xba, 0x29, 0x84, 0x44, 0x53, 0xf1, 0xef, 0xfd,
+  0x83, 0xb0, 0x9c, 0xb0, 0xcf, 0x4b, 0x52, 0x11, 0x0d, 0x86, 0xeb, 0xcd, 0x04, 0xb9, 0x48, 0x10,
+  0xc1, 0x98, 0x20, 0xcc, 0x3c, 0xa9, 0xe9, 0xd4, 0x6b, 0x45, 0xb5, 0x08, 0xa4, 0x78, 0xc9, 0xc0,
+  0x22, 0x24, 0x05, 0x35, 0x28, 0x29, 0x56, 0x91, 0x32, 0x16, 0x1d, 0x2a, 0xff, 0xee, 0xf8, 0xe7,
+  0xa6, 0x1d, 0x79, 0xb9, 0x95, 0x2a, 0x6f, 0x5e, 0x79, 0x47, 0x5c, 0x0b, 0x8d, 0xc9, 0x15, 0x7a,
+  0x09, 0xc6, 0xc0, 0x3a, 0xf4, 0xd5, 0xad, 0xce, 0x94, 0xa4, 0xd3, 0xdf, 0x46, 0x18, 0xb5, 0x90,
+  0xe0, 0x18, 0xe4, 0xaa, 0xae, 0xb9, 0xbc, 0xba, 0x38, 0xcf, 0x21, 0x35, 0xd2, 0xff, 0x0b, 0x47,
+  0x0d, 0x94, 0x74, 0x9b, 0x84, 0x8a, 0x2c, 0xcc, 0x53, 0x61, 0x24, 0xf2, 0x21, 0x2f, 0x29, 0x44,
+  0x8c, 0xcb, 0xdf, 0x1d, 0xd0, 0x1a, 0x55, 0x74, 0x63, 0x2b, 0x74, 0x14, 0x0b, 0x9b, 0x55, 0xcd,
+  0x41, 0x7a, 0x4b, 0xca, 0xd0, 0x01, 0xb3, 0xb4, 0xe4, 0x1d, 0x0c, 0xf1, 0x2a, 0xd2, 0x0f, 0x57,
+  0x20, 0x34, 0x22, 0x83, 0x73, 0xdc, 0x2a, 0x86, 0x54, 0x37, 0x49, 0x75, 0xee, 0xb8, 0x48, 0x2e,
+  0x18, 0xeb, 0x79, 0x5b, 0xc2, 0x9b, 0x23, 0x7a, 0xf2, 0xfa, 0xe0, 0x2a, 0xcd, 0x81, 0x0b, 0xf4,
+  0x4d, 0x41, 0x11, 0x9a, 0xdd, 0xe0, 0x91, 0x7f, 0x4c, 0x1b, 0xf0, 0x57, 0x1a, 0x70, 0x28, 0x61,
+  0xd7, 0x68, 0x08, 0x10, 0x3d, 0x48, 0xff, 0xf3, 0xec, 0x40, 0x86, 0xd4, 0x2a, 0xea, 0x61, 0xfd,
+  0x5c, 0x60, 0xbd, 0x4e, 0xef, 0x69, 0x95, 0xb6, 0xa6, 0xb5, 0x4b, 0x8b, 0xe6, 0x62, 0xf8, 0x75,
+  0xdc, 0xd8, 0xb7, 0x6f, 0xec, 0x01, 0x35, 0x08, 0x3b, 0x38, 0x2d, 0x01, 0x52, 0xe9, 0x0c, 0x5c,
+  0x0a, 0x3c, 0x65, 0xa4, 0x03, 0x43, 0x0e, 0x1d, 0xd3, 0xb9, 0xaa, 0x65, 0xa5, 0xba, 0xec, 0x1d,
+  0x7c, 0xd9, 0x85, 0x28, 0xd2, 0x04, 0x66, 0xbf, 0x56, 0xf8, 0x06, 0xd6, 0x77, 0x07, 0xa8, 0x2a,
+  0x45, 0xaf, 0xde, 0xe2, 0xab, 0xa8, 0x51, 0x33, 0xe3, 0x52, 0x90, 0xad, 0x52, 0x19, 0x4b, 0xcc,
+  0x51, 0xe4, 0x58, 0xae, 0x88, 0xa2, 0x1b, 0x7c, 0x2c, 0xd9, 0x57, 0x70, 0x86, 0xc2, 0x45, 0xab,
+  0xa0, 0xb7, 0x91, 0xe8, 0xc1, 0xe0, 0xd0, 0x47, 0xf4, 0xa9, 0x34, 0xbf, 0x6b, 0x51, 0x60, 0xa8,
+  0x76, 0x27, 0x02, 0xc0, 0x2a, 0xf0, 0x9b, 0x72, 0x0a, 0x65, 0x91, 0xa2, 0xeb, 0xd0, 0x76, 0xeb,
+  0x8a, 0x29, 0x7d, 0xb4, 0x71, 0xa4, 0xfd, 0xcc, 0xbf, 0xc7, 0xe3, 0x71, 0x3d, 0x58, 0x1f, 0xb9,
+  0xdd, 0x3e, 0x04, 0x5a, 0x6a, 0x6d, 0x39, 0x20, 0x44, 0x76, 0x82, 0x27, 0x3a, 0xc8, 0xc3, 0x70,
+  0xbb, 0x05, 0xa7, 0xd7, 0xbc, 0xda, 0x47, 0x25, 0xea, 0x2a, 0x39, 0x58, 0x10, 0x7b, 0x9a, 0x73,
+  0x10, 0xd9, 0x2a, 0xcf, 0x4b, 0x37, 0xd0, 0x39, 0x1a, 0x30, 0xe6, 0xee, 0x7f, 0xe2, 0x2b, 0xfe,
+  0x45, 0x2a, 0xac, 0x94, 0x60, 0x81, 0x7b, 0xe0, 0x38, 0x33, 0xc7, 0x1c, 0x23, 0x15, 0x8b, 0xa1,
+  0x8d, 0x31, 0x27, 0x70, 0xe9, 0x39, 0xe1, 0xba, 0xf4, 0x8a, 0x5f, 0x17, 0xc0, 0x9d, 0xcb, 0xbf,
+  0x4b, 0x81, 0x71, 0x29, 0x0c, 0x02, 0xdd, 0xfd, 0xa3, 0xd1, 0x8f, 0x65, 0x68, 0x36, 0x3c, 0xd2,
+  0xb0, 0x80, 0x00, 0xa1, 0x8b, 0x01, 0x42, 0xa8, 0xc2, 0x72, 0xa7, 0xf1, 0x7d, 0x20, 0x5a, 0x22,
+  0xb3, 0x39, 0x7e, 0x30, 0x26, 0x18, 0xcb, 0x33, 0x6b, 0x9f, 0x20, 0x1a, 0x3b, 0xe3, 0x68, 0x43,
+  0xb9, 0x39, 0x04, 0xb6, 0x55, 0x83, 0xa5, 0x0f, 0x57, 0x52, 0x8f, 0x40, 0x20, 0xa4, 0x36, 0x58,
+  0x64, 0xf4, 0x59, 0x55, 0xf3, 0x43, 0x6d, 0x91, 0xb8, 0xc4, 0x9c, 0xe0, 0x32, 0x8b, 0x57, 0xa6,
+  0x3b, 0x7c, 0x32, 0x65, 0xd7, 0x74, 0xee, 0xc3, 0x60, 0x07, 0x30, 0x24, 0x6d, 0xb9, 0x31, 0xce,
+  0x60, 0x0c, 0x28, 0xa7, 0x1e, 0xbc, 0x41, 0xea, 0x5a, 0x7f, 0x63, 0xb5, 0x7d, 0x9b, 0x91, 0x90,
+  0xa1, 0xeb, 0x4f, 0x95, 0x08, 0x4b, 0xf7, 0x08, 0x19, 0x83, 0x81, 0xc3, 0x60, 0x2e, 0xfa, 0xc5,
+  0x77, 0x4b, 0x43, 0x78, 0x3f, 0xad, 0xff, 0xd1, 0xaa, 0x4f, 0x2b, 0xd4, 0xe0, 0x28, 0xeb, 0x64,
+  0x05, 0xbf, 0x7e, 0x2d, 0x57, 0xc7, 0x2b, 0xa3, 0x83, 0x06, 0xcc, 0xe8, 0x64, 0x8b, 0x49, 0xcb,
+  0x1f, 0x6d, 0xff, 0x54, 0xa4, 0xdf, 0x89, 0x5e, 0x65, 0xdf, 0x01, 0xd3, 0x83, 0x25, 0x95, 0xc6,
+  0x30, 0xcb, 0xb2, 0x3b, 0x69, 0x81, 0xb7, 0xb1, 0x22, 0x35, 0x70, 0xd1, 0x10, 0x49, 0x05, 0xee,
+  0x08, 0xd3, 0x10, 0xc9, 0xf9, 0x9e, 0xd3, 0xb7, 0x9e, 0xd9, 0x57, 0x52, 0x92, 0xc5, 0x60, 0x77,
+  0x6a, 0xfc, 0x45, 0x39, 0xb3, 0x88, 0x8c, 0xb5, 0x5a, 0xcd, 0xbf, 0x5b, 0xa9, 0xdd, 0x6b, 0xd6,
+  0xfd, 0x60, 0xfb, 0x1a, 0xec, 0x76, 0xc0, 0x0c, 0xdb, 0x97, 0xe9, 0x70, 0x16, 0x64, 0x78, 0xde,
+  0xfe, 0x98, 0x1d, 0x57, 0x0a, 0x26, 0xde, 0xd5, 0x2c, 0x47, 0x59, 0x07, 0xdb, 0x2e, 0xa1, 0xb2,
+  0xcb, 0x80, 0xb0, 0xd5, 0x5a, 0x48, 0xe4, 0x04, 0x4b, 0xd9, 0xf2, 0xe7, 0x0a, 0x74, 0xcd, 0xc4,
+  0xb2, 0x8d, 0xd2, 0x62, 0xec, 0x2d, 0x3f, 0xe4, 0xc8, 0xc6, 0xd1, 0x5f, 0xb3, 0xaf, 0xb5, 0xbf,
+  0x14, 0x31, 0x31, 0x1f, 0xc7, 0x96, 0x45, 0xbd, 0x3c, 0xc8, 0x77, 0x5f, 0xb6, 0xef, 0xd6, 0x36,
+  0x72, 0xe1, 0xc3, 0x5b, 0x65, 0x97, 0x8d, 0xcb, 0xf4, 0x9c, 0xe9, 0xbb, 0xfb, 0xc7, 0xd9, 0x24,
+  0x14, 0xf5, 0x96, 0x22, 0x24, 0xc3, 0x34, 0x7d, 0x30, 0xfb, 0xc0, 0x55, 0xcb, 0xae, 0x96, 0x3c,
+  0xaf, 0x54, 0x26, 0x52, 0x00, 0xbb, 0x96, 0x38, 0x22, 0x0c, 0x16, 0xa5, 0xc6, 0xfd, 0xca, 0xb0,
+  0x25, 0x77, 0x69, 0xd7, 0x94, 0xf4, 0x27, 0xea, 0xd4, 0x0c, 0x43, 0xbd, 0x8d, 0xff, 0x3a, 0x25,
+  0x15, 0x7d, 0x27, 0xed, 0x3d, 0x6d, 0xbf, 0xcc, 0x55, 0x43, 0x8c, 0x69, 0x2c, 0xf8, 0x66, 0xf8,
+  0xc6, 0x38, 0xf6, 0xbc, 0xbb, 0x8d, 0xde, 0xf3, 0x3c, 0x0f, 0xf1, 0x6e, 0xdc, 0x71, 0x2c, 0xe8,
+  0xf2, 0xe4, 0x2d, 0xcc, 0x46, 0x91, 0x78, 0xbf, 0x03, 0x92, 0x53, 0x8d, 0xfe, 0xc5, 0x8a, 0xd0,
+  0x92, 0x28, 0xfc, 0x19, 0xad, 0xf3, 0x8c, 0x59, 0xc5, 0x9e, 0x0b, 0x26, 0x46, 0x49, 0x89, 0xb3,
+  0x01, 0xc9, 0xaa, 0x57, 0x8c, 0xcb, 0x2a, 0x31, 0x5a, 0x63, 0x05, 0x28, 0x70, 0x2a, 0x56, 0x44,
+  0x08, 0x1c, 0x0f, 0x22, 0x92, 0x24, 0x81, 0xda, 0x96, 0xa5, 0x8e, 0xb8, 0xa6, 0x91, 0x5f, 0x3b,
+  0xa5, 0x5d, 0x13, 0x3e, 0x9d, 0x3a, 0x2b, 0xd5, 0xb9, 0x09, 0xb8, 0x9e, 0x6f, 0x16, 0xeb, 0xdd,
+  0xbd, 0x14, 0x61, 0xc4, 0x5b, 0x60, 0xab, 0x50, 0x45, 0x73, 0xd8, 0x89, 0x51, 0x39, 0x77, 0x22,
+  0x44, 0x6d, 0xc0, 0x13, 0x17, 0x7f, 0x5d, 0xe4, 0xcb, 0xb1, 0x47, 0x04, 0x57, 0xca, 0xa7, 0xf2,
+  0xc2, 0x42, 0xbd, 0x7d, 0x13, 0x57, 0x98, 0xe6, 0x85, 0xc9, 0xaf, 0x15, 0xce, 0x08, 0xda, 0x3c,
+  0xcf, 0x17, 0xa4, 0x21, 0x0f, 0xad, 0x97, 0x5e, 0xb9, 0x42, 0x3d, 0xee, 0x7e, 0xd1, 0x2a, 0xe4,
+  0xe1, 0x2e, 0x54, 0x9b, 0xfd, 0x79, 0x8b, 0xfb, 0x2c, 0x31, 0x6d, 0x9a, 0x2f, 0xb5, 0xd4, 0x4b,
+  0x4c, 0x0b, 0x4d, 0x6a, 0xd7, 0x2c, 0xc2, 0x84, 0x3b, 0xfb, 0xb5, 0xc9, 0x5e, 0x19, 0x8c, 0xef,
+  0xe7, 0xab, 0x95, 0xf1, 0x46, 0xc1, 0xbc, 0x41, 0x5a, 0x16, 0xe4, 0xea, 0x8a, 0x83, 0x7a, 0xdd,
+  0x28, 0x79, 0xc1, 0x5e, 0xe4, 0x2e, 0x5e, 0x9a, 0x95, 0x51, 0x8b, 0xb4, 0xad, 0x32, 0x99, 0xe5,
+  0xdf, 0x57, 0x7a, 0x10, 0x7e, 0x93, 0x7a, 0xbb, 0xfd, 0xfa, 0x8e, 0xaf, 0x79, 0x87, 0x2a, 0x4c,
+  0x37, 0x39, 0xca, 0xf0, 0x3f, 0xea, 0x3e, 0xef, 0x9a, 0xaa, 0x7f, 0x30, 0x66, 0xe0, 0x1e, 0x78,
+  0xb9, 0xb1, 0xa6, 0x7f, 0x3c, 0x15, 0xd0, 0x52, 0x21, 0xaa, 0x49, 0x25, 0x41, 0x2f, 0x37, 0x53,
+  0x47, 0x10, 0xe0, 0x6a, 0xe5, 0x92, 0x22, 0x05, 0x26, 0x2d, 0x13, 0xd4, 0x8d, 0x06, 0x17, 0xcc,
+  0x6e, 0x5d, 0xe1, 0xc0, 0x7e, 0xe9, 0xbb, 0x1e, 0xc4, 0x3e, 0xff, 0x2c, 0x2f, 0x54, 0xd6, 0x45,
+  0x88, 0xcb, 0x10, 0x55, 0x44, 0xea, 0xf3, 0xcf, 0xcf, 0x8a, 0xb0, 0x10, 0x0a, 0x3a, 0xf0, 0xcf,
+  0xcd, 0x15, 0xfd, 0xc2, 0x32, 0x50, 0xd7, 0x07, 0x23, 0xfb, 0x79, 0x2e, 0x22, 0x06, 0x46, 0xc2,
+  0xcb, 0x93, 0x14, 0x6d, 0x0e, 0x51, 0xc3, 0xd6, 0xd8, 0xb8, 0x32, 0x59, 0x54, 0x85, 0x96, 0x81,
+  0x9a, 0x85, 0xb5, 0x77, 0xd9, 0x5b, 0x96, 0x69, 0xff, 0xed, 0x61, 0x2c, 0x24, 0x97, 0xf7, 0x93,
+  0x22, 0xab, 0x93, 0x1f, 0x7c, 0x97, 0xe9, 0x62, 0x02, 0x74, 0x64, 0x98, 0x32, 0x3b, 0x23, 0x1d,
+  0x8c, 0x23, 0x09, 0xac, 0x8b, 0xe5, 0x3c, 0xa7, 0x8c, 0x24, 0xda, 0x76, 0xcd, 0xa9, 0xc3, 0x94,
+  0x3a, 0x9c, 0xab, 0x2c, 0x97, 0x12, 0xcb, 0x7b, 0xa1, 0x65, 0x22, 0x04, 0x9e, 0x35, 0xef, 0xcf,
+  0xb6, 0xd0, 0x1e, 0x20, 0x73, 0x3c, 0x69, 0x5e, 0xf4, 0x3d, 0xc0, 0x7d, 0xb8, 0x3a, 0x5d, 0x0b,
+  0x2c, 0xd3, 0xb5, 0x69, 0xce, 0xa2, 0x9d, 0x68, 0xcc, 0x5e, 0x5f, 0x18, 0xa8, 0x4d, 0xef, 0xe5,
+  0xa4, 0x2c, 0x2d, 0x77, 0x11, 0xa2, 0x5b, 0x9e, 0xfe, 0x13, 0xc0, 0x6c, 0x0f, 0xb3, 0x96, 0xe7,
+  0xdb, 0x02, 0x44, 0x4f, 0xdc, 0x38, 0x90, 0xc9, 0x9f, 0x8f, 0x5e, 0x86, 0x4f, 0xaf, 0x4f, 0x61,
+  0x8e, 0xd2, 0x1c, 0xbf, 0x42, 0x7d, 0x0c, 0xf5, 0x1b, 0xd6, 0x0e, 0x26, 0x24, 0xc2, 0x11, 0xfc,
+  0x1d, 0xdd, 0xc8, 0xb7, 0x6f, 0xff, 0x03, 0x8d, 0xeb, 0x2b, 0x92, 0x7e, 0x23, 0x00, 0x00,
+};
@@ -0,0 +1,114 @@
+#pragma once
+#include "platform.h"
+
+// Beat tracker for sound onsets (micros() timestamps, wraparound-safe).
+//
+// Tempo: each onset adds its intervals to the last few onsets to a
+// decaying histogram of 60..180 BPM (short intervals folded up by
+// octaves); the strongest bin, refined by its neighbours, is the period
+// estimate.
+// Phase: a PLL keeps a predicted beat time. Onsets near a predicted beat
+// pull phase and period toward themselves and raise the confidence;
+// off-beat onsets lower it. Without onsets the prediction freewheels for
+// FREEWHEEL_US, so effects keep time through quiet passages.
+class TempoTracker {
+ public:
+  static constexpr uint32_t MIN_PERIOD_US = 333333;   // 180 BPM
+  static constexpr uint32_t MAX_PERIOD_US = 1000000;  // 60 BPM
+  static constexpr uint32_t BIN_US        = 10000;
+  static constexpr int      BINS          = (MAX_PERIOD_US - MIN_PERIOD_US) / BIN_US + 1;
+  static constexpr int      HISTORY       = 8;        // onsets paired with each new one
+  static constexpr uint32_t FREEWHEEL_US  = 8000000;
+  static constexpr uint16_t LOCK_CONF     = 160;      // of 256
+
+  void reset() {
+    memset(hist, 0, sizeof(hist));
+    count = 0;
+    period = 0;
+    confidence = 0;
+  }
+
+  void onset(uint32_t t) {
+    addIntervals(t);
+    uint32_t est = estimate();
+
+    if (!period) {
+      if (est && count >= 4) {
+        period = est;
+        beat   = t;
+      }
+    } else {
+      int32_t drift = (int32_t)est - (int32_t)period;
+      if (est && abs(drift) < (int32_t)period / 8) period += drift / 8;  // follow tempo changes
+      else if (est && confidence < 64) period = est;                      // lost it: take the new tempo
+      int32_t d = (int32_t)(t - beat);
+      int32_t k = (d >= 0 ? d + (int32_t)period / 2 : d - (int32_t)period / 2) / (int32_t)period;
+      uint32_t nearest = beat + (uint32_t)(k * (int32_t)period);
+      int32_t err = (int32_t)(t - nearest);
+      if (abs(err) < (int32_t)period / 6) {
+        beat    = nearest + err / 4;
+        period += err / 32;
+        confidence += (256 - confidence) / 4;
+      } else {
+        confidence -= confidence / 4;
+        if (confidence < 32) beat = t; // lost it: re-anchor on this onset
+      }
+      period = constrain(period, MIN_PERIOD_US, MAX_PERIOD_US);
+    }
+    lastOnset = t;
+  }
+
+  bool locked(uint32_t now) const {
+    return period && confidence >= LOCK_CONF && now - lastOnset < FREEWHEEL_US;
+  }
+
+  uint32_t periodUs() const { return period; }
+  uint16_t bpm() const { return period ? (60000000UL + period / 2) / period : 0; }
+  uint16_t confidence256() const { return confidence; }
+
+  // First predicted beat at or after t
+  uint32_t nextBeat(uint32_t t) const {
+    if (!period) return t;
+    int32_t d = (int32_t)(t - beat);
+    if (d <= 0) return beat;
+    return beat + ((uint32_t)d + period - 1) / period * period;
+  }
+
+ private:
+  uint16_t hist[BINS] = {};
+  uint32_t onsets[HISTORY];  // ring, newest at (count - 1) % HISTORY
+  uint32_t count      = 0;
+  uint32_t period     = 0;
+  uint32_t beat       = 0;   // a predicted beat time
+  uint32_t lastOnset  = 0;
+  uint16_t confidence = 0;
+
+  void addIntervals(uint32_t t) {
+    for (int b = 0; b < BINS; b++) hist[b] -= hist[b] >> 3;
+    int n = min(count, (uint32_t)HISTORY);
+    for (int i = 1; i <= n; i++) {
+      uint32_t d = t - onsets[(count - i) % HISTORY];
+      if (d < MIN_PERIOD_US / 4 || d > MAX_PERIOD_US) continue;
+      while (d < MIN_PERIOD_US) d *= 2;
+      int b = (d - MIN_PERIOD_US) / BIN_US;
+      uint16_t w = 256 / i;  // neighbours count most
+      hist[b] = (uint16_t)min((uint32_t)hist[b] + w, (uint32_t)0xFFFF);
+    }
+    onsets[count % HISTORY] = t;
+    count++;
+  }
+
+  // Weighted centre of the strongest bin and its neighbours; 0 if none
+  uint32_t estimate() const {
+    int peak = 0;
+    for (int b = 1; b < BINS; b++) if (hist[b] > hist[peak]) peak = b;
+    if (hist[peak] < 256) return 0;
+    uint32_t sum = 0;
+    uint64_t weighted = 0;
+    for (int b = max(peak - 1, 0); b <= min(peak + 1, BINS - 1); b++) {
+      sum      += hist[b];
+      weighted += (uint64_t)hist[b] * (MIN_PERIOD_US + b * BIN_US + BIN_US / 2);
+    }
+    return (uint32_t)(weighted / sum);
+  }
+};
@@ -0,0 +1,88 @@
+#pragma once
+#include "platform.h"
+
+// Request tracing. A span covers one web request from the moment its
+// handler asks for the state lock until the handler returns; its time is
+// split into phases:
+//   parse   - reading request arguments
+//   handler - everything not in another phase (state changes, responses)
+//   output  - asking for an output update
+//   persist - scheduling NVS writes
+// A Scope switches phase for its lifetime; time goes to the innermost
+// one. Outside a request (loop(), render task) scopes cost one branch.
+// The last N spans are kept in a ring for /trace.
+
+enum TracePhase : uint8_t { TRACE_PARSE, TRACE_HANDLER, TRACE_OUTPUT, TRACE_PERSIST, TRACE_PHASES };
+
+constexpr const char* TRACE_PHASE_NAMES[TRACE_PHASES] = { "parse", "handler", "output", "persist" };
+
+struct TraceSpan {
+  uint32_t    atMs;                // millis() when the request came in
+  const char* uri;                 // route pattern (static string)
+  uint32_t    lockUs;              // waiting for the state lock
+  uint32_t    us[TRACE_PHASES];
+};
+
+template <size_t N>
+class RequestTrace {
+ public:
+  class Scope {
+   public:
+    Scope(RequestTrace& t, TracePhase p) : trace(t), prev(t.enter(p)) {}
+    ~Scope() { trace.enter(prev); }
+
+   private:
+    RequestTrace& trace;
+    TracePhase    prev;
+  };
+
+  // Handler about to run (lock held); startUs is when it asked for the lock
+  void begin(const char* uri, uint32_t startUs) {
+    uint32_t now = micros();
+    cur        = {};
+    cur.atMs   = millis();
+    cur.uri    = uri;
+    cur.lockUs = now - startUs;
+    phase  = TRACE_HANDLER;
+    markUs = now;
+    active = true;
+  }
+
+  // Handler returned; the span goes into the ring
+  const TraceSpan& end() {
+    enter(TRACE_HANDLER);
+    active = false;
+    ring[head] = cur;
+    head = (head + 1) % N;
+    if (count < N) count++;
+    total++;
+    return cur;
+  }
+
+  // Oldest first; i < size()
+  const TraceSpan& span(size_t i) const { return ring[(head + N - count + i) % N]; }
+  size_t   size() const  { return count; }
+  uint32_t spans() const { return total; }  // ever recorded
+  void     clear()       { count = 0; }
+
+ private:
+  TracePhase enter(TracePhase p) {
+    TracePhase prev = phase;
+    if (active) {
+      uint32_t now = micros();
+      cur.us[phase] += now - markUs;
+      markUs = now;
+      phase  = p;
+    }
+    return prev;
+  }
+
+  TraceSpan  ring[N] = {};
+  size_t     head    = 0;
+  size_t     count   = 0;
+  uint32_t   total   = 0;
+  TraceSpan  cur     = {};
+  TracePhase phase   = TRACE_HANDLER;
+  uint32_t   markUs  = 0;
+  bool       active  = false;
+};
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""Build the web UI into PROGMEM headers for the night lamp sketch.
+
+Reads the sources in ../web, minifies them, gzip-compresses the result and
+writes one header per asset into the sketch folder:
+
+    INDEX_HTML_GZ[] / INDEX_HTML_GZ_LEN / INDEX_HTML_ETAG   -> index_html.h
+    ALARMS_HTML_GZ[] ...                                    -> alarms_html.h
+    STYLE_CSS_GZ[] ...                                      -> style_css.h
+    SCRIPT_JS_GZ[] ...                                      -> script_js.h
+
+The ETag is a short hash of the minified content. CSS and JS are referenced
+from the pages as /style.css?v=<hash> and /script.js?v=<hash>, so the
+firmware can serve them with a long-lived Cache-Control and a new firmware
+still busts the browser cache.
+
+Run after editing anything in web/:
+
+    python3 tools/build_assets.py
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+WEB_DIR = os.path.join(HERE, "..", "web")
+SKETCH_DIR = os.path.join(HERE, "..", "night_lamp6.5")
+
+# (source file, header file, C symbol prefix)
+ASSETS = [
+    ("style.css",   "style_css.h",   "STYLE_CSS"),
+    ("script.js",   "script_js.h",   "SCRIPT_JS"),
+    ("index.html",  "index_html.h",  "INDEX_HTML"),
+    ("alarms.html", "alarms_html.h", "ALARMS_HTML"),
+]
+
+
+# ---------------- Minifiers ----------------
+# Deliberately conservative: whitespace and comments only, no renaming.
+
+def minify_css(src):
+    src = re.sub(r"/\*.*?\*/", "", src, flags=re.S)
+    src = re.sub(r"\s+", " ", src)
+    src = re.sub(r"\s*([{};,])\s*", r"\1", src)
+    src = re.sub(r":\s+", ":", src)
+    src = src.replace(";}", "}")
+    return src.strip()
+
+
+def minify_js(src):
+    # Line based so automatic semicolon insertion keeps working. Only whole
+    # line comments are dropped; trailing "//" may live inside a string.
+    out = []
+    for line in src.splitlines():
+        line = line.strip()
+        if not line or line.startswith("//"):
+            continue
+        out.append(line)
+    return "\n".join(out)
+
+
+def minify_html(src):
+    src = re.sub(r"<!--.*?-->", "", src, flags=re.S)
+    src = re.sub(r"\s+", " ", src)
+    src = re.sub(r">\s+<", "> <", src)
+    return src.strip()
+
+
+MINIFIERS = {".css": minify_css, ".js": minify_js, ".html": minify_html}
+
+
+def content_hash(data):
+    return hashlib.sha1(data).hexdigest()[:8]
+
+
+def version_refs(html, versions):
+    # style.css / script.js (with or without leading slash) -> /name?v=hash
+    for name, ver in versions.items():
+        html = re.sub(r'(href|src)="/?%s"' % re.escape(name),
+                      r'\1="/%s?v=%s"' % (name, ver), html)
+    return html
+
+
+def write_header(path, symbol, source, raw_len, gz, etag):
+    lines = []
+    lines.append("#pragma once")
+    lines.append("// Generated by tools/build_assets.py from web/%s - do not edit." % source)
+    lines.append("// %u bytes minified, %u bytes gzip." % (raw_len, len(gz)))
+    lines.append('const char %s_ETAG[] = "\\"%s\\"";' % (symbol, etag))
+    lines.append("const size_t %s_GZ_LEN = %u;" % (symbol, len(gz)))
+    lines.append("const uint8_t %s_GZ[] PROGMEM = {" % symbol)
+    for i in range(0, len(gz), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in gz[i:i + 16]) + ",")
+    lines.append("};")
+    with open(path, "w", newline="\n") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+def main():
+    versions = {}
+    total_src = total_gz = 0
+    for source, header, symbol in ASSETS:
+        with open(os.path.join(WEB_DIR, source), encoding="utf-8") as f:
+            src = f.read()
+        ext = os.path.splitext(source)[1]
+        text = MINIFIERS[ext](src)
+        if ext == ".html":
+            text = version_refs(text, versions)
+        data = text.encode("utf-8")
+        etag = content_hash(data)
+        versions[source] = etag
+        # mtime=0 keeps the output byte-identical between runs
+        gz = gzip.compress(data, compresslevel=9, mtime=0)
+        write_header(os.path.join(SKETCH_DIR, header), symbol, source, len(data), gz, etag)
+        total_src += len(src.encode("utf-8"))
+        total_gz += len(gz)
+        print("%-12s %6u -> %6u -> %5u bytes  etag %s" %
+              (source, len(src.encode("utf-8")), len(data), len(gz), etag))
+    print("total        %6u -> %5u bytes" % (total_src, total_gz))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Hammer /status from several clients and report latency and loop time.
+
+Connect a laptop to the lamp's SoftAP, then:
+
+    python3 tools/load_test.py                # 8 clients, 30 s, 192.168.4.1
+    python3 tools/load_test.py --clients 4 --seconds 60 --host 192.168.4.1
+
+While the clients run, a separate monitor polls /status once a second and
+records "loopMaxUs", the worst loop() iteration the lamp saw during the
+last full second. With the async server that figure should stay bounded no
+matter how many clients are connected.
+
+    python3 tools/load_test.py --soak 10000
+
+polls /status that many times, one request at a time, and compares the
+heap gauges from /metrics (free and lowest free since boot) before and
+after. Each request allocates in the web server and frees it all again,
+so the free heap should come back to where it was. The lowest free heap
+can dip by a request's worth when one connection is still being torn down
+as the next arrives, but must not keep falling with more polls.
+"""
+
+import argparse
+import json
+import threading
+import time
+import urllib.request
+
+
+def client(url, stop, latencies, errors):
+    while not stop.is_set():
+        t0 = time.monotonic()
+        try:
+            with urllib.request.urlopen(url, timeout=5) as r:
+                r.read()
+            latencies.append(time.monotonic() - t0)
+        except Exception:
+            errors.append(1)
+
+
+def monitor(url, stop, loop_max):
+    while not stop.is_set():
+        try:
+            with urllib.request.urlopen(url, timeout=5) as r:
+                loop_max.append(json.loads(r.read()).get("loopMaxUs", 0))
+        except Exception:
+            pass
+        stop.wait(1.0)
+
+
+def heap(host):
+    gauges = {}
+    with urllib.request.urlopen("http://%s/metrics" % host, timeout=5) as r:
+        for line in r.read().decode().splitlines():
+            name, _, value = line.partition(" ")
+            if name in ("nightlamp_heap_free_bytes", "nightlamp_heap_min_free_bytes"):
+                gauges[name] = int(float(value))
+    return gauges.get("nightlamp_heap_free_bytes", 0), gauges.get("nightlamp_heap_min_free_bytes", 0)
+
+
+def soak(host, polls, warmup=200):
+    url = "http://%s/status" % host
+    failed = 0
+    for i in range(warmup + polls):
+        if i == warmup:
+            free0, min0 = heap(host)
+        try:
+            with urllib.request.urlopen(url, timeout=5) as r:
+                r.read()
+        except Exception:
+            failed += 1
+    free1, min1 = heap(host)
+    print("polls      %d, %d failed" % (polls, failed))
+    print("free heap  %d -> %d bytes (%+d)" % (free0, free1, free1 - free0))
+    print("min free   %d -> %d bytes (%+d)" % (min0, min1, min1 - min0))
+
+
+def pct(values, p):
+    if not values:
+        return 0.0
+    values = sorted(values)
+    return values[min(len(values) - 1, int(len(values) * p))]
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--host", default="192.168.4.1")
+    ap.add_argument("--clients", type=int, default=8)
+    ap.add_argument("--seconds", type=float, default=30)
+    ap.add_argument("--soak", type=int, default=0, metavar="POLLS",
+                    help="poll /status POLLS times in a row and report heap drift instead")
+    args = ap.parse_args()
+    if args.soak:
+        soak(args.host, args.soak)
+        return
+
+    url = "http://%s/status" % args.host
+    stop = threading.Event()
+    latencies, errors, loop_max = [], [], []
+
+    threads = [threading.Thread(target=client, args=(url, stop, latencies, errors))
+               for _ in range(args.clients)]
+    threads.append(threading.Thread(target=monitor, args=(url, stop, loop_max)))
+    for t in threads:
+        t.start()
+    time.sleep(args.seconds)
+    stop.set()
+    for t in threads:
+        t.join()
+
+    n = len(latencies)
+    print("requests   %d ok, %d failed, %.1f req/s" % (n, len(errors), n / args.seconds))
+    print("latency    p50 %.1f ms  p95 %.1f ms  max %.1f ms" %
+          (pct(latencies, 0.5) * 1e3, pct(latencies, 0.95) * 1e3, max(latencies or [0]) * 1e3))
+    print("loop max   p50 %d us  max %d us" % (pct(loop_max, 0.5), max(loop_max or [0])))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,862 @@
+// ==== Helpers ====
+function debounce(fn, wait){ let t; return (...a)=>{ clearTimeout(t); t=setTimeout(()=>fn(...a), wait); }; }
+function hexToRgb(hex){ const v=hex.replace('#',''); return { r:parseInt(v.substr(0,2),16), g:parseInt(v.substr(2,2),16), b:parseInt(v.substr(4,2),16) }; }
+function rgbToHex(r,g,b){ const h=n=>n.toString(16).padStart(2,'0'); return `#${h(r)}${h(g)}${h(b)}`.toUpperCase(); }
+function pad2(n){ return n.toString().padStart(2,'0'); }
+
+// ==== Device time (no RTC) ====
+let deviceEpoch = null;   // UTC epoch from /status
+let lastSyncMs  = 0;
+
+function updateTimeBox(){
+  if (deviceEpoch == null) return;
+  const d = new Date(deviceEpoch*1000);  // Date takes UTC and displays local
+  const hh = pad2(d.getHours()), mm = pad2(d.getMinutes()), ss = pad2(d.getSeconds());
+  const timeStr = `${hh}:${mm}:${ss}`;
+  const dateStr = d.toLocaleDateString(undefined, { weekday:'short', year:'numeric', month:'short', day:'numeric' });
+
+  const elTime = document.getElementById('rtcTime');
+  const elDate = document.getElementById('rtcDate');
+  const elStat = document.getElementById('rtcStatus');
+
+  if (elTime) elTime.textContent = timeStr;
+  if (elDate) elDate.textContent = dateStr;
+  if (elStat) elStat.textContent = 'Source: internal';
+}
+
+// ==== DOM ====
+const colorPicker      = document.getElementById('colorPicker');
+const lampCircle       = document.getElementById('lampCircle');
+const lampColorText    = document.getElementById('lampColor');
+const brightnessSlider = document.getElementById('brightness'); // RGB only
+const hpLEDSlider      = document.getElementById('hpLED');      // HP LED only
+const brightnessText   = document.getElementById('lampBrightness');
+const syncBtn          = document.getElementById('syncTimeBtn');
+
+// --- Find the existing "Set as default" button and inject "Set back to default"
+let setDefaultBtn = document.getElementById('setDefaultBtn');
+if (!setDefaultBtn) {
+  // robust fallback: search by visible text
+  const candidates = Array.from(document.querySelectorAll('button'));
+  setDefaultBtn = candidates.find(b => (b.textContent||'').trim().toLowerCase() === 'set as default');
+}
+let applyDefaultBtn = document.getElementById('applyDefaultBtn');
+if (!applyDefaultBtn && setDefaultBtn && setDefaultBtn.parentElement) {
+  applyDefaultBtn = document.createElement('button');
+  applyDefaultBtn.id = 'applyDefaultBtn';
+  applyDefaultBtn.className = setDefaultBtn.className || 'default-btn';
+  applyDefaultBtn.style.marginTop = '8px';
+  applyDefaultBtn.textContent = 'Set back to default';
+  setDefaultBtn.insertAdjacentElement('afterend', applyDefaultBtn);
+}
+
+// ==== Default state actions ====
+async function saveDefault(){
+  try{
+    await fetch('/default/save', { cache:'no-store' });
+    if (setDefaultBtn){ setDefaultBtn.textContent = 'Saved!'; setTimeout(()=> setDefaultBtn.textContent='Set as default', 1200); }
+    await fetchStatus();
+  }catch(_){}
+}
+
+async function applyDefault(){
+  try{
+    const r = await fetch('/default/apply', { cache:'no-store' });
+    if (r.ok){
+      if (applyDefaultBtn){ applyDefaultBtn.textContent = 'Restored!'; setTimeout(()=> applyDefaultBtn.textContent='Set back to default', 1200); }
+      await fetchStatus();
+    }
+  }catch(_){}
+}
+
+if (setDefaultBtn) setDefaultBtn.addEventListener('click', saveDefault);
+if (applyDefaultBtn) applyDefaultBtn.addEventListener('click', applyDefault);
+
+// ==== Live channel (WebSocket on /ws, /status long-poll as fallback) ====
+// Binary control opcodes, see wsEvent() in the sketch
+const WS_OP_RGB = 1, WS_OP_HP = 2, WS_OP_PARTY = 3, WS_OP_PARAM = 4;
+let ws = null;
+let polling = false;
+let lastStatus = null;
+
+// Status documents may hold only the groups that changed (/status?since=);
+// merged into the last full one before anyone sees them
+function showStatus(js){
+  // the socket sends its own "alarms" event
+  const alarmsChanged = !wsOpen() && lastStatus && js.alarmRev !== undefined && js.alarmRev !== lastStatus.alarmRev;
+  lastStatus = Object.assign(lastStatus || {}, js);
+  document.dispatchEvent(new CustomEvent('lumina:status', { detail: lastStatus }));
+  if (alarmsChanged) document.dispatchEvent(new CustomEvent('lumina:alarms', { detail: lastStatus }));
+  // epoch is a clock reading, not state: deltas only carry it when the
+  // clock was set, and a stale one must not set the clock back
+  delete lastStatus.epoch;
+}
+
+// The lamp holds the request until something changes (then answers with
+// the changes) or ~25 s pass (304), so an idle page costs next to nothing
+async function startPolling(){
+  if (polling) return;
+  polling = true;
+  while (polling){
+    try{
+      const url = lastStatus ? `/status?since=${lastStatus.version}` : '/status';
+      const resp = await fetch(url, { cache:'no-store' });
+      if (resp.status === 200) showStatus(await resp.json());
+      else if (resp.status !== 304) throw resp.status;
+    }catch(_){
+      await new Promise(r => setTimeout(r, 5000));
+    }
+  }
+}
+function stopPolling(){ polling = false; }
+function wsOpen(){ return ws && ws.readyState === 1; }
+function wsSend(bytes){
+  if (!wsOpen()) return false;
+  ws.send(new Uint8Array(bytes));
+  return true;
+}
+
+// Without the socket: any subset of the state in one request; the lamp
+// answers with the resulting state (applied when `show` is set)
+async function postState(doc, show){
+  try{
+    const resp = await fetch('/state', { method:'POST', headers:{ 'Content-Type':'application/json' }, body: JSON.stringify(doc) });
+    if (show && resp.ok) showStatus(await resp.json());
+  }catch(_){}
+}
+
+function connectWS(){
+  try { ws = new WebSocket(`ws://${location.host}/ws`); }
+  catch(_) { startPolling(); return; }
+  ws.binaryType = 'arraybuffer';
+  ws.onopen  = ()=> stopPolling();
+  ws.onclose = ()=>{ ws = null; startPolling(); setTimeout(connectWS, 3000); };
+  ws.onmessage = (ev)=>{
+    if (typeof ev.data !== 'string') return;
+    let js; try { js = JSON.parse(ev.data); } catch(_) { return; }
+    if (js.t === 'state')  showStatus(js);
+    if (js.t === 'alarms') document.dispatchEvent(new CustomEvent('lumina:alarms', { detail: js }));
+  };
+}
+
+// Over the socket send at most once per animation frame; over HTTP keep
+// the debounce so sliders don't flood the server.
+function liveSender(fn, wait){
+  const deb = debounce(fn, wait);
+  let queued = false;
+  return ()=>{
+    if (!wsOpen()) { deb(); return; }
+    if (queued) return;
+    queued = true;
+    requestAnimationFrame(()=>{ queued = false; fn(); });
+  };
+}
+
+// ==== RGB / HP bindings ====
+async function sendRGB(){
+  if (!colorPicker) return;
+  const {r,g,b}=hexToRgb(colorPicker.value);
+  const bri = brightnessSlider ? Math.round((parseInt(brightnessSlider.value||'100')/100)*255) : 255;
+  if (wsSend([WS_OP_RGB, r, g, b, bri])) return;
+  await postState({ rgb:{ r, g, b, bri } });
+}
+async function sendHP(){
+  if (!hpLEDSlider) return;
+  const hp = Math.round((parseInt(hpLEDSlider.value||'0')/100)*255);
+  if (wsSend([WS_OP_HP, hp])) return;
+  await postState({ hp });
+}
+const sendRGBdeb = liveSender(sendRGB,180);
+const sendHPdeb  = liveSender(sendHP,180);
+
+if (colorPicker && lampCircle) {
+  colorPicker.addEventListener('input', ()=>{
+    lampCircle.style.backgroundColor = colorPicker.value;
+    if (lampColorText) lampColorText.textContent = colorPicker.value.toUpperCase();
+    sendRGBdeb();
+  });
+}
+if (brightnessSlider && brightnessText) {
+  brightnessSlider.addEventListener('input', ()=>{
+    const pct = parseInt(brightnessSlider.value||'100');
+    brightnessText.textContent = `${pct}%`;
+    if (lampCircle) lampCircle.style.opacity = 0.3 + (pct/100)*0.7;
+    sendRGBdeb(); // only RGB brightness
+  });
+}
+if (hpLEDSlider) {
+  hpLEDSlider.addEventListener('input', ()=>{ sendHPdeb(); });
+}
+
+// ==== Time/status sync ====
+async function fetchStatus(){
+  try{
+    const resp = await fetch('/status', { cache:'no-store' });
+    showStatus(await resp.json());
+  }catch(e){}
+}
+
+function applyStatus(js){
+  try{
+    // device UTC epoch, only in documents that carry it
+    if ('epoch' in js && typeof js.epoch === 'number') {
+      deviceEpoch = js.epoch;
+      lastSyncMs  = Date.now();
+      updateTimeBox();
+    }
+
+    // enable/disable "Set back to default" based on saved flag
+    if (applyDefaultBtn){
+      applyDefaultBtn.disabled = !js.defaultSaved;
+      applyDefaultBtn.title = js.defaultSaved ? '' : 'No default saved yet';
+    }
+
+    // Color preview
+    const hex = rgbToHex(js.rgb.r, js.rgb.g, js.rgb.b);
+    if (colorPicker)   colorPicker.value = hex;
+    if (lampCircle)    lampCircle.style.backgroundColor = hex;
+    if (lampColorText) lampColorText.textContent = hex;
+
+    // RGB brightness
+    const rgbPct = Math.round(js.rgb.bri/2.55);
+    if (brightnessSlider){
+      brightnessSlider.value = rgbPct;
+      if (brightnessText) brightnessText.textContent = `${rgbPct}%`;
+      if (lampCircle) lampCircle.style.opacity = 0.3 + (rgbPct/100)*0.7;
+    }
+
+    // HP LED
+    const hpPct = Math.round(js.hp/2.55);
+    if (hpLEDSlider) hpLEDSlider.value = hpPct;
+
+  }catch(e){}
+}
+document.addEventListener('lumina:status', (ev)=> applyStatus(ev.detail));
+window.addEventListener('load', ()=>{ fetchStatus(); connectWS(); });
+
+// Tick displayed device time every second
+setInterval(()=>{
+  if (deviceEpoch != null){
+    const now = Date.now();
+    const delta = Math.floor((now - lastSyncMs)/1000);
+    if (delta > 0){
+      deviceEpoch += delta;
+      lastSyncMs  += delta*1000;
+      updateTimeBox();
+    }
+  }
+}, 1000);
+
+// Manual "Sync Time" from browser -> device (/settime)
+if (syncBtn){
+  syncBtn.addEventListener('click', async ()=>{
+    const epoch = Math.floor(Date.now()/1000);
+    const tz    = new Date().getTimezoneOffset(); // minutes; east of UTC => negative
+    try {
+      await fetch(`/settime?epoch=${epoch}&tz=${tz}`);
+      await fetchStatus();
+      syncBtn.textContent = 'Synced!';
+      setTimeout(()=> syncBtn.textContent = 'Sync Time from Browser', 1500);
+    } catch(_) {}
+  });
+}
+
+// ==== PARTY / UI niceties (unchanged) ====
+const partyToggle = document.getElementById('partyMode');
+const partySettings = document.getElementById('partySettings');
+if (partyToggle && partySettings) {
+  partyToggle.addEventListener('change', ()=>{
+    if (partyToggle.checked) {
+      partySettings.style.display='block';
+      setTimeout(()=>{ partySettings.style.opacity='1'; partySettings.style.transform='translateY(0)'; },10);
+    } else {
+      partySettings.style.opacity='0'; partySettings.style.transform='translateY(-10px)';
+      setTimeout(()=>{ partySettings.style.display='none'; },300);
+    }
+  });
+}
+const customizeBtn = document.getElementById('customizeBtn');
+const customPalette = document.getElementById('customPalette');
+const paletteStatus = document.getElementById('paletteStatus');
+const partyColorPicker = document.getElementById('partyColorPicker');
+if (customizeBtn) {
+  customizeBtn.addEventListener('click', ()=>{
+    const isCustom = paletteStatus.textContent==='Custom';
+    if (isCustom){ paletteStatus.textContent='Default'; customPalette.classList.remove('show'); customizeBtn.textContent='Customize';
+      if (lampCircle) lampCircle.style.backgroundColor='#abcdef';
+      if (colorPicker) colorPicker.value='#abcdef';
+      if (lampColorText) lampColorText.textContent='#ABCDEF';
+      sendRGBdeb();
+    } else { paletteStatus.textContent='Custom'; customPalette.classList.add('show'); customizeBtn.textContent='Default'; }
+  });
+  if (partyColorPicker) {
+    partyColorPicker.addEventListener('input', ()=>{
+      if (lampCircle) lampCircle.style.backgroundColor=partyColorPicker.value;
+      if (lampColorText) lampColorText.textContent=partyColorPicker.value.toUpperCase();
+      if (colorPicker) colorPicker.value=partyColorPicker.value;
+      sendRGBdeb();
+    });
+  }
+}
+
+// ==== Alarms UI ====
+const hourInput      = document.getElementById('hour');
+const minuteInput    = document.getElementById('minute');
+const addAlarmBtn    = document.getElementById('addAlarm');
+const alarmList      = document.getElementById('alarmList');
+const nextTime       = document.getElementById('nextTime');
+const timeRemaining  = document.getElementById('timeRemaining');
+const alarmDate      = document.getElementById('alarmDate');
+
+function formatTimeInput(input, min, max) {
+  input.addEventListener('input', ()=>{
+    let v = parseInt(input.value)||0; if (v>max) v=max; if (v<min) v=min; input.value=v.toString().padStart(2,'0');
+  });
+  input.addEventListener('wheel', e=>{
+    e.preventDefault(); let v=parseInt(input.value)||0; v = e.deltaY<0 ? v+1 : v-1;
+    if (v>max) v=min; if (v<min) v=max; input.value=v.toString().padStart(2,'0');
+  });
+  input.addEventListener('keydown', e=>{
+    let v=parseInt(input.value)||0;
+    if (e.key==='ArrowUp'){ e.preventDefault(); v=v+1>max?min:v+1; input.value=v.toString().padStart(2,'0'); }
+    if (e.key==='ArrowDown'){ e.preventDefault(); v=v-1<min?max:v-1; input.value=v.toString().padStart(2,'0'); }
+  });
+}
+
+const DAY_NAMES = ['Sun','Mon','Tue','Wed','Thu','Fri','Sat'];
+
+let alarmCache = [];
+let alarmNext  = { epoch: 0, id: 0 }; // from the lamp's calendar (UTC seconds)
+async function fetchAlarms() {
+  try{
+    const resp = await fetch('/alarms/list');
+    const js = await resp.json();
+    alarmCache = js.alarms || [];
+    alarmNext  = { epoch: js.next || 0, id: js.nextId || 0 };
+    return alarmCache;
+  }catch(e){ return []; }
+}
+// bit0=Sun..bit6=Sat, by button position (letters are ambiguous)
+function dayMaskFromRow(){
+  let mask = 0;
+  document.querySelectorAll('.day').forEach((d,i)=>{ if (d.classList.contains('active')) mask |= 1<<i; });
+  return mask;
+}
+function isoDate(d){
+  return `${d.getFullYear()}-${String(d.getMonth()+1).padStart(2,'0')}-${String(d.getDate()).padStart(2,'0')}`;
+}
+function describeAlarm(alarm){
+  if (alarm.date) return `Once, ${alarm.date}`;
+  const mask = alarm.daysMask || 0;
+  if (!mask || mask === 0x7F) return 'Alarm, every day';
+  return 'Alarm, every ' + DAY_NAMES.filter((_,i)=>mask & (1<<i)).join(',');
+}
+// Next date (browser local) a weekly alarm rings, ignoring skipped dates
+function nextOccurrenceDate(alarm){
+  const [ah, am] = alarm.time.split(':').map(Number);
+  const mask = alarm.daysMask || 0x7F;
+  const skip = alarm.skip || [];
+  const now = new Date();
+  for (let i=0;i<=7+skip.length*7;i++){
+    const c = new Date(now.getFullYear(), now.getMonth(), now.getDate()+i, ah, am);
+    if (c > now && (mask & (1<<c.getDay())) && !skip.includes(isoDate(c))) return isoDate(c);
+  }
+  return null;
+}
+async function renderAlarms() {
+  const alarms = await fetchAlarms();
+  alarmList.innerHTML = '';
+  if (!alarms.length) { alarmList.innerHTML = '<p class="empty">No alarms have been set yet.</p>'; updateNextAlarm(); return; }
+
+  alarms.sort((a,b)=>a.time.localeCompare(b.time));
+  alarms.forEach(alarm=>{
+    const skip = alarm.skip || [];
+    const skipBtn = alarm.date ? '' : (skip.length
+      ? `<button class="skip-btn active" data-id="${alarm.id}" data-date="${skip[0]}" data-on="0" title="Ring again">Skipping ${skip[0]}</button>`
+      : `<button class="skip-btn" data-id="${alarm.id}" data-on="1" title="Skip the next one">Skip next</button>`);
+    const div = document.createElement('div');
+    div.className = `alarm-item ${alarm.enabled?'':'disabled'}`;
+    div.innerHTML = `
+      <div class="alarm-info">
+        <div class="time">${alarm.time}</div>
+        <div class="desc">${describeAlarm(alarm)}</div>
+      </div>
+      <div class="alarm-controls">
+        ${skipBtn}
+        <label class="switch">
+          <input type="checkbox" ${alarm.enabled?'checked':''} data-id="${alarm.id}">
+          <span class="slider"></span>
+        </label>
+        <button class="delete-btn" data-id="${alarm.id}" title="Delete alarm">
+          <svg width="16" height="16" viewBox="0 0 24 24" fill="none" stroke="currentColor" stroke-width="2">
+            <path d="M3 6h18M19 6v14a2 2 0 0 1-2 2H7a2 2 0 0 1-2-2V6m3 0V4a2 2 0 0 1 2-2h4a2 2 0 0 1 2 2v2"></path>
+          </svg>
+        </button>
+      </div>
+    `;
+    alarmList.appendChild(div);
+  });
+
+  document.querySelectorAll('.alarm-item .switch input').forEach(sw=>{
+    sw.addEventListener('change', async (e)=>{
+      const id = e.target.dataset.id; const en = e.target.checked ? 1 : 0;
+      try{ await fetch(`/alarms/toggle?id=${id}&enabled=${en}`);}catch(_){}
+      e.target.closest('.alarm-item').classList.toggle('disabled', !e.target.checked);
+      await fetchAlarms();
+      updateNextAlarm();
+    });
+  });
+  document.querySelectorAll('.skip-btn').forEach(btn=>{
+    btn.addEventListener('click', async (e)=>{
+      const { id, on } = e.currentTarget.dataset;
+      const alarm = alarmCache.find(a=>String(a.id)===id);
+      const date = on === '1' ? (alarm && nextOccurrenceDate(alarm)) : e.currentTarget.dataset.date;
+      if (!date) return;
+      try{ await fetch(`/alarms/skip?id=${id}&date=${date}&on=${on}`);}catch(_){}
+      await renderAlarms();
+    });
+  });
+  document.querySelectorAll('.delete-btn').forEach(btn=>{
+    btn.addEventListener('click', async (e)=>{
+      const id = e.currentTarget.dataset.id;
+      try{ await fetch(`/alarms/delete?id=${id}`);}catch(_){}
+      await renderAlarms();
+    });
+  });
+
+  updateNextAlarm();
+}
+
+function updateNextAlarm() {
+  const ms = alarmNext.epoch * 1000 - Date.now();
+  if (alarmNext.epoch && ms > 0) {
+    const at = new Date(alarmNext.epoch * 1000);
+    nextTime.textContent = `${String(at.getHours()).padStart(2,'0')}:${String(at.getMinutes()).padStart(2,'0')}`;
+    const mins = Math.ceil(ms/60000);
+    const d = Math.floor(mins/1440), h = Math.floor(mins%1440/60), m = mins%60;
+    timeRemaining.textContent = d>0 ? `In ${d}d ${h}h` : (h>0 ? `In ${h}h ${m}m` : `In ${m}m`);
+    nextTime.style.color = '#007bff'; nextTime.style.fontWeight='700';
+  } else {
+    nextTime.textContent='--:--'; timeRemaining.textContent='No upcoming alarms';
+    nextTime.style.color='#999'; nextTime.style.fontWeight='400';
+  }
+}
+
+if (hourInput && minuteInput) {
+  formatTimeInput(hourInput,0,23);
+  formatTimeInput(minuteInput,0,59);
+  hourInput.value='00'; minuteInput.value='00';
+
+  document.querySelectorAll('.day').forEach(day=>{
+    day.addEventListener('click', ()=>{
+      day.classList.toggle('active');
+      day.style.transform='scale(0.9)'; setTimeout(()=>{ day.style.transform='scale(1)'; },150);
+    });
+  });
+
+  addAlarmBtn.addEventListener('click', async ()=>{
+    const h = hourInput.value.padStart(2,'0');
+    const m = minuteInput.value.padStart(2,'0');
+    const date = alarmDate && alarmDate.value ? `&date=${alarmDate.value}` : '';
+    try{
+      await fetch(`/alarms/add?time=${h}:${m}&mask=${dayMaskFromRow()}${date}&enabled=1`);
+      if (alarmDate) alarmDate.value = '';
+      addAlarmBtn.style.transform='scale(0.95)'; setTimeout(()=>{ addAlarmBtn.style.transform='scale(1)'; },150);
+      await renderAlarms();
+    }catch(_){}
+  });
+
+  // Countdown ticks locally; the list is only refetched when the lamp
+  // pushes an "alarms" event, after our own edits, or once the next alarm
+  // time has passed
+  setInterval(()=>{
+    if (alarmNext.epoch && alarmNext.epoch * 1000 <= Date.now()) renderAlarms();
+    else updateNextAlarm();
+  }, 60000);
+  document.addEventListener('lumina:alarms', ()=>{ renderAlarms(); });
+  (async ()=>{ await renderAlarms(); })();
+}
+
+// ==== Party Mode + Music Sync (ESP32-side /party/set integration) ====
+document.addEventListener('DOMContentLoaded', ()=>{
+  const partySettings    = document.getElementById('partySettings');
+  if (!partySettings) return;
+
+  // Always show party settings (ignore any old show/hide animation)
+  partySettings.style.display   = 'block';
+  partySettings.style.opacity   = '1';
+  partySettings.style.transform = 'none';
+
+  const partyModeOrig   = document.getElementById('partyMode');
+  const musicModeOrig   = document.getElementById('musicMode');
+  const effectList      = document.getElementById('effectList');
+  const effectParamsBox = document.getElementById('effectParams');
+  const speedSlider     = document.getElementById('partySpeed');
+  const brightSlider    = document.getElementById('partyBrightness');
+  const colorModeInputs = Array.from(document.querySelectorAll('input[name="partyColorMode"]'));
+  const singleColorBox  = document.getElementById('partySingleColorBox');
+  const singleColorPicker = document.getElementById('partyColorPicker');
+
+  // Clone switches to clear any previous listeners that might hide the settings
+  let partyMode = partyModeOrig;
+  if (partyModeOrig) {
+    const clone = partyModeOrig.cloneNode(true);
+    partyModeOrig.parentNode.replaceChild(clone, partyModeOrig);
+    partyMode = clone;
+  }
+  let musicMode = musicModeOrig;
+  if (musicModeOrig) {
+    const clone = musicModeOrig.cloneNode(true);
+    musicModeOrig.parentNode.replaceChild(clone, musicModeOrig);
+    musicMode = clone;
+  }
+
+  // Local state (kept simple)
+  const partyState = {
+    on:     partyMode ? partyMode.checked : false,
+    music:  musicMode ? musicMode.checked : false,
+    effect: 0,
+    params: {},
+    speed:  speedSlider  ? parseInt(speedSlider.value  || '50', 10) : 50,
+    bri:    brightSlider ? parseInt(brightSlider.value || '80', 10) : 80,
+    mode:   'rgb',
+    color:  singleColorPicker ? (singleColorPicker.value || '#ff0000') : '#ff0000'
+  };
+
+  function updateSingleColorVisibility(){
+    if (!singleColorBox) return;
+    singleColorBox.style.display = (partyState.mode === 'single') ? 'block' : 'none';
+  }
+
+  const PARTY_MODES = ['rgb', 'random', 'single'];
+
+  async function sendPartyConfig(){
+    const rgb = typeof hexToRgb === 'function' ? hexToRgb(partyState.color) : {r:255,g:0,b:0};
+    const flags = (partyState.on ? 1 : 0) | (partyState.music ? 2 : 0);
+    const mode  = Math.max(0, PARTY_MODES.indexOf(partyState.mode));
+    if (wsSend([WS_OP_PARTY, flags, partyState.effect, partyState.speed, partyState.bri,
+                mode, rgb.r, rgb.g, rgb.b])) return;
+    await postState({ party:{
+      enabled: partyState.on,
+      music:   partyState.music,
+      effect:  partyState.effect,
+      speed:   partyState.speed,
+      bri:     partyState.bri,
+      mode,
+      color:   rgbToHex(rgb.r, rgb.g, rgb.b)
+    } }, true);
+  }
+
+  // Effect buttons (rebuilt from the registry in /status "effects")
+  let effects = null;
+  let shownParamsFor = null;
+
+  function markActiveEffect(){
+    if (!effectList) return;
+    effectList.querySelectorAll('.effect').forEach(btn=>{
+      btn.classList.toggle('active', parseInt(btn.dataset.effect, 10) === partyState.effect);
+    });
+  }
+
+  function buildEffectButtons(list){
+    const names = list.map(e => e.name).join('|');
+    if (!effectList || (effects && effects.map(e => e.name).join('|') === names)) { effects = list; return; }
+    effects = list;
+    effectList.innerHTML = '';
+    list.forEach((e, idx)=>{
+      const btn = document.createElement('button');
+      btn.className = 'effect';
+      btn.dataset.effect = String(idx);
+      btn.textContent = e.name;
+      effectList.appendChild(btn);
+    });
+    shownParamsFor = null;
+    markActiveEffect();
+  }
+
+  function sendParam(idx, key, value){
+    if (wsSend([WS_OP_PARAM, partyState.effect, idx, value])) return;
+    postState({ party:{ effect: partyState.effect, params:{ [key]: value } } });
+  }
+
+  // One slider per parameter of the selected effect
+  function renderEffectParams(){
+    if (!effectParamsBox || !effects) return;
+    const effect = effects[partyState.effect];
+    const params = effect ? effect.params : [];
+    if (shownParamsFor !== partyState.effect) {
+      shownParamsFor = partyState.effect;
+      effectParamsBox.innerHTML = '';
+      params.forEach((p, idx)=>{
+        const label = document.createElement('label');
+        label.textContent = p.label;
+        const input = document.createElement('input');
+        input.type = 'range';
+        input.min = p.min; input.max = p.max;
+        input.dataset.key = p.key;
+        const send = liveSender(()=> sendParam(idx, p.key, parseInt(input.value, 10)), 120);
+        input.addEventListener('input', ()=>{
+          partyState.params[p.key] = parseInt(input.value, 10);
+          send();
+        });
+        effectParamsBox.appendChild(label);
+        effectParamsBox.appendChild(input);
+      });
+    }
+    effectParamsBox.querySelectorAll('input').forEach(input=>{
+      if (input === document.activeElement) return; // don't fight a drag
+      const p = params.find(q => q.key === input.dataset.key);
+      const v = partyState.params[input.dataset.key];
+      input.value = v ?? (p ? p.def : input.value);
+    });
+  }
+
+  if (effectList) {
+    effectList.addEventListener('click', (ev)=>{
+      const btn = ev.target.closest('.effect');
+      if (!btn) return;
+      partyState.effect = parseInt(btn.dataset.effect, 10);
+      partyState.params = {};
+      markActiveEffect();
+      renderEffectParams();
+      btn.style.transform='scale(0.95)';
+      setTimeout(()=>{ btn.style.transform='scale(1)'; },150);
+      sendPartyConfig();
+    });
+  }
+
+  // Speed / brightness
+  if (speedSlider) {
+    speedSlider.addEventListener('input', ()=>{
+      partyState.speed = parseInt(speedSlider.value || '50', 10);
+      sendPartyConfig();
+    });
+  }
+  if (brightSlider) {
+    brightSlider.addEventListener('input', ()=>{
+      partyState.bri = parseInt(brightSlider.value || '80', 10);
+      sendPartyConfig();
+    });
+  }
+
+  // Color mode radios
+  colorModeInputs.forEach(input=>{
+    input.addEventListener('change', ()=>{
+      if (!input.checked) return;
+      partyState.mode = input.value;
+      updateSingleColorVisibility();
+      sendPartyConfig();
+    });
+  });
+
+  // Single-color picker
+  if (singleColorPicker) {
+    singleColorPicker.addEventListener('input', ()=>{
+      partyState.color = singleColorPicker.value || '#ff0000';
+      sendPartyConfig();
+    });
+  }
+
+  // Switches
+  if (partyMode) {
+    partyMode.addEventListener('change', ()=>{
+      partyState.on = partyMode.checked;
+      sendPartyConfig();
+    });
+  }
+  if (musicMode) {
+    musicMode.addEventListener('change', ()=>{
+      partyState.music = musicMode.checked;
+      sendPartyConfig();
+    });
+  }
+
+  // Initialise from /status so the UI matches device state
+  function applyPartyStatus(js){
+    if (!js || !js.party) return;
+    const p = js.party;
+
+    partyState.on    = !!p.enabled;
+    partyState.music = !!p.music;
+    partyState.effect= p.effect ?? 0;
+    partyState.params= p.params || {};
+    partyState.speed = p.speed  ?? partyState.speed;
+    partyState.bri   = p.bri    ?? partyState.bri;
+    partyState.mode  = p.modeName || (typeof p.mode === 'number' ? PARTY_MODES[p.mode] : p.mode) || partyState.mode;
+    partyState.color = p.color  || partyState.color;
+
+    if (partyMode) partyMode.checked = partyState.on;
+    if (musicMode) musicMode.checked = partyState.music;
+    if (speedSlider)  speedSlider.value  = partyState.speed;
+    if (brightSlider) brightSlider.value = partyState.bri;
+    if (singleColorPicker) singleColorPicker.value = partyState.color;
+
+    if (Array.isArray(js.effects)) buildEffectButtons(js.effects);
+    markActiveEffect();
+    renderEffectParams();
+
+    colorModeInputs.forEach(input=>{
+      input.checked = (input.value === partyState.mode);
+    });
+
+    updateSingleColorVisibility();
+  }
+
+  // Keep the controls in sync with /status and WebSocket pushes
+  document.addEventListener('lumina:status', (ev)=> applyPartyStatus(ev.detail));
+
+  updateSingleColorVisibility();
+});
+
+// ==== Advanced Alarm Settings: ramp + type + timeout + test ====
+document.addEventListener('DOMContentLoaded', ()=>{
+  const rampInput      = document.getElementById('rampSeconds');
+  const timeoutInput   = document.getElementById('alarmTimeoutMinutes');
+  const alarmTypeGroup = document.getElementById('alarmTypeGroup');
+  const ledBtn         = alarmTypeGroup ? alarmTypeGroup.querySelector('[data-type="led"]')    : null;
+  const buzzBtn        = alarmTypeGroup ? alarmTypeGroup.querySelector('[data-type="buzzer"]') : null;
+  const testBtn        = document.getElementById('testRampBtn');
+  const stopBtn        = document.getElementById('stopTestBtn');
+  const progressLine   = document.getElementById('testProgress');
+  const progressFill   = progressLine ? progressLine.querySelector('.progress-fill') : null;
+  const resetAlarmBtn  = document.getElementById('resetAlarmBtn');
+
+  if (!rampInput || !timeoutInput || !alarmTypeGroup || !ledBtn || !buzzBtn || !testBtn || !stopBtn) return;
+
+  let testTimer   = null;
+  let testDurMs   = 0;
+  let testStartMs = 0;
+
+  function setProgressActive(active){
+    if (!progressLine || !progressFill) return;
+    if (active) {
+      progressLine.classList.add('active');
+      progressFill.style.width = '0%';
+    } else {
+      progressLine.classList.remove('active');
+      progressFill.style.width = '0%';
+    }
+  }
+
+  function startProgress(seconds){
+    if (!progressLine || !progressFill) return;
+    clearInterval(testTimer);
+    testDurMs   = seconds * 1000;
+    testStartMs = Date.now();
+    setProgressActive(true);
+
+    testTimer = setInterval(()=>{
+      const elapsed = Date.now() - testStartMs;
+      const frac = Math.min(elapsed / testDurMs, 1);
+      progressFill.style.width = (frac * 100).toFixed(1) + '%';
+      if (frac >= 1) {
+        clearInterval(testTimer);
+        setTimeout(()=>{ stopTest(true); }, 300); // auto-stop after ramp ends
+      }
+    }, 100);
+  }
+
+  async function loadAlarmCfg(){
+    try{
+      const resp = await fetch('/alarmcfg/get', { cache:'no-store' });
+      if (!resp.ok) return;
+      const js = await resp.json();
+      if (typeof js.leadSec === 'number') {
+        rampInput.value = js.leadSec;
+      }
+      if (typeof js.timeoutSec === 'number') {
+        const mins = Math.round(js.timeoutSec / 60);
+        timeoutInput.value = mins;
+      }
+      if (typeof js.useLED === 'boolean') {
+        if (js.useLED) ledBtn.classList.add('active');
+        else           ledBtn.classList.remove('active');
+      }
+      if (typeof js.useBuzzer === 'boolean') {
+        if (js.useBuzzer) buzzBtn.classList.add('active');
+        else              buzzBtn.classList.remove('active');
+      }
+    }catch(e){}
+  }
+
+  async function saveAlarmCfg(){
+    const leadSec = parseInt(rampInput.value || '0', 10) || 0;
+    let timeoutMin = parseInt(timeoutInput.value || '0', 10) || 0;
+    if (timeoutMin < 1) timeoutMin = 1;
+    if (timeoutMin > 120) timeoutMin = 120;
+    const useLED  = ledBtn.classList.contains('active');
+    const useBuzz = buzzBtn.classList.contains('active');
+
+    const params = new URLSearchParams({
+      lead:    String(leadSec),
+      led:     useLED ? '1' : '0',
+      buzz:    useBuzz ? '1' : '0',
+      timeout: String(timeoutMin * 60)
+    });
+    try{
+      await fetch('/alarmcfg/set?' + params.toString());
+    }catch(e){}
+  }
+  const saveAlarmCfgDeb = typeof debounce === 'function'
+    ? debounce(saveAlarmCfg, 300)
+    : saveAlarmCfg;
+
+  rampInput.addEventListener('change', saveAlarmCfgDeb);
+  rampInput.addEventListener('blur', saveAlarmCfgDeb);
+  timeoutInput.addEventListener('change', saveAlarmCfgDeb);
+  timeoutInput.addEventListener('blur', saveAlarmCfgDeb);
+
+  // Alarm type buttons act as independent toggles (LED, Buzzer, or both)
+  ledBtn.addEventListener('click', ()=>{
+    ledBtn.classList.toggle('active');
+    saveAlarmCfgDeb();
+  });
+
+  buzzBtn.addEventListener('click', ()=>{
+    buzzBtn.classList.toggle('active');
+    saveAlarmCfgDeb();
+  });
+
+  async function startTest(){
+    const leadSec = parseInt(rampInput.value || '0', 10) || 0;
+    if (leadSec <= 0) return;
+
+    const params = new URLSearchParams({ duration: String(leadSec) });
+    try{
+      testBtn.disabled = true;
+      stopBtn.disabled = false;
+      await fetch('/alarmtest/start?' + params.toString());
+      startProgress(leadSec);
+    }catch(e){
+      testBtn.disabled = false;
+      stopBtn.disabled = true;
+      setProgressActive(false);
+    }
+  }
+
+  async function stopTest(fromAuto=false){
+    clearInterval(testTimer);
+    try{
+      await fetch('/alarmtest/stop');
+    }catch(e){}
+    if (!fromAuto){
+      setProgressActive(false);
+    }
+    testBtn.disabled = false;
+    stopBtn.disabled = true;
+  }
+
+  testBtn.addEventListener('click', startTest);
+  stopBtn.addEventListener('click', ()=> stopTest(false));
+
+  if (resetAlarmBtn) {
+    resetAlarmBtn.addEventListener('click', async ()=>{
+      try{
+        await fetch('/alarm/reset', { cache:'no-store' });
+      }catch(e){}
+    });
+  }
+
+  loadAlarmCfg();
+});
+